@@ -0,0 +1,157 @@
+/*
+  ==============================================================================
+
+   Lock-free audio to GUI analysis tap for the plugin ports
+
+  ==============================================================================
+*/
+
+#include "AnalysisTap.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace analysistap
+{
+
+//==============================================================================
+AnalysisTap::AnalysisTap()
+: data(nullptr),
+	numChannels(0),
+	capacity(0),
+	mask(0),
+	writePos(0),
+	readPos(0),
+	numDropped(0),
+	active(false)
+{
+}
+
+AnalysisTap::AnalysisTap(int numChannels_, int capacity_)
+: data(nullptr),
+	numChannels(0),
+	capacity(0),
+	mask(0),
+	writePos(0),
+	readPos(0),
+	numDropped(0),
+	active(false)
+{
+	setSize(numChannels_, capacity_);
+}
+
+AnalysisTap::~AnalysisTap()
+{
+	delete[] data;
+}
+
+void AnalysisTap::setSize(int numChannels_, int capacity_)
+{
+	uint32_t newCapacity = 1;
+
+	while (newCapacity < (uint32_t) std::max(capacity_, 1))
+		newCapacity <<= 1;
+
+	numChannels_ = std::max(numChannels_, 1);
+
+	if (numChannels_ != numChannels || newCapacity != capacity)
+	{
+		delete[] data;
+		data = new float[numChannels_ * newCapacity];
+		numChannels = numChannels_;
+		capacity = newCapacity;
+		mask = newCapacity - 1;
+	}
+
+	std::memset(data, 0, sizeof(float) * numChannels * capacity);
+	writePos.store(0, std::memory_order_relaxed);
+	readPos.store(0, std::memory_order_relaxed);
+	numDropped.store(0, std::memory_order_relaxed);
+}
+
+//==============================================================================
+void AnalysisTap::setActive(bool shouldBeActive)
+{
+	if (shouldBeActive && ! active.load(std::memory_order_relaxed))
+		discard();
+
+	active.store(shouldBeActive, std::memory_order_release);
+}
+
+//==============================================================================
+void AnalysisTap::push(const float* const* channels, int numInputChannels, int numSamples)
+{
+	if (numSamples <= 0 || numInputChannels <= 0 || data == nullptr
+		|| ! active.load(std::memory_order_acquire))
+		return;
+
+	const uint32_t w = writePos.load(std::memory_order_relaxed);
+	const uint32_t r = readPos.load(std::memory_order_acquire);
+	const uint32_t numFree = capacity - (w - r);
+	const uint32_t num = std::min((uint32_t) numSamples, numFree);
+
+	if (num < (uint32_t) numSamples)
+		numDropped.fetch_add((uint32_t) numSamples - num, std::memory_order_relaxed);
+
+	if (num == 0)
+		return;
+
+	const uint32_t start = w & mask;
+	const uint32_t first = std::min(num, capacity - start);
+
+	for (int ch = 0; ch < numChannels; ++ch)
+	{
+		const float* src = channels[std::min(ch, numInputChannels - 1)];
+		float* dst = data + ch * capacity;
+
+		std::memcpy(dst + start, src, sizeof(float) * first);
+		std::memcpy(dst, src + first, sizeof(float) * (num - first));
+	}
+
+	writePos.store(w + num, std::memory_order_release);
+}
+
+//==============================================================================
+int AnalysisTap::getNumReady() const
+{
+	return (int) (writePos.load(std::memory_order_acquire) - readPos.load(std::memory_order_relaxed));
+}
+
+int AnalysisTap::pull(float* const* dest, int maxSamples)
+{
+	if (maxSamples <= 0 || data == nullptr)
+		return 0;
+
+	const uint32_t w = writePos.load(std::memory_order_acquire);
+	const uint32_t r = readPos.load(std::memory_order_relaxed);
+	const uint32_t num = std::min(w - r, (uint32_t) maxSamples);
+
+	if (num == 0)
+		return 0;
+
+	const uint32_t start = r & mask;
+	const uint32_t first = std::min(num, capacity - start);
+
+	for (int ch = 0; ch < numChannels; ++ch)
+	{
+		const float* src = data + ch * capacity;
+
+		std::memcpy(dest[ch], src + start, sizeof(float) * first);
+		std::memcpy(dest[ch] + first, src, sizeof(float) * (num - first));
+	}
+
+	readPos.store(r + num, std::memory_order_release);
+	return (int) num;
+}
+
+void AnalysisTap::discard()
+{
+	readPos.store(writePos.load(std::memory_order_acquire), std::memory_order_release);
+}
+
+int AnalysisTap::getAndResetNumDropped()
+{
+	return (int) numDropped.exchange(0, std::memory_order_relaxed);
+}
+
+}
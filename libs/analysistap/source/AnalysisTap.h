@@ -0,0 +1,98 @@
+/*
+  ==============================================================================
+
+   Lock-free audio to GUI analysis tap for the plugin ports
+
+  ==============================================================================
+*/
+
+#ifndef ANALYSISTAP_H_INCLUDED
+#define ANALYSISTAP_H_INCLUDED
+
+#include <atomic>
+#include <cstdint>
+
+/*
+	Carries raw samples from the audio thread to whoever draws them, so
+	visualisers can do their FFTs, envelopes and phase work on the consumer
+	side instead of in the audio callback.
+
+	One producer (the audio thread) calls push(), one consumer (a timer or a
+	background thread) calls pull(), setActive() and discard(). Both sides are
+	wait-free: there are no locks, and push() never waits for the reader. When
+	the ring is full the samples that do not fit are dropped and counted, a
+	visualiser can live with a gap.
+
+	The tap is inactive until the consumer calls setActive(true), usually when
+	an editor opens, and push() returns straight away while it is inactive, so
+	a plugin without an open editor pays one atomic load per block. Activating
+	discards whatever was left over from the last time.
+
+	setSize() allocates and must not run while push() or pull() can be called.
+*/
+
+namespace analysistap
+{
+
+class AnalysisTap
+{
+public:
+	AnalysisTap();
+
+	/** capacity is rounded up to a power of two. */
+	AnalysisTap(int numChannels, int capacity);
+	~AnalysisTap();
+
+	void setSize(int numChannels, int capacity);
+
+	int getNumChannels() const { return numChannels; }
+	int getCapacity() const { return (int) capacity; }
+
+	//==============================================================================
+	/** Consumer side: start or stop taking samples. */
+	void setActive(bool shouldBeActive);
+
+	bool isActive() const { return active.load(std::memory_order_acquire); }
+
+	//==============================================================================
+	/** Producer side. Channels missing from the input repeat the last one given,
+		so a mono signal fills every channel of the tap. */
+	void push(const float* const* channels, int numInputChannels, int numSamples);
+
+	void push(const float* samples, int numSamples) { push(&samples, 1, numSamples); }
+
+	//==============================================================================
+	/** Consumer side: samples waiting to be pulled. */
+	int getNumReady() const;
+
+	/** Consumer side: copies up to maxSamples per channel into dest (one pointer
+		per tap channel) and returns how many were copied. */
+	int pull(float* const* dest, int maxSamples);
+
+	int pull(float* dest, int maxSamples) { return pull(&dest, maxSamples); }
+
+	/** Consumer side: throws away everything waiting. */
+	void discard();
+
+	/** Samples the producer had to drop because the consumer fell behind,
+		counted since the last call. */
+	int getAndResetNumDropped();
+
+private:
+	float* data;
+	int numChannels;
+	uint32_t capacity;
+	uint32_t mask;
+
+	std::atomic<uint32_t> writePos;
+	std::atomic<uint32_t> readPos;
+	std::atomic<uint32_t> numDropped;
+	std::atomic<bool> active;
+
+	AnalysisTap(const AnalysisTap&);
+	AnalysisTap& operator=(const AnalysisTap&);
+};
+
+}
+
+#endif  // ANALYSISTAP_H_INCLUDED
@@ -35,7 +35,8 @@
 FFT::FFT (int fftSizeLog2)
     : properties (fftSizeLog2)
 {
-    config = new ffft::FFTReal<float> (properties.fftSize);
+    config = new sharedfft::RealFFT (properties.fftSize);
+    spectrum.setSize (config->getComplexSize());
     
     buffer.malloc (properties.fftSize);
     bufferSplit.realp = buffer.getData();
@@ -50,20 +51,30 @@ void FFT::setFFTSizeLog2 (int newFFTSizeLog2)
 {
     if (newFFTSizeLog2 != properties.fftSizeLog2)
     {
-        config = nullptr;
-        
         properties = Properties (newFFTSizeLog2);
         buffer.malloc (properties.fftSize);
         bufferSplit.realp = buffer.getData();
         bufferSplit.imagp = bufferSplit.realp + properties.fftSizeHalved;
         
-        config = new ffft::FFTReal<float> (properties.fftSize);
+        config->init (properties.fftSize);
+        spectrum.setSize (config->getComplexSize());
     }
 }
 
 void FFT::performFFT (float* samples)
 {
-    config->do_fft (buffer.getData(), samples);
+    config->forward (samples, spectrum.re, spectrum.im);
+
+    // FFTReal layout: the real parts from DC to Nyquist, then the imaginary
+    // parts of the bins in between, negated
+    float* const data = buffer.getData();
+    const int fftSizeHalved = properties.fftSizeHalved;
+
+    for (int i = 0; i <= fftSizeHalved; ++i)
+        data[i] = spectrum.re[i];
+
+    for (int i = 1; i < fftSizeHalved; ++i)
+        data[fftSizeHalved + i] = -spectrum.im[i];
 }
 
 void FFT::getPhase (float* phaseBuffer)
@@ -80,7 +91,17 @@ void FFT::getPhase (float* phaseBuffer)
 
 void FFT::performIFFT (float* fftBuffer)
 {
-    config->do_ifft (fftBuffer, buffer.getData());
+    const int fftSizeHalved = properties.fftSizeHalved;
+
+    for (int i = 0; i <= fftSizeHalved; ++i)
+        spectrum.re[i] = fftBuffer[i];
+
+    spectrum.im[0] = spectrum.im[fftSizeHalved] = 0.0f;
+
+    for (int i = 1; i < fftSizeHalved; ++i)
+        spectrum.im[i] = -fftBuffer[fftSizeHalved + i];
+
+    config->inverse (spectrum.re, spectrum.im, buffer.getData());
 }
 
 #elif JUCE_MAC || JUCE_IOS
@@ -39,7 +39,7 @@ typedef DSPSplitComplex SplitComplex;
 
 #elif DROWAUDIO_USE_FFTREAL
 
-typedef ScopedPointer< ffft::FFTReal<float> > FFTConfig;
+typedef ScopedPointer<sharedfft::RealFFT> FFTConfig;
 
 struct SplitComplex
 {
@@ -183,6 +183,10 @@ private:
     FFTConfig config;
     SplitComplex bufferSplit;
 
+   #if DROWAUDIO_USE_FFTREAL
+    sharedfft::SplitComplex spectrum;
+   #endif
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (FFT)
 };
 
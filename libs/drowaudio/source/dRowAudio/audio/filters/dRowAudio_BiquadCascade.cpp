@@ -0,0 +1,233 @@
+/*
+  ==============================================================================
+
+  This file is part of the dRowAudio JUCE module
+  Copyright 2004-13 by dRowAudio.
+
+  ------------------------------------------------------------------------------
+
+  dRowAudio is provided under the terms of The MIT License (MIT):
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE 
+  SOFTWARE.
+
+  ==============================================================================
+*/
+
+#if DROWAUDIO_USE_SSE_INTRINSICS
+namespace BiquadCascadeHelpers
+{
+    template <bool ramping>
+    static void processLanesSSE (float* data, const int stride, const int numSamples,
+                                 float* s1State, float* s2State,
+                                 const float* c, const float* steps) noexcept
+    {
+        __m128 b0 = _mm_set1_ps (c[0]), b1 = _mm_set1_ps (c[1]), b2 = _mm_set1_ps (c[2]);
+        __m128 a1 = _mm_set1_ps (c[3]), a2 = _mm_set1_ps (c[4]);
+        const __m128 db0 = _mm_set1_ps (steps[0]), db1 = _mm_set1_ps (steps[1]), db2 = _mm_set1_ps (steps[2]);
+        const __m128 da1 = _mm_set1_ps (steps[3]), da2 = _mm_set1_ps (steps[4]);
+
+        __m128 s1 = _mm_loadu_ps (s1State);
+        __m128 s2 = _mm_loadu_ps (s2State);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            float* const frame = data + i * stride;
+            const __m128 x = _mm_loadu_ps (frame);
+            const __m128 y = _mm_add_ps (_mm_mul_ps (b0, x), s1);
+
+            // only the last multiply and subtract of each line depend on y
+            s1 = _mm_sub_ps (_mm_add_ps (_mm_mul_ps (b1, x), s2), _mm_mul_ps (a1, y));
+            s2 = _mm_sub_ps (_mm_mul_ps (b2, x), _mm_mul_ps (a2, y));
+            _mm_storeu_ps (frame, y);
+
+            if (ramping)
+            {
+                b0 = _mm_add_ps (b0, db0);  b1 = _mm_add_ps (b1, db1);  b2 = _mm_add_ps (b2, db2);
+                a1 = _mm_add_ps (a1, da1);  a2 = _mm_add_ps (a2, da2);
+            }
+        }
+
+        // flush anything that would become a denormal, as JUCE_SNAP_TO_ZERO does
+        const __m128 sign = _mm_set1_ps (-0.0f);
+        const __m128 threshold = _mm_set1_ps (1.0e-8f);
+        s1 = _mm_and_ps (s1, _mm_cmpgt_ps (_mm_andnot_ps (sign, s1), threshold));
+        s2 = _mm_and_ps (s2, _mm_cmpgt_ps (_mm_andnot_ps (sign, s2), threshold));
+
+        _mm_storeu_ps (s1State, s1);
+        _mm_storeu_ps (s2State, s2);
+    }
+}
+#endif
+
+//==============================================================================
+BiquadCascade::BiquadCascade (const int numChannels_, const int numStages_)
+    : numChannels (numChannels_),
+      numStages (numStages_),
+      numLanes ((numChannels_ + 3) & ~3),
+      rampPending (false)
+{
+    jassert (numChannels > 0 && numStages > 0);
+
+    coefficients.calloc (5 * numStages);
+    targetCoefficients.calloc (5 * numStages);
+    coefficientSteps.calloc (5 * numStages);
+
+    // pass through until the coefficients are set
+    for (int stage = 0; stage < numStages; ++stage)
+        coefficients[5 * stage] = targetCoefficients[5 * stage] = 1.0f;
+
+    state.calloc (2 * numLanes * numStages);
+    interleaved.calloc (numLanes * blockSize);
+}
+
+BiquadCascade::~BiquadCascade()
+{
+}
+
+//==============================================================================
+void BiquadCascade::setCoefficients (const int stageIndex,
+                                     const IIRCoefficients& newCoefficients,
+                                     const bool rampOverNextBlock) noexcept
+{
+    jassert (isPositiveAndBelow (stageIndex, numStages));
+
+    const SpinLock::ScopedLockType sl (processLock);
+
+    float* const target = targetCoefficients + 5 * stageIndex;
+
+    for (int i = 0; i < 5; ++i)
+        target[i] = newCoefficients.coefficients[i];
+
+    if (rampOverNextBlock)
+        rampPending = true;
+    else
+        for (int i = 0; i < 5; ++i)
+            coefficients[5 * stageIndex + i] = target[i];
+}
+
+void BiquadCascade::reset() noexcept
+{
+    const SpinLock::ScopedLockType sl (processLock);
+    state.clear (2 * numLanes * numStages);
+}
+
+//==============================================================================
+void BiquadCascade::processSamples (float* const* const channelData,
+                                    const int numSamples) noexcept
+{
+    const SpinLock::ScopedLockType sl (processLock);
+
+    if (numSamples <= 0)
+        return;
+
+    const bool ramping = rampPending;
+
+    if (ramping)
+    {
+        const float oneOverNumSamples = 1.0f / numSamples;
+
+        for (int i = 0; i < 5 * numStages; ++i)
+            coefficientSteps[i] = (targetCoefficients[i] - coefficients[i]) * oneOverNumSamples;
+    }
+
+    for (int start = 0; start < numSamples; start += blockSize)
+    {
+        const int numThisTime = jmin ((int) blockSize, numSamples - start);
+
+        // the padding lanes stay at zero so they never produce anything but zeros
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            const float* const src = channelData[channel] + start;
+
+            for (int i = 0; i < numThisTime; ++i)
+                interleaved[i * numLanes + channel] = src[i];
+        }
+
+        for (int stage = 0; stage < numStages; ++stage)
+            processStage (stage, numThisTime, ramping);
+
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            float* const dest = channelData[channel] + start;
+
+            for (int i = 0; i < numThisTime; ++i)
+                dest[i] = interleaved[i * numLanes + channel];
+        }
+    }
+
+    // land exactly on the target rather than on the sum of the steps
+    if (ramping)
+    {
+        memcpy (coefficients, targetCoefficients, 5 * numStages * sizeof (float));
+        rampPending = false;
+    }
+}
+
+void BiquadCascade::processStage (const int stageIndex, const int numSamples, const bool ramping) noexcept
+{
+    float* const c = coefficients + 5 * stageIndex;
+    const float* const steps = coefficientSteps + 5 * stageIndex;
+    float* const s1State = state + 2 * numLanes * stageIndex;
+    float* const s2State = s1State + numLanes;
+
+  #if DROWAUDIO_USE_SSE_INTRINSICS
+    for (int lane = 0; lane < numLanes; lane += 4)
+    {
+        if (ramping)
+            BiquadCascadeHelpers::processLanesSSE<true> (interleaved + lane, numLanes, numSamples,
+                                                         s1State + lane, s2State + lane, c, steps);
+        else
+            BiquadCascadeHelpers::processLanesSSE<false> (interleaved + lane, numLanes, numSamples,
+                                                          s1State + lane, s2State + lane, c, steps);
+    }
+  #else
+    for (int lane = 0; lane < numChannels; ++lane)
+    {
+        float b0 = c[0], b1 = c[1], b2 = c[2], a1 = c[3], a2 = c[4];
+        float s1 = s1State[lane], s2 = s2State[lane];
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            float* const sample = interleaved + i * numLanes + lane;
+            const float x = *sample;
+            const float y = b0 * x + s1;
+
+            s1 = b1 * x + s2 - a1 * y;
+            s2 = b2 * x - a2 * y;
+            *sample = y;
+
+            if (ramping)
+            {
+                b0 += steps[0];  b1 += steps[1];  b2 += steps[2];
+                a1 += steps[3];  a2 += steps[4];
+            }
+        }
+
+        if (! (s1 < -1.0e-8f || s1 > 1.0e-8f))  s1 = 0;
+        if (! (s2 < -1.0e-8f || s2 > 1.0e-8f))  s2 = 0;
+        s1State[lane] = s1;
+        s2State[lane] = s2;
+    }
+  #endif
+
+    // every lane has moved along the same ramp
+    if (ramping)
+        for (int i = 0; i < 5; ++i)
+            c[i] += steps[i] * numSamples;
+}
@@ -0,0 +1,116 @@
+/*
+  ==============================================================================
+
+  This file is part of the dRowAudio JUCE module
+  Copyright 2004-13 by dRowAudio.
+
+  ------------------------------------------------------------------------------
+
+  dRowAudio is provided under the terms of The MIT License (MIT):
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE 
+  SOFTWARE.
+
+  ==============================================================================
+*/
+
+#ifndef __DROWAUDIO_BIQUADCASCADE_H__
+#define __DROWAUDIO_BIQUADCASCADE_H__
+
+//==============================================================================
+/** A chain of biquad stages run over several channels at once.
+
+	Each stage is a transposed direct form II biquad using the same
+	coefficients on every channel, so a cascade can hold a whole EQ or a
+	steep crossover for a multichannel signal. The state of the channels is
+	kept interleaved and, on Intel, four channels are filtered together with
+	SSE, which makes it much cheaper than one BiquadFilter per channel and
+	stage.
+
+	Coefficient changes can be ramped over the next block to avoid zipper
+	noise, and the filter state is flushed to zero at the end of every block
+	so a decaying tail never turns into denormals.
+ */
+class BiquadCascade
+{
+public:
+    //==============================================================================
+	/**	Creates a cascade for a number of channels and stages.
+		All the stages pass the signal through unchanged until their
+		coefficients are set.
+	 */
+	BiquadCascade (int numChannels, int numStages);
+	
+	/** Destructor. */
+	~BiquadCascade();
+	
+	/** Returns the number of channels the cascade was created for. */
+	int getNumChannels() const noexcept         { return numChannels; }
+	
+	/** Returns the number of biquad stages in the cascade. */
+	int getNumStages() const noexcept           { return numStages; }
+	
+    //==============================================================================
+	/**	Sets the coefficients of one of the stages, e.g. from one of the
+		BiquadFilter::make... methods.
+	 
+		If rampOverNextBlock is true the coefficients move linearly from
+		their current values to the new ones over the next call to
+		processSamples(), otherwise they change straight away. Ramping
+		between two stable filters always stays stable.
+	 */
+	void setCoefficients (int stageIndex,
+						  const IIRCoefficients& newCoefficients,
+						  bool rampOverNextBlock = true) noexcept;
+	
+	/** Clears the state of all the stages, the coefficients are left alone. */
+	void reset() noexcept;
+	
+	/**	Filters a block of samples in place.
+		channelData must hold getNumChannels() pointers, each to numSamples
+		samples.
+	 */
+	void processSamples (float* const* channelData,
+						 int numSamples) noexcept;
+	
+private:
+    //==============================================================================
+	// samples interleaved and filtered at a time
+	enum { blockSize = 64 };
+	
+	const int numChannels, numStages;
+	// channels rounded up to a multiple of four so the SIMD lanes are always full
+	const int numLanes;
+	
+	// per stage: b0, b1, b2, a1, a2, already divided by a0
+	HeapBlock<float> coefficients, targetCoefficients, coefficientSteps;
+	bool rampPending;
+	
+	// per stage: the s1 values of every lane followed by the s2 values
+	HeapBlock<float> state;
+	HeapBlock<float> interleaved;
+	
+	SpinLock processLock;
+	
+	void processStage (int stageIndex, int numSamples, bool ramping) noexcept;
+	
+    //==============================================================================
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BiquadCascade);
+};
+
+#endif //__DROWAUDIO_BIQUADCASCADE_H__
@@ -0,0 +1,153 @@
+/*
+  ==============================================================================
+
+  This file is part of the dRowAudio JUCE module
+  Copyright 2004-13 by dRowAudio.
+
+  ------------------------------------------------------------------------------
+
+  dRowAudio is provided under the terms of The MIT License (MIT):
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in all
+  copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE 
+  SOFTWARE.
+
+  ==============================================================================
+*/
+
+#if DROWAUDIO_UNIT_TESTS
+
+
+//==============================================================================
+class BiquadCascadeUnitTests  : public UnitTest
+{
+public:
+    BiquadCascadeUnitTests() : UnitTest ("BiquadCascadeUnitTests") {}
+    
+    void runTest()
+    {
+        const double sampleRate = 44100.0;
+        const int numChannels = 3, numStages = 3, numSamples = 1000;
+        
+        IIRCoefficients stageCoefficients[numStages] =
+        {
+            BiquadFilter::makeLowPass (sampleRate, 5000.0, 0.7),
+            BiquadFilter::makeHighPass (sampleRate, 100.0, 0.7),
+            BiquadFilter::makePeakNotch (sampleRate, 1000.0, 2.0, 2.0f)
+        };
+        
+        beginTest ("Matches BiquadFilter");
+        
+        {
+            AudioSampleBuffer expected (numChannels, numSamples);
+            fillWithNoise (expected);
+            AudioSampleBuffer actual (expected);
+            
+            BiquadCascade cascade (numChannels, numStages);
+            
+            for (int stage = 0; stage < numStages; ++stage)
+                cascade.setCoefficients (stage, stageCoefficients[stage], false);
+            
+            cascade.processSamples (actual.getArrayOfWritePointers(), numSamples);
+            
+            for (int channel = 0; channel < numChannels; ++channel)
+            {
+                for (int stage = 0; stage < numStages; ++stage)
+                {
+                    BiquadFilter filter;
+                    filter.setCoefficients (stageCoefficients[stage]);
+                    filter.processSamples (expected.getWritePointer (channel), numSamples);
+                }
+            }
+            
+            expect (findMaxDifference (expected, actual) < 1.0e-4f);
+        }
+        
+        beginTest ("Ramps land on the new coefficients");
+        
+        {
+            BiquadCascade ramped (numChannels, 1), direct (numChannels, 1);
+            
+            ramped.setCoefficients (0, stageCoefficients[1], false);
+            ramped.setCoefficients (0, stageCoefficients[0]);
+            direct.setCoefficients (0, stageCoefficients[0], false);
+            
+            AudioSampleBuffer buffer (numChannels, numSamples);
+            fillWithNoise (buffer);
+            ramped.processSamples (buffer.getArrayOfWritePointers(), numSamples);
+            ramped.reset();
+            
+            fillWithNoise (buffer);
+            AudioSampleBuffer other (buffer);
+            ramped.processSamples (buffer.getArrayOfWritePointers(), numSamples);
+            direct.processSamples (other.getArrayOfWritePointers(), numSamples);
+            
+            expect (findMaxDifference (buffer, other) == 0.0f);
+        }
+        
+        beginTest ("Tails decay to zero");
+        
+        {
+            BiquadCascade cascade (numChannels, numStages);
+            
+            for (int stage = 0; stage < numStages; ++stage)
+                cascade.setCoefficients (stage, stageCoefficients[stage], false);
+            
+            AudioSampleBuffer buffer (numChannels, numSamples);
+            fillWithNoise (buffer);
+            cascade.processSamples (buffer.getArrayOfWritePointers(), numSamples);
+            
+            for (int i = 0; i < 100; ++i)
+            {
+                buffer.clear();
+                cascade.processSamples (buffer.getArrayOfWritePointers(), numSamples);
+            }
+            
+            for (int channel = 0; channel < numChannels; ++channel)
+                expectEquals (buffer.getMagnitude (channel, 0, numSamples), 0.0f);
+        }
+    }
+    
+private:
+    static void fillWithNoise (AudioSampleBuffer& buffer)
+    {
+        Random random (42);
+        
+        for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+        {
+            float* data = buffer.getWritePointer (channel);
+            
+            for (int i = 0; i < buffer.getNumSamples(); ++i)
+                data[i] = random.nextFloat() * 2.0f - 1.0f;
+        }
+    }
+    
+    static float findMaxDifference (const AudioSampleBuffer& a, const AudioSampleBuffer& b)
+    {
+        float maxDifference = 0.0f;
+        
+        for (int channel = 0; channel < a.getNumChannels(); ++channel)
+            for (int i = 0; i < a.getNumSamples(); ++i)
+                maxDifference = jmax (maxDifference, std::abs (a.getSample (channel, i) - b.getSample (channel, i)));
+        
+        return maxDifference;
+    }
+};
+
+static BiquadCascadeUnitTests biquadCascadeUnitTests;
+
+#endif // DROWAUDIO_UNIT_TESTS
@@ -140,6 +140,12 @@ namespace soundtouch
         #ifdef SOUNDTOUCH_ALLOW_X86_OPTIMIZATIONS
             // Allow SSE optimizations
             #define SOUNDTOUCH_ALLOW_SSE       1
+
+            #if (__x86_64__ || _M_X64) && (__clang__ || __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9) || _MSC_VER >= 1700)
+                // Allow AVX/FMA optimizations, these are chosen at run time
+                // so the library still runs on CPUs without AVX
+                #define SOUNDTOUCH_ALLOW_AVX       1
+            #endif
         #endif
 
     #endif  // SOUNDTOUCH_INTEGER_SAMPLES
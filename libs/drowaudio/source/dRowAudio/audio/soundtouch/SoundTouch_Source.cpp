@@ -88,6 +88,7 @@
 #include "RateTransposer.cpp"
 #include "SoundTouch.cpp"
 #include "sse_optimized.cpp"
+#include "avx_optimized.cpp"
 #include "TDStretch.cpp"
 
 #if JUCE_64BIT
@@ -64,18 +64,13 @@ using namespace soundtouch;
  *
  *****************************************************************************/
 
-// Table for the hierarchical mixing position seeking algorithm
-static const short _scanOffsets[5][24]={
-    { 124,  186,  248,  310,  372,  434,  496,  558,  620,  682,  744, 806,
-      868,  930,  992, 1054, 1116, 1178, 1240, 1302, 1364, 1426, 1488,   0},
-    {-100,  -75,  -50,  -25,   25,   50,   75,  100,    0,    0,    0,   0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   0},
-    { -20,  -15,  -10,   -5,    5,   10,   15,   20,    0,    0,    0,   0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   0},
-    {  -4,   -3,   -2,   -1,    1,    2,    3,    4,    0,    0,    0,   0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   0},
-    { 121,  114,   97,  114,   98,  105,  108,   32,  104,   99,  117,  111,
-      116,  100,  110,  117,  111,  115,    0,    0,    0,    0,    0,   0}};
+// Step of the coarse pass of the quick mixing position seeking algorithm. 
+// Odd, so that the SSE routine that skips every second stereo position still 
+// gets half of the coarse positions.
+#define SCAN_STEP       15
+
+// The fine pass scans this many positions on both sides of the coarse matches
+#define SCAN_WIND       8
 
 /*****************************************************************************
  *
@@ -343,54 +338,10 @@ int TDStretch::seekBestOverlapPositionStereo(const SAMPLETYPE *refPos)
 // value over the overlapping period
 int TDStretch::seekBestOverlapPositionStereoQuick(const SAMPLETYPE *refPos) 
 {
-    int j;
-    int bestOffs;
-    double bestCorr, corr;
-    int scanCount, corrOffset, tempOffset;
-
     // Slopes the amplitude of the 'midBuffer' samples
     precalcCorrReferenceStereo();
 
-    bestCorr = FLT_MIN;
-    bestOffs = _scanOffsets[0][0];
-    corrOffset = 0;
-    tempOffset = 0;
-
-    // Scans for the best correlation value using four-pass hierarchical search.
-    //
-    // The look-up table 'scans' has hierarchical position adjusting steps.
-    // In first pass the routine searhes for the highest correlation with 
-    // relatively coarse steps, then rescans the neighbourhood of the highest
-    // correlation with better resolution and so on.
-    for (scanCount = 0;scanCount < 4; scanCount ++) 
-    {
-        j = 0;
-        while (_scanOffsets[scanCount][j]) 
-        {
-            tempOffset = corrOffset + _scanOffsets[scanCount][j];
-            if (tempOffset >= seekLength) break;
-
-            // Calculates correlation value for the mixing position corresponding
-            // to 'tempOffset'
-            corr = (double)calcCrossCorrStereo(refPos + 2 * tempOffset, pRefMidBuffer);
-            // heuristic rule to slightly favour values close to mid of the range
-            double tmp = (double)(2 * tempOffset - seekLength) / seekLength;
-            corr = ((corr + 0.1) * (1.0 - 0.25 * tmp * tmp));
-
-            // Checks for the highest correlation value
-            if (corr > bestCorr) 
-            {
-                bestCorr = corr;
-                bestOffs = tempOffset;
-            }
-            j ++;
-        }
-        corrOffset = bestOffs;
-    }
-    // clear cross correlation routine state if necessary (is so e.g. in MMX routines).
-    clearCrossCorrState();
-
-    return bestOffs;
+    return seekBestOverlapPositionCoarseToFine(refPos);
 }
 
 
@@ -449,54 +400,99 @@ int TDStretch::seekBestOverlapPositionMono(const SAMPLETYPE *refPos)
 // value over the overlapping period
 int TDStretch::seekBestOverlapPositionMonoQuick(const SAMPLETYPE *refPos) 
 {
-    int j;
-    int bestOffs;
-    double bestCorr, corr;
-    int scanCount, corrOffset, tempOffset;
-
     // Slopes the amplitude of the 'midBuffer' samples
     precalcCorrReferenceMono();
 
-    bestCorr = FLT_MIN;
-    bestOffs = _scanOffsets[0][0];
-    corrOffset = 0;
-    tempOffset = 0;
-
-    // Scans for the best correlation value using four-pass hierarchical search.
-    //
-    // The look-up table 'scans' has hierarchical position adjusting steps.
-    // In first pass the routine searhes for the highest correlation with 
-    // relatively coarse steps, then rescans the neighbourhood of the highest
-    // correlation with better resolution and so on.
-    for (scanCount = 0;scanCount < 4; scanCount ++) 
+    return seekBestOverlapPositionCoarseToFine(refPos);
+}
+
+
+// Calculates the cross-correlation value for the mixing position 'offset', 
+// weighted with the heuristic rule that slightly favours values close to mid 
+// of the range. 'pRefMidBuffer' must have been prepared already.
+double TDStretch::calcWeightedCrossCorr(const SAMPLETYPE *refPos, int offset) const
+{
+    double corr;
+
+    if (channels == 2)
+    {
+        corr = (double)calcCrossCorrStereo(refPos + 2 * offset, pRefMidBuffer);
+    }
+    else
     {
-        j = 0;
-        while (_scanOffsets[scanCount][j]) 
+        corr = (double)calcCrossCorrMono(refPos + offset, pRefMidBuffer);
+    }
+
+    double tmp = (double)(2 * offset - seekLength) / seekLength;
+    return ((corr + 0.1) * (1.0 - 0.25 * tmp * tmp));
+}
+
+
+// Seeks for the optimal overlap-mixing position with a two-pass hierarchical
+// search, used by the 'quick' seek of both the stereo and mono versions.
+//
+// The first pass tests every SCAN_STEP'th position over the permitted range and
+// keeps the two best matches, the second pass then tests every position within
+// SCAN_WIND of them. The second best is kept because the correlation often has
+// two peaks of about the same height one pitch period apart, and the coarse
+// grid may land closer to the lower one. This tests roughly 
+// seekLength / SCAN_STEP + 4 * SCAN_WIND positions instead of seekLength.
+int TDStretch::seekBestOverlapPositionCoarseToFine(const SAMPLETYPE *refPos)
+{
+    int bestOffs, bestOffs2;
+    double bestCorr, bestCorr2, corr;
+    int i, j;
+
+    bestCorr = bestCorr2 = -FLT_MAX;
+    bestOffs = bestOffs2 = -1;
+
+    // Coarse pass, starting half a step in so that the positions are centered
+    for (i = SCAN_STEP / 2; i < seekLength; i += SCAN_STEP) 
+    {
+        corr = calcWeightedCrossCorr(refPos, i);
+
+        if (corr > bestCorr) 
+        {
+            // keep the previous best as the 2nd best match
+            bestCorr2 = bestCorr;
+            bestOffs2 = bestOffs;
+            bestCorr = corr;
+            bestOffs = i;
+        }
+        else if (corr > bestCorr2)
         {
-            tempOffset = corrOffset + _scanOffsets[scanCount][j];
-            if (tempOffset >= seekLength) break;
+            bestCorr2 = corr;
+            bestOffs2 = i;
+        }
+    }
+
+    // Fine pass around both matches, the best position may move to either
+    const int candidates[2] = { bestOffs, bestOffs2 };
+    for (j = 0; j < 2; j ++)
+    {
+        if (candidates[j] < 0) continue;
 
-            // Calculates correlation value for the mixing position corresponding
-            // to 'tempOffset'
-            corr = (double)calcCrossCorrMono(refPos + tempOffset, pRefMidBuffer);
-            // heuristic rule to slightly favour values close to mid of the range
-            double tmp = (double)(2 * tempOffset - seekLength) / seekLength;
-            corr = ((corr + 0.1) * (1.0 - 0.25 * tmp * tmp));
+        int start = max(candidates[j] - SCAN_WIND, 0);
+        int end = candidates[j] + SCAN_WIND + 1;
+        if (end > seekLength) end = seekLength;
 
-            // Checks for the highest correlation value
+        for (i = start; i < end; i ++)
+        {
+            // coarse positions were calculated already
+            if ((i - SCAN_STEP / 2) % SCAN_STEP == 0) continue;
+
+            corr = calcWeightedCrossCorr(refPos, i);
             if (corr > bestCorr) 
             {
                 bestCorr = corr;
-                bestOffs = tempOffset;
+                bestOffs = i;
             }
-            j ++;
         }
-        corrOffset = bestOffs;
     }
     // clear cross correlation routine state if necessary (is so e.g. in MMX routines).
     clearCrossCorrState();
 
-    return bestOffs;
+    return max(bestOffs, 0);
 }
 
 
@@ -753,6 +749,16 @@ TDStretch * TDStretch::newInstance()
 #endif // SOUNDTOUCH_ALLOW_MMX
 
 
+#ifdef SOUNDTOUCH_ALLOW_AVX
+    if (uExtensions & SUPPORT_AVX)
+    {
+        // AVX and FMA support
+        return ::new TDStretchAVX;
+    }
+    else
+#endif // SOUNDTOUCH_ALLOW_AVX
+
+
 #ifdef SOUNDTOUCH_ALLOW_SSE
     if (uExtensions & SUPPORT_SSE)
     {
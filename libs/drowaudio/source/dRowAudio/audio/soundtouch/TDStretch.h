@@ -149,7 +149,9 @@ protected:
     virtual int seekBestOverlapPositionStereoQuick(const SAMPLETYPE *refPos);
     virtual int seekBestOverlapPositionMono(const SAMPLETYPE *refPos);
     virtual int seekBestOverlapPositionMonoQuick(const SAMPLETYPE *refPos);
+    int seekBestOverlapPositionCoarseToFine(const SAMPLETYPE *refPos);
     int seekBestOverlapPosition(const SAMPLETYPE *refPos);
+    double calcWeightedCrossCorr(const SAMPLETYPE *refPos, int offset) const;
 
     virtual void overlapStereo(SAMPLETYPE *output, const SAMPLETYPE *input) const;
     virtual void overlapMono(SAMPLETYPE *output, const SAMPLETYPE *input) const;
@@ -273,5 +275,17 @@ public:
 
 #endif /// SOUNDTOUCH_ALLOW_SSE
 
+
+#ifdef SOUNDTOUCH_ALLOW_AVX
+    /// Class that implements AVX/FMA optimized routines for floating point samples type.
+    class TDStretchAVX : public TDStretch
+    {
+    protected:
+        double calcCrossCorrStereo(const float *mixingPos, const float *compare) const;
+        double calcCrossCorrMono(const float *mixingPos, const float *compare) const;
+    };
+
+#endif /// SOUNDTOUCH_ALLOW_AVX
+
 }
 #endif  /// TDStretch_H
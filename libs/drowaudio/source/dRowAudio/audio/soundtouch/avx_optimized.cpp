@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////
+///
+/// AVX/FMA optimized routines for CPUs from Haswell and Piledriver on. Like
+/// the SSE routines, the AVX optimized functions are gathered into this single 
+/// source code file.
+///
+/// The routines are compiled for AVX and FMA with a function target attribute
+/// in GCC and Clang, so the rest of the library doesn't need -mavx and still
+/// runs on any x86-64 CPU. TDStretch::newInstance() only picks them when 
+/// detectCPUextensions() reports SUPPORT_AVX.
+///
+/// Author        : Copyright (c) Olli Parviainen
+/// Author e-mail : oparviai 'at' iki.fi
+/// SoundTouch WWW: http://www.surina.net/soundtouch
+///
+////////////////////////////////////////////////////////////////////////////////
+//
+// License :
+//
+//  SoundTouch audio processing library
+//  Copyright (c) Olli Parviainen
+//
+//  This library is free software; you can redistribute it and/or
+//  modify it under the terms of the GNU Lesser General Public
+//  License as published by the Free Software Foundation; either
+//  version 2.1 of the License, or (at your option) any later version.
+//
+//  This library is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+//  Lesser General Public License for more details.
+//
+//  You should have received a copy of the GNU Lesser General Public
+//  License along with this library; if not, write to the Free Software
+//  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#include "cpu_detect.h"
+#include "STTypes.h"
+
+using namespace soundtouch;
+
+#ifdef SOUNDTOUCH_ALLOW_AVX
+
+// AVX routines available only with float sample type    
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// implementation of AVX optimized functions of class 'TDStretchAVX'
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include "TDStretch.h"
+#include <immintrin.h>
+#include <math.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define ST_AVX_TARGET   __attribute__ ((target ("avx,fma")))
+#else
+    #define ST_AVX_TARGET
+#endif
+
+// Adds the eight floats of 'v' together
+static inline ST_AVX_TARGET float _horizontalSumAVX(__m256 v)
+{
+    __m128 v4 = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    v4 = _mm_add_ps(v4, _mm_movehl_ps(v4, v4));
+    v4 = _mm_add_ss(v4, _mm_shuffle_ps(v4, v4, 1));
+    return _mm_cvtss_f32(v4);
+}
+
+
+// Calculates the normalized cross correlation of 'numFloats' values, 
+// 'numFloats' must be divisible by 8.
+static ST_AVX_TARGET double _calcCrossCorrAVX(const float *pV1, const float *pV2, int numFloats)
+{
+    __m256 vSum, vNorm, vSum2, vNorm2;
+    int i;
+
+    // Unaligned loads cost next to nothing on AVX capable CPUs, so unlike the 
+    // SSE version every position is calculated.
+    vSum = vNorm = vSum2 = vNorm2 = _mm256_setzero_ps();
+
+    // Two sets of accumulators so that consecutive FMAs don't wait for each other
+    for (i = 0; i + 16 <= numFloats; i += 16) 
+    {
+        __m256 vTemp = _mm256_loadu_ps(pV1 + i);
+        vSum  = _mm256_fmadd_ps(vTemp, _mm256_loadu_ps(pV2 + i), vSum);
+        vNorm = _mm256_fmadd_ps(vTemp, vTemp, vNorm);
+
+        __m256 vTemp2 = _mm256_loadu_ps(pV1 + i + 8);
+        vSum2  = _mm256_fmadd_ps(vTemp2, _mm256_loadu_ps(pV2 + i + 8), vSum2);
+        vNorm2 = _mm256_fmadd_ps(vTemp2, vTemp2, vNorm2);
+    }
+    if (i < numFloats)
+    {
+        __m256 vTemp = _mm256_loadu_ps(pV1 + i);
+        vSum  = _mm256_fmadd_ps(vTemp, _mm256_loadu_ps(pV2 + i), vSum);
+        vNorm = _mm256_fmadd_ps(vTemp, vTemp, vNorm);
+    }
+
+    double norm = sqrt(_horizontalSumAVX(_mm256_add_ps(vNorm, vNorm2)));
+    if (norm < 1e-9) norm = 1.0;    // to avoid div by zero
+
+    return (double)_horizontalSumAVX(_mm256_add_ps(vSum, vSum2)) / norm;
+}
+
+
+// Calculates cross correlation of two buffers
+double TDStretchAVX::calcCrossCorrStereo(const float *pV1, const float *pV2) const
+{
+    // ensure overlapLength is divisible by 8
+    assert((overlapLength % 8) == 0);
+
+    return _calcCrossCorrAVX(pV1, pV2, 2 * overlapLength);
+}
+
+
+// Calculates cross correlation of two buffers
+double TDStretchAVX::calcCrossCorrMono(const float *pV1, const float *pV2) const
+{
+    // ensure overlapLength is divisible by 8
+    assert((overlapLength % 8) == 0);
+
+    return _calcCrossCorrAVX(pV1, pV2, overlapLength);
+}
+
+#endif  // SOUNDTOUCH_ALLOW_AVX
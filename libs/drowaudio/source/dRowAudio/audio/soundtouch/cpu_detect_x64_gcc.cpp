@@ -41,6 +41,10 @@
 
 #include "cpu_detect.h"
 
+#if defined(__x86_64__)
+    #include <cpuid.h>
+#endif
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // processor instructions extension detection routines
@@ -75,6 +79,21 @@ uint detectCPUextensions(void)
 #ifdef x86_64
 	res += SUPPORT_3DNOW;
 #endif
+
+#if defined(__x86_64__)
+	// AVX needs the CPU flags and the OS saving the YMM registers (XCR0 bits 1 and 2)
+	uint eax, ebx, ecx, edx;
+	if (__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+	{
+		const uint avxBits = (1 << 12) | (1 << 27) | (1 << 28);    // FMA, OSXSAVE, AVX
+		if ((ecx & avxBits) == avxBits)
+		{
+			uint xcr0, xcr0High;
+			__asm__ ("xgetbv" : "=a" (xcr0), "=d" (xcr0High) : "c" (0));
+			if ((xcr0 & 6) == 6) res += SUPPORT_AVX;
+		}
+	}
+#endif
 	
 	return res & ~_dwDisabledISA;
 }
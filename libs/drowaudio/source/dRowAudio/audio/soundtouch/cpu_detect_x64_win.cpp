@@ -41,6 +41,8 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "cpu_detect.h"
+#include <intrin.h>
+#include <immintrin.h>
 
 #ifndef _WIN64
 #error wrong platform - this source code file is exclusively for Win64 platform
@@ -80,6 +82,16 @@ uint detectCPUextensions(void)
 #ifdef AMD64
 	res += SUPPORT_3DNOW;
 #endif
+
+	// AVX needs the CPU flags and the OS saving the YMM registers (XCR0 bits 1 and 2)
+	int cpuInfo[4];
+	__cpuid(cpuInfo, 1);
+
+	const int avxBits = (1 << 12) | (1 << 27) | (1 << 28);    // FMA, OSXSAVE, AVX
+	if ((cpuInfo[2] & avxBits) == avxBits && (_xgetbv(0) & 6) == 6)
+	{
+		res += SUPPORT_AVX;
+	}
 	
 	return res & ~_dwDisabledISA;
 }
@@ -46,6 +46,18 @@
 
 #include "dRowAudio.h"
 
+#ifndef DROWAUDIO_USE_SSE_INTRINSICS
+ #if JUCE_INTEL && ! JUCE_MINGW
+  #define DROWAUDIO_USE_SSE_INTRINSICS 1
+ #else
+  #define DROWAUDIO_USE_SSE_INTRINSICS 0
+ #endif
+#endif
+
+#if DROWAUDIO_USE_SSE_INTRINSICS
+ #include <emmintrin.h>
+#endif
+
 #include "audio/soundtouch/SoundTouch_Source.cpp"
 
 namespace drow {
@@ -70,6 +82,8 @@ namespace drow {
 #include "audio/dRowAudio_SampleRateConverter.cpp"
 
 #include "audio/filters/dRowAudio_BiquadFilter.cpp"
+#include "audio/filters/dRowAudio_BiquadCascade.cpp"
+#include "audio/filters/dRowAudio_BiquadCascadeUnitTests.cpp"
 #include "audio/filters/dRowAudio_OnePoleFilter.cpp"
 
 #include "audio/fft/dRowAudio_Window.cpp"
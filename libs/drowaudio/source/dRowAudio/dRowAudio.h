@@ -170,9 +170,11 @@
 
 //=============================================================================
 /** Config: DROWAUDIO_USE_FFTREAL
-    Enables the FFTReal library. By default this is enabled except on the Mac
+    Enables the portable FFT. By default this is enabled except on the Mac
     where the Accelerate framework is preferred. However, if you do explicity 
-    enable this setting fftreal can be used for testing purposes.
+    enable this setting it can be used for testing purposes.
+    The transforms come from libs/sharedfft, the FFTReal layout of the
+    buffers is kept.
  */
 #ifndef DROWAUDIO_USE_FFTREAL
  #if (! JUCE_MAC)
@@ -197,9 +199,9 @@
 #endif
 
 //=============================================================================
-// fftReal needs to be outside of the drow namespace
+// the shared FFT needs to be outside of the drow namespace
 #if DROWAUDIO_USE_FFTREAL
- #include "audio/fft/fftreal/FFTReal.h"
+ #include "SharedFFT.h"
 #endif
 
 //=============================================================================
@@ -277,6 +279,10 @@ using juce::UnitTest;
  #include "audio/filters/dRowAudio_BiquadFilter.h"
 #endif
 
+#ifndef __DROWAUDIO_BIQUADCASCADE_H__
+ #include "audio/filters/dRowAudio_BiquadCascade.h"
+#endif
+
 #ifndef __DROWAUDIO_ONEPOLEFILTER_H__
  #include "audio/filters/dRowAudio_OnePoleFilter.h"
 #endif
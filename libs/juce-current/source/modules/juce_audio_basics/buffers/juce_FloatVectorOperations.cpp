@@ -25,9 +25,9 @@ namespace juce
 
 namespace FloatVectorHelpers
 {
-    #define JUCE_INCREMENT_SRC_DEST         dest += (16 / sizeof (*dest)); src += (16 / sizeof (*dest));
-    #define JUCE_INCREMENT_SRC1_SRC2_DEST   dest += (16 / sizeof (*dest)); src1 += (16 / sizeof (*dest)); src2 += (16 / sizeof (*dest));
-    #define JUCE_INCREMENT_DEST             dest += (16 / sizeof (*dest));
+    #define JUCE_INCREMENT_SRC_DEST         dest += Mode::numParallel; src += Mode::numParallel;
+    #define JUCE_INCREMENT_SRC1_SRC2_DEST   dest += Mode::numParallel; src1 += Mode::numParallel; src2 += Mode::numParallel;
+    #define JUCE_INCREMENT_DEST             dest += Mode::numParallel;
 
    #if JUCE_USE_SSE_INTRINSICS
     static bool isAligned (const void* p) noexcept
@@ -51,6 +51,7 @@ namespace FloatVectorHelpers
         static forcedinline ParallelType loadU (const Type* v) noexcept                 { return _mm_loadu_ps (v); }
         static forcedinline void storeA (Type* dest, ParallelType a) noexcept           { _mm_store_ps (dest, a); }
         static forcedinline void storeU (Type* dest, ParallelType a) noexcept           { _mm_storeu_ps (dest, a); }
+        static forcedinline ParallelType loadInts (const int* v) noexcept               { return _mm_cvtepi32_ps (_mm_loadu_si128 (reinterpret_cast<const __m128i*> (v))); }
 
         static forcedinline ParallelType add (ParallelType a, ParallelType b) noexcept  { return _mm_add_ps (a, b); }
         static forcedinline ParallelType sub (ParallelType a, ParallelType b) noexcept  { return _mm_sub_ps (a, b); }
@@ -58,6 +59,9 @@ namespace FloatVectorHelpers
         static forcedinline ParallelType max (ParallelType a, ParallelType b) noexcept  { return _mm_max_ps (a, b); }
         static forcedinline ParallelType min (ParallelType a, ParallelType b) noexcept  { return _mm_min_ps (a, b); }
 
+        static forcedinline ParallelType multiplyAdd (ParallelType a, ParallelType b, ParallelType c) noexcept       { return add (a, mul (b, c)); }
+        static forcedinline ParallelType multiplySubtract (ParallelType a, ParallelType b, ParallelType c) noexcept  { return sub (a, mul (b, c)); }
+
         static forcedinline ParallelType bit_and (ParallelType a, ParallelType b) noexcept  { return _mm_and_ps (a, b); }
         static forcedinline ParallelType bit_not (ParallelType a, ParallelType b) noexcept  { return _mm_andnot_ps (a, b); }
         static forcedinline ParallelType bit_or  (ParallelType a, ParallelType b) noexcept  { return _mm_or_ps (a, b); }
@@ -90,6 +94,9 @@ namespace FloatVectorHelpers
         static forcedinline ParallelType max (ParallelType a, ParallelType b) noexcept  { return _mm_max_pd (a, b); }
         static forcedinline ParallelType min (ParallelType a, ParallelType b) noexcept  { return _mm_min_pd (a, b); }
 
+        static forcedinline ParallelType multiplyAdd (ParallelType a, ParallelType b, ParallelType c) noexcept       { return add (a, mul (b, c)); }
+        static forcedinline ParallelType multiplySubtract (ParallelType a, ParallelType b, ParallelType c) noexcept  { return sub (a, mul (b, c)); }
+
         static forcedinline ParallelType bit_and (ParallelType a, ParallelType b) noexcept  { return _mm_and_pd (a, b); }
         static forcedinline ParallelType bit_not (ParallelType a, ParallelType b) noexcept  { return _mm_andnot_pd (a, b); }
         static forcedinline ParallelType bit_or  (ParallelType a, ParallelType b) noexcept  { return _mm_or_pd (a, b); }
@@ -99,8 +106,127 @@ namespace FloatVectorHelpers
         static forcedinline Type min (ParallelType a) noexcept  { Type v[numParallel]; storeU (v, a); return jmin (v[0], v[1]); }
     };
 
+    //==============================================================================
+   #if JUCE_USE_AVX_INTRINSICS
+    // The AVX code is compiled for AVX/FMA only inside functions carrying this attribute,
+    // so the rest of the module still runs on any SSE2 machine.
+    #if JUCE_MSVC
+     #define JUCE_AVX_TARGET
+    #else
+     #define JUCE_AVX_TARGET __attribute__ ((target ("avx,fma")))
+    #endif
+
+    // SystemStats only looks at the CPU flags. The OS must also save the YMM registers
+    // on context switches (OSXSAVE set and XCR0 bits 1 and 2), or AVX instructions fault.
+    static bool detectAVX() noexcept
+    {
+        const uint32 avxBits = (1u << 12) | (1u << 27) | (1u << 28);  // FMA, OSXSAVE, AVX
+
+       #if JUCE_MSVC
+        int info[4] = {};
+        __cpuid (info, 1);
+
+        if ((((uint32) info[2]) & avxBits) != avxBits)
+            return false;
+
+        return (_xgetbv (0) & 6) == 6;
+       #else
+        unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+
+        if (! __get_cpuid (1, &eax, &ebx, &ecx, &edx) || (ecx & avxBits) != avxBits)
+            return false;
+
+        unsigned int xcr0 = 0, xcr0High = 0;
+        __asm__ ("xgetbv" : "=a" (xcr0), "=d" (xcr0High) : "c" (0));
+        return (xcr0 & 6) == 6;
+       #endif
+    }
+
+    static bool canUseAVX() noexcept
+    {
+        static const bool canUse = SystemStats::hasAVX() && SystemStats::hasFMA3() && detectAVX();
+        return canUse;
+    }
+
+    struct AVXOps32
+    {
+        using Type = float;
+        using ParallelType = __m256;
+        enum { numParallel = 8 };
+
+        static forcedinline JUCE_AVX_TARGET ParallelType load1 (Type v) noexcept                        { return _mm256_set1_ps (v); }
+        static forcedinline JUCE_AVX_TARGET ParallelType loadU (const Type* v) noexcept                 { return _mm256_loadu_ps (v); }
+        static forcedinline JUCE_AVX_TARGET void storeU (Type* dest, ParallelType a) noexcept           { _mm256_storeu_ps (dest, a); }
+        static forcedinline JUCE_AVX_TARGET ParallelType loadInts (const int* v) noexcept               { return _mm256_cvtepi32_ps (_mm256_loadu_si256 (reinterpret_cast<const __m256i*> (v))); }
+
+        static forcedinline JUCE_AVX_TARGET ParallelType add (ParallelType a, ParallelType b) noexcept  { return _mm256_add_ps (a, b); }
+        static forcedinline JUCE_AVX_TARGET ParallelType sub (ParallelType a, ParallelType b) noexcept  { return _mm256_sub_ps (a, b); }
+        static forcedinline JUCE_AVX_TARGET ParallelType mul (ParallelType a, ParallelType b) noexcept  { return _mm256_mul_ps (a, b); }
+        static forcedinline JUCE_AVX_TARGET ParallelType max (ParallelType a, ParallelType b) noexcept  { return _mm256_max_ps (a, b); }
+        static forcedinline JUCE_AVX_TARGET ParallelType min (ParallelType a, ParallelType b) noexcept  { return _mm256_min_ps (a, b); }
+
+        static forcedinline JUCE_AVX_TARGET ParallelType multiplyAdd (ParallelType a, ParallelType b, ParallelType c) noexcept       { return _mm256_fmadd_ps (b, c, a); }
+        static forcedinline JUCE_AVX_TARGET ParallelType multiplySubtract (ParallelType a, ParallelType b, ParallelType c) noexcept  { return _mm256_fnmadd_ps (b, c, a); }
+
+        static forcedinline JUCE_AVX_TARGET ParallelType bit_and (ParallelType a, ParallelType b) noexcept  { return _mm256_and_ps (a, b); }
+        static forcedinline JUCE_AVX_TARGET ParallelType bit_not (ParallelType a, ParallelType b) noexcept  { return _mm256_andnot_ps (a, b); }
+        static forcedinline JUCE_AVX_TARGET ParallelType bit_or  (ParallelType a, ParallelType b) noexcept  { return _mm256_or_ps (a, b); }
+        static forcedinline JUCE_AVX_TARGET ParallelType bit_xor (ParallelType a, ParallelType b) noexcept  { return _mm256_xor_ps (a, b); }
+    };
+
+    struct AVXOps64
+    {
+        using Type = double;
+        using ParallelType = __m256d;
+        enum { numParallel = 4 };
+
+        static forcedinline JUCE_AVX_TARGET ParallelType load1 (Type v) noexcept                        { return _mm256_set1_pd (v); }
+        static forcedinline JUCE_AVX_TARGET ParallelType loadU (const Type* v) noexcept                 { return _mm256_loadu_pd (v); }
+        static forcedinline JUCE_AVX_TARGET void storeU (Type* dest, ParallelType a) noexcept           { _mm256_storeu_pd (dest, a); }
+
+        static forcedinline JUCE_AVX_TARGET ParallelType add (ParallelType a, ParallelType b) noexcept  { return _mm256_add_pd (a, b); }
+        static forcedinline JUCE_AVX_TARGET ParallelType sub (ParallelType a, ParallelType b) noexcept  { return _mm256_sub_pd (a, b); }
+        static forcedinline JUCE_AVX_TARGET ParallelType mul (ParallelType a, ParallelType b) noexcept  { return _mm256_mul_pd (a, b); }
+        static forcedinline JUCE_AVX_TARGET ParallelType max (ParallelType a, ParallelType b) noexcept  { return _mm256_max_pd (a, b); }
+        static forcedinline JUCE_AVX_TARGET ParallelType min (ParallelType a, ParallelType b) noexcept  { return _mm256_min_pd (a, b); }
+
+        static forcedinline JUCE_AVX_TARGET ParallelType multiplyAdd (ParallelType a, ParallelType b, ParallelType c) noexcept       { return _mm256_fmadd_pd (b, c, a); }
+        static forcedinline JUCE_AVX_TARGET ParallelType multiplySubtract (ParallelType a, ParallelType b, ParallelType c) noexcept  { return _mm256_fnmadd_pd (b, c, a); }
+
+        static forcedinline JUCE_AVX_TARGET ParallelType bit_and (ParallelType a, ParallelType b) noexcept  { return _mm256_and_pd (a, b); }
+        static forcedinline JUCE_AVX_TARGET ParallelType bit_not (ParallelType a, ParallelType b) noexcept  { return _mm256_andnot_pd (a, b); }
+        static forcedinline JUCE_AVX_TARGET ParallelType bit_or  (ParallelType a, ParallelType b) noexcept  { return _mm256_or_pd (a, b); }
+        static forcedinline JUCE_AVX_TARGET ParallelType bit_xor (ParallelType a, ParallelType b) noexcept  { return _mm256_xor_pd (a, b); }
+    };
+
+    template <int typeSize> struct AVXModeType    { using Mode = AVXOps32; };
+    template <>             struct AVXModeType<8> { using Mode = AVXOps64; };
 
+    // Runs the whole 256-bit blocks in an AVX-compiled lambda and leaves the rest of the
+    // samples to the SSE code that follows. Unaligned loads cost nothing extra on AVX
+    // hardware when the data is aligned, so there's no need to branch on the alignment.
+    // The pointers are passed by value so that the loop can keep them in registers.
+    #define JUCE_AVX_VEC_OP(pointerParams, pointers, setupOp, vecLoop, increment) \
+        if (num >= FloatVectorHelpers::AVXModeType<sizeof(*dest)>::Mode::numParallel && FloatVectorHelpers::canUseAVX()) \
+        { \
+            using Mode = FloatVectorHelpers::AVXModeType<sizeof(*dest)>::Mode; \
+            const int numLongOps = num / Mode::numParallel; \
+            \
+            [=] pointerParams JUCE_AVX_TARGET \
+            { \
+                setupOp \
+                vecLoop \
+            } pointers; \
+            \
+            for (int i = 0; i < numLongOps; ++i) { increment } \
+            num &= (Mode::numParallel - 1); \
+            if (num == 0) return; \
+        }
+   #else
+    #define JUCE_AVX_VEC_OP(pointerParams, pointers, setupOp, vecLoop, increment)
+   #endif
 
+    //==============================================================================
     #define JUCE_BEGIN_VEC_OP \
         using Mode = FloatVectorHelpers::ModeType<sizeof(*dest)>::Mode; \
         { \
@@ -113,6 +239,7 @@ namespace FloatVectorHelpers
         for (int i = 0; i < num; ++i) normalOp;
 
     #define JUCE_PERFORM_VEC_OP_DEST(normalOp, vecOp, locals, setupOp) \
+        JUCE_AVX_VEC_OP ((decltype (dest) dest), (dest), setupOp, JUCE_VEC_LOOP (vecOp, dummy, Mode::loadU, Mode::storeU, locals, JUCE_INCREMENT_DEST), JUCE_INCREMENT_DEST) \
         JUCE_BEGIN_VEC_OP \
         setupOp \
         if (FloatVectorHelpers::isAligned (dest))   JUCE_VEC_LOOP (vecOp, dummy, Mode::loadA, Mode::storeA, locals, JUCE_INCREMENT_DEST) \
@@ -120,6 +247,7 @@ namespace FloatVectorHelpers
         JUCE_FINISH_VEC_OP (normalOp)
 
     #define JUCE_PERFORM_VEC_OP_SRC_DEST(normalOp, vecOp, locals, increment, setupOp) \
+        JUCE_AVX_VEC_OP ((decltype (dest) dest, decltype (src) src), (dest, src), setupOp, JUCE_VEC_LOOP (vecOp, Mode::loadU, Mode::loadU, Mode::storeU, locals, increment), increment) \
         JUCE_BEGIN_VEC_OP \
         setupOp \
         if (FloatVectorHelpers::isAligned (dest)) \
@@ -135,6 +263,7 @@ namespace FloatVectorHelpers
         JUCE_FINISH_VEC_OP (normalOp)
 
     #define JUCE_PERFORM_VEC_OP_SRC1_SRC2_DEST(normalOp, vecOp, locals, increment, setupOp) \
+        JUCE_AVX_VEC_OP ((decltype (dest) dest, decltype (src1) src1, decltype (src2) src2), (dest, src1, src2), setupOp, JUCE_VEC_LOOP_TWO_SOURCES (vecOp, Mode::loadU, Mode::loadU, Mode::storeU, locals, increment), increment) \
         JUCE_BEGIN_VEC_OP \
         setupOp \
         if (FloatVectorHelpers::isAligned (dest)) \
@@ -166,6 +295,7 @@ namespace FloatVectorHelpers
         JUCE_FINISH_VEC_OP (normalOp)
 
     #define JUCE_PERFORM_VEC_OP_SRC1_SRC2_DEST_DEST(normalOp, vecOp, locals, increment, setupOp) \
+        JUCE_AVX_VEC_OP ((decltype (dest) dest, decltype (src1) src1, decltype (src2) src2), (dest, src1, src2), setupOp, JUCE_VEC_LOOP_TWO_SOURCES_WITH_DEST_LOAD (vecOp, Mode::loadU, Mode::loadU, Mode::loadU, Mode::storeU, locals, increment), increment) \
         JUCE_BEGIN_VEC_OP \
         setupOp \
         if (FloatVectorHelpers::isAligned (dest)) \
@@ -223,6 +353,9 @@ namespace FloatVectorHelpers
         static forcedinline ParallelType max (ParallelType a, ParallelType b) noexcept  { return vmaxq_f32 (a, b); }
         static forcedinline ParallelType min (ParallelType a, ParallelType b) noexcept  { return vminq_f32 (a, b); }
 
+        static forcedinline ParallelType multiplyAdd (ParallelType a, ParallelType b, ParallelType c) noexcept       { return add (a, mul (b, c)); }
+        static forcedinline ParallelType multiplySubtract (ParallelType a, ParallelType b, ParallelType c) noexcept  { return sub (a, mul (b, c)); }
+
         static forcedinline ParallelType bit_and (ParallelType a, ParallelType b) noexcept  {  return toflt (vandq_u32 (toint (a), toint (b))); }
         static forcedinline ParallelType bit_not (ParallelType a, ParallelType b) noexcept  {  return toflt (vbicq_u32 (toint (a), toint (b))); }
         static forcedinline ParallelType bit_or  (ParallelType a, ParallelType b) noexcept  {  return toflt (vorrq_u32 (toint (a), toint (b))); }
@@ -255,6 +388,9 @@ namespace FloatVectorHelpers
         static forcedinline ParallelType max (ParallelType a, ParallelType b) noexcept  { return jmax (a, b); }
         static forcedinline ParallelType min (ParallelType a, ParallelType b) noexcept  { return jmin (a, b); }
 
+        static forcedinline ParallelType multiplyAdd (ParallelType a, ParallelType b, ParallelType c) noexcept       { return add (a, mul (b, c)); }
+        static forcedinline ParallelType multiplySubtract (ParallelType a, ParallelType b, ParallelType c) noexcept  { return sub (a, mul (b, c)); }
+
         static forcedinline ParallelType bit_and (ParallelType a, ParallelType b) noexcept  {  return toflt (toint (a) & toint (b)); }
         static forcedinline ParallelType bit_not (ParallelType a, ParallelType b) noexcept  {  return toflt ((~toint (a)) & toint (b)); }
         static forcedinline ParallelType bit_or  (ParallelType a, ParallelType b) noexcept  {  return toflt (toint (a) | toint (b)); }
@@ -684,7 +820,7 @@ void JUCE_CALLTYPE FloatVectorOperations::addWithMultiply (float* dest, const fl
    #if JUCE_USE_VDSP_FRAMEWORK
     vDSP_vsma (src, 1, &multiplier, dest, 1, dest, 1, (vDSP_Length) num);
    #else
-    JUCE_PERFORM_VEC_OP_SRC_DEST (dest[i] += src[i] * multiplier, Mode::add (d, Mode::mul (mult, s)),
+    JUCE_PERFORM_VEC_OP_SRC_DEST (dest[i] += src[i] * multiplier, Mode::multiplyAdd (d, mult, s),
                                   JUCE_LOAD_SRC_DEST, JUCE_INCREMENT_SRC_DEST,
                                   const Mode::ParallelType mult = Mode::load1 (multiplier);)
    #endif
@@ -695,7 +831,7 @@ void JUCE_CALLTYPE FloatVectorOperations::addWithMultiply (double* dest, const d
    #if JUCE_USE_VDSP_FRAMEWORK
     vDSP_vsmaD (src, 1, &multiplier, dest, 1, dest, 1, (vDSP_Length) num);
    #else
-    JUCE_PERFORM_VEC_OP_SRC_DEST (dest[i] += src[i] * multiplier, Mode::add (d, Mode::mul (mult, s)),
+    JUCE_PERFORM_VEC_OP_SRC_DEST (dest[i] += src[i] * multiplier, Mode::multiplyAdd (d, mult, s),
                                   JUCE_LOAD_SRC_DEST, JUCE_INCREMENT_SRC_DEST,
                                   const Mode::ParallelType mult = Mode::load1 (multiplier);)
    #endif
@@ -706,7 +842,7 @@ void JUCE_CALLTYPE FloatVectorOperations::addWithMultiply (float* dest, const fl
    #if JUCE_USE_VDSP_FRAMEWORK
     vDSP_vma ((float*) src1, 1, (float*) src2, 1, dest, 1, dest, 1, (vDSP_Length) num);
    #else
-    JUCE_PERFORM_VEC_OP_SRC1_SRC2_DEST_DEST (dest[i] += src1[i] * src2[i], Mode::add (d, Mode::mul (s1, s2)),
+    JUCE_PERFORM_VEC_OP_SRC1_SRC2_DEST_DEST (dest[i] += src1[i] * src2[i], Mode::multiplyAdd (d, s1, s2),
                                              JUCE_LOAD_SRC1_SRC2_DEST,
                                              JUCE_INCREMENT_SRC1_SRC2_DEST, )
    #endif
@@ -717,7 +853,7 @@ void JUCE_CALLTYPE FloatVectorOperations::addWithMultiply (double* dest, const d
    #if JUCE_USE_VDSP_FRAMEWORK
     vDSP_vmaD ((double*) src1, 1, (double*) src2, 1, dest, 1, dest, 1, (vDSP_Length) num);
    #else
-    JUCE_PERFORM_VEC_OP_SRC1_SRC2_DEST_DEST (dest[i] += src1[i] * src2[i], Mode::add (d, Mode::mul (s1, s2)),
+    JUCE_PERFORM_VEC_OP_SRC1_SRC2_DEST_DEST (dest[i] += src1[i] * src2[i], Mode::multiplyAdd (d, s1, s2),
                                              JUCE_LOAD_SRC1_SRC2_DEST,
                                              JUCE_INCREMENT_SRC1_SRC2_DEST, )
    #endif
@@ -725,28 +861,28 @@ void JUCE_CALLTYPE FloatVectorOperations::addWithMultiply (double* dest, const d
 
 void JUCE_CALLTYPE FloatVectorOperations::subtractWithMultiply (float* dest, const float* src, float multiplier, int num) noexcept
 {
-    JUCE_PERFORM_VEC_OP_SRC_DEST (dest[i] -= src[i] * multiplier, Mode::sub (d, Mode::mul (mult, s)),
+    JUCE_PERFORM_VEC_OP_SRC_DEST (dest[i] -= src[i] * multiplier, Mode::multiplySubtract (d, mult, s),
                                   JUCE_LOAD_SRC_DEST, JUCE_INCREMENT_SRC_DEST,
                                   const Mode::ParallelType mult = Mode::load1 (multiplier);)
 }
 
 void JUCE_CALLTYPE FloatVectorOperations::subtractWithMultiply (double* dest, const double* src, double multiplier, int num) noexcept
 {
-    JUCE_PERFORM_VEC_OP_SRC_DEST (dest[i] -= src[i] * multiplier, Mode::sub (d, Mode::mul (mult, s)),
+    JUCE_PERFORM_VEC_OP_SRC_DEST (dest[i] -= src[i] * multiplier, Mode::multiplySubtract (d, mult, s),
                                   JUCE_LOAD_SRC_DEST, JUCE_INCREMENT_SRC_DEST,
                                   const Mode::ParallelType mult = Mode::load1 (multiplier);)
 }
 
 void JUCE_CALLTYPE FloatVectorOperations::subtractWithMultiply (float* dest, const float* src1, const float* src2, int num) noexcept
 {
-    JUCE_PERFORM_VEC_OP_SRC1_SRC2_DEST_DEST (dest[i] -= src1[i] * src2[i], Mode::sub (d, Mode::mul (s1, s2)),
+    JUCE_PERFORM_VEC_OP_SRC1_SRC2_DEST_DEST (dest[i] -= src1[i] * src2[i], Mode::multiplySubtract (d, s1, s2),
                                              JUCE_LOAD_SRC1_SRC2_DEST,
                                              JUCE_INCREMENT_SRC1_SRC2_DEST, )
 }
 
 void JUCE_CALLTYPE FloatVectorOperations::subtractWithMultiply (double* dest, const double* src1, const double* src2, int num) noexcept
 {
-    JUCE_PERFORM_VEC_OP_SRC1_SRC2_DEST_DEST (dest[i] -= src1[i] * src2[i], Mode::sub (d, Mode::mul (s1, s2)),
+    JUCE_PERFORM_VEC_OP_SRC1_SRC2_DEST_DEST (dest[i] -= src1[i] * src2[i], Mode::multiplySubtract (d, s1, s2),
                                              JUCE_LOAD_SRC1_SRC2_DEST,
                                              JUCE_INCREMENT_SRC1_SRC2_DEST, )
 }
@@ -878,7 +1014,7 @@ void JUCE_CALLTYPE FloatVectorOperations::convertFixedToFloat (float* dest, cons
                                   JUCE_LOAD_NONE, JUCE_INCREMENT_SRC_DEST, )
    #else
     JUCE_PERFORM_VEC_OP_SRC_DEST (dest[i] = (float) src[i] * multiplier,
-                                  Mode::mul (mult, _mm_cvtepi32_ps (_mm_loadu_si128 (reinterpret_cast<const __m128i*> (src)))),
+                                  Mode::mul (mult, Mode::loadInts (src)),
                                   JUCE_LOAD_NONE, JUCE_INCREMENT_SRC_DEST,
                                   const Mode::ParallelType mult = Mode::load1 (multiplier);)
    #endif
@@ -1233,6 +1369,15 @@ public:
             FloatVectorOperations::fill (data2, (ValueType) 3, num);
             FloatVectorOperations::addWithMultiply (data1, data1, data2, num);
             u.expect (areAllValuesEqual (data1, num, (ValueType) 8));
+
+            FloatVectorOperations::subtractWithMultiply (data1, data1, data2, num);
+            u.expect (areAllValuesEqual (data1, num, (ValueType) -16));
+
+            FloatVectorOperations::subtractWithMultiply (data2, data1, (ValueType) 2, num);
+            u.expect (areAllValuesEqual (data2, num, (ValueType) 35));
+
+            FloatVectorOperations::clip (data1, data2, (ValueType) 0, (ValueType) 10, num);
+            u.expect (areAllValuesEqual (data1, num, (ValueType) 10));
         }
 
         static void doConversionTest (UnitTest& u, float* data1, float* data2, int* const int1, int num)
@@ -39,6 +39,15 @@
  #include <emmintrin.h>
 #endif
 
+#if JUCE_USE_AVX_INTRINSICS
+ #include <immintrin.h>
+ #if JUCE_MSVC
+  #include <intrin.h>
+ #else
+  #include <cpuid.h>
+ #endif
+#endif
+
 #ifndef JUCE_USE_VDSP_FRAMEWORK
  #define JUCE_USE_VDSP_FRAMEWORK 1
 #endif
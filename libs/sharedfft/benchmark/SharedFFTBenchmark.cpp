@@ -0,0 +1,242 @@
+/*
+  ==============================================================================
+
+   Compares the shared FFT with the implementations the ports used before,
+   each at the frame size of the port it came from.
+
+   The old implementations are kept in benchmark/reference, apart from
+   FFTReal (still part of drowaudio) and Ooura (still a KlangFalter backend).
+
+  ==============================================================================
+*/
+
+#include "SharedFFT.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#define TOMATL_PI 3.14159265358979323846
+#define TOMATL_DECLARE_NON_MOVABLE_COPYABLE(className) \
+	className(const className&) = delete; \
+	className& operator=(const className&) = delete;
+#include "FftCalculator.h"
+
+#include "Fft.h"
+#include "kiss_fftr.h"
+#include "fftreal/FFTReal.h"
+#include "AudioFFT.h"
+
+namespace
+{
+	// one frame of the port's FFT work, forward and inverse as the port does them
+	struct Case
+	{
+		virtual ~Case() {}
+		virtual void run() = 0;
+	};
+
+	void fillNoise(float* data, int size)
+	{
+		for (int i=0; i<size; ++i)
+			data[i] = (float) std::rand() / (float) RAND_MAX - 0.5f;
+	}
+
+	double measure(Case& c, int minIterations)
+	{
+		typedef std::chrono::high_resolution_clock Clock;
+
+		for (int i=0; i<16; ++i)
+			c.run();
+
+		int iterations = 0;
+		const Clock::time_point start = Clock::now();
+		double elapsed = 0;
+
+		while (iterations < minIterations || elapsed < 0.2)
+		{
+			for (int i=0; i<16; ++i)
+				c.run();
+
+			iterations += 16;
+			elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+		}
+
+		return elapsed * 1e9 / iterations;
+	}
+
+	//==============================================================================
+	// easySSP: Bernsee complex FFT on interleaved doubles, forward only
+	struct BernseeCase : public Case
+	{
+		explicit BernseeCase(int size_) : size(size_), input(size_), buffer(2*size_)
+		{
+			fillNoise(input.data(), size);
+		}
+
+		void run() override
+		{
+			for (int i=0; i<size; ++i)
+			{
+				buffer[2*i] = input[i];
+				buffer[2*i + 1] = 0;
+			}
+
+			tomatl::dsp::FftCalculator<double>::calculateFast(buffer.data(), size);
+		}
+
+		const int size;
+		std::vector<float> input;
+		std::vector<double> buffer;
+	};
+
+	// TAL-Vocoder-2: textbook split complex FFT, two forward and one inverse
+	struct TalCase : public Case
+	{
+		explicit TalCase(int size_) : size(size_), order(0), input(size_), re(size_), im(size_)
+		{
+			while ((1 << order) < size)
+				++order;
+			fillNoise(input.data(), size);
+		}
+
+		void run() override
+		{
+			for (int pass=0; pass<3; ++pass)
+			{
+				std::memcpy(re.data(), input.data(), sizeof(float) * size);
+				std::fill(im.begin(), im.end(), 0.0f);
+				fft.FFT2(pass < 2 ? 1 : -1, order, re.data(), im.data());
+			}
+		}
+
+		const int size;
+		int order;
+		Fft fft;
+		std::vector<float> input, re, im;
+	};
+
+	// StereoSourceSeparation: kiss_fftr, two forward and two inverse
+	struct KissCase : public Case
+	{
+		explicit KissCase(int size_) : size(size_), input(size_), output(size_), spectrum(size_/2 + 1)
+		{
+			forward = kiss_fftr_alloc(size, 0, NULL, NULL);
+			inverse = kiss_fftr_alloc(size, 1, NULL, NULL);
+			fillNoise(input.data(), size);
+		}
+
+		~KissCase()
+		{
+			kiss_fftr_free(forward);
+			kiss_fftr_free(inverse);
+		}
+
+		void run() override
+		{
+			for (int pass=0; pass<2; ++pass)
+			{
+				kiss_fftr(forward, input.data(), spectrum.data());
+				kiss_fftri(inverse, spectrum.data(), output.data());
+			}
+		}
+
+		const int size;
+		kiss_fftr_cfg forward, inverse;
+		std::vector<float> input, output;
+		std::vector<kiss_fft_cpx> spectrum;
+	};
+
+	// ReFine: FFTReal, forward only
+	struct FFTRealCase : public Case
+	{
+		explicit FFTRealCase(int size_) : size(size_), fft(size_), input(size_), output(size_)
+		{
+			fillNoise(input.data(), size);
+		}
+
+		void run() override
+		{
+			fft.do_fft(output.data(), input.data());
+		}
+
+		const int size;
+		ffft::FFTReal<float> fft;
+		std::vector<float> input, output;
+	};
+
+	// KlangFalter: Ooura through AudioFFT, forward and inverse
+	struct OouraCase : public Case
+	{
+		explicit OouraCase(int size_) : size(size_), input(size_), output(size_), re(size_/2 + 1), im(size_/2 + 1)
+		{
+			fft.init(size);
+			fillNoise(input.data(), size);
+		}
+
+		void run() override
+		{
+			fft.fft(input.data(), re.data(), im.data());
+			fft.ifft(output.data(), re.data(), im.data());
+		}
+
+		const int size;
+		audiofft::AudioFFT fft;
+		std::vector<float> input, output, re, im;
+	};
+
+	//==============================================================================
+	struct SharedCase : public Case
+	{
+		SharedCase(int size_, int numForward_, int numInverse_)
+		: size(size_), numForward(numForward_), numInverse(numInverse_), fft(size_), input(size_), output(size_)
+		{
+			spectrum.setSize(fft.getComplexSize());
+			fillNoise(input, size);
+		}
+
+		void run() override
+		{
+			for (int i=0; i<numForward; ++i)
+				fft.forward(input, spectrum.re, spectrum.im);
+
+			for (int i=0; i<numInverse; ++i)
+				fft.inverse(spectrum.re, spectrum.im, output);
+		}
+
+		const int size, numForward, numInverse;
+		sharedfft::RealFFT fft;
+		sharedfft::AlignedBuffer input, output;
+		sharedfft::SplitComplex spectrum;
+	};
+
+	void compare(const char* port, const char* name, Case& old, int size, int numForward, int numInverse)
+	{
+		SharedCase shared(size, numForward, numInverse);
+
+		const double oldTime = measure(old, 1000);
+		const double newTime = measure(shared, 1000);
+
+		std::printf("%-24s %-10s %6d  %2d fwd %2d inv  %10.0f ns  %10.0f ns  %6.2fx\n",
+		            port, name, size, numForward, numInverse, oldTime, newTime, oldTime / newTime);
+	}
+}
+
+int main()
+{
+	std::printf("shared FFT backend: %s\n\n", sharedfft::RealFFT::getBackendName());
+	std::printf("%-24s %-10s %6s  %-13s  %13s  %13s  %7s\n", "port", "old", "size", "per frame", "old", "shared", "speedup");
+
+	{ BernseeCase c(2048); compare("easySSP", "Bernsee", c, 2048, 1, 0); }
+	{ TalCase c(512); compare("TAL-Vocoder-2", "FFT2", c, 512, 2, 1); }
+	{ KissCase c(4096); compare("StereoSourceSeparation", "kiss_fftr", c, 4096, 2, 2); }
+	{ FFTRealCase c(512); compare("ReFine 44.1/48 kHz", "FFTReal", c, 512, 1, 0); }
+	{ FFTRealCase c(1024); compare("ReFine 88.2/96 kHz", "FFTReal", c, 1024, 1, 0); }
+	{ OouraCase c(1024); compare("KlangFalter head", "Ooura", c, 1024, 1, 1); }
+	{ OouraCase c(16384); compare("KlangFalter tail", "Ooura", c, 16384, 1, 1); }
+
+	return 0;
+}
@@ -0,0 +1,653 @@
+/*
+  ==============================================================================
+
+   Shared real FFT for the plugin ports
+
+  ==============================================================================
+*/
+
+#include "SharedFFT.h"
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <emmintrin.h>
+#define SHAREDFFT_USE_SSE2 1
+#endif
+
+#if JUCE_DSP_USE_SHARED_FFTW
+ #ifdef _WIN32
+  #include <windows.h>
+ #else
+  #include <dlfcn.h>
+ #endif
+#endif
+
+namespace sharedfft
+{
+
+//==============================================================================
+AlignedBuffer::AlignedBuffer()
+: data(nullptr),
+	ptr(nullptr),
+	size(0)
+{
+}
+
+AlignedBuffer::AlignedBuffer(int size_)
+: data(nullptr),
+	ptr(nullptr),
+	size(0)
+{
+	setSize(size_);
+}
+
+AlignedBuffer::~AlignedBuffer()
+{
+	delete[] data;
+}
+
+void AlignedBuffer::setSize(int newSize)
+{
+	if (newSize != size)
+	{
+		delete[] data;
+		data = nullptr;
+		ptr = nullptr;
+		size = newSize;
+
+		if (size > 0)
+		{
+			// 32 byte alignment, enough for AVX as well
+			data = new float[size + 8];
+			const size_t addr = (size_t) data;
+			ptr = (float*) ((addr + 31) & ~(size_t) 31);
+		}
+	}
+
+	clear();
+}
+
+void AlignedBuffer::clear()
+{
+	if (ptr != nullptr)
+		std::memset(ptr, 0, sizeof(float) * size);
+}
+
+//==============================================================================
+#if JUCE_DSP_USE_SHARED_FFTW
+namespace
+{
+	enum
+	{
+		kFFTWUnaligned = 1 << 1,
+		kFFTWEstimate = 1 << 6
+	};
+
+	// resolved once and never unloaded, so this stays usable during static destruction
+	struct FFTWSymbols
+	{
+		typedef void* (*PlanR2C)(int, float*, float*, unsigned);
+		typedef void* (*PlanC2R)(int, float*, float*, unsigned);
+		typedef void (*ExecuteR2C)(void*, float*, float*);
+		typedef void (*ExecuteC2R)(void*, float*, float*);
+		typedef void (*DestroyPlan)(void*);
+
+		PlanR2C planR2C;
+		PlanC2R planC2R;
+		ExecuteR2C executeR2C;
+		ExecuteC2R executeC2R;
+		DestroyPlan destroyPlan;
+		bool loaded;
+	};
+
+	template <typename FuncPtr>
+	bool getSymbol(void* lib, FuncPtr& dst, const char* name)
+	{
+	   #ifdef _WIN32
+		dst = reinterpret_cast<FuncPtr>(GetProcAddress((HMODULE) lib, name));
+	   #else
+		dst = reinterpret_cast<FuncPtr>(dlsym(lib, name));
+	   #endif
+		return dst != nullptr;
+	}
+
+	void* openFFTW()
+	{
+	   #if defined(_WIN32)
+		static const char* const names[] = { "libfftw3f-3.dll", "libfftw3f.dll", nullptr };
+	   #elif defined(__APPLE__)
+		static const char* const names[] = { "libfftw3f.3.dylib", "libfftw3f.dylib", nullptr };
+	   #else
+		static const char* const names[] = { "libfftw3f.so.3", "libfftw3f.so", nullptr };
+	   #endif
+
+		for (int i=0; names[i] != nullptr; ++i)
+		{
+		   #ifdef _WIN32
+			if (void* const lib = (void*) LoadLibraryA(names[i]))
+		   #else
+			if (void* const lib = dlopen(names[i], RTLD_NOW | RTLD_LOCAL))
+		   #endif
+				return lib;
+		}
+
+		return nullptr;
+	}
+
+	// called with the plan lock held, the FFTW planner is not thread safe
+	const FFTWSymbols& getFFTW()
+	{
+		static FFTWSymbols symbols;
+		static bool tried = false;
+
+		if (! tried)
+		{
+			tried = true;
+			symbols.loaded = false;
+
+			if (void* const lib = openFFTW())
+			{
+				symbols.loaded = getSymbol(lib, symbols.planR2C, "fftwf_plan_dft_r2c_1d")
+				              && getSymbol(lib, symbols.planC2R, "fftwf_plan_dft_c2r_1d")
+				              && getSymbol(lib, symbols.executeR2C, "fftwf_execute_dft_r2c")
+				              && getSymbol(lib, symbols.executeC2R, "fftwf_execute_dft_c2r")
+				              && getSymbol(lib, symbols.destroyPlan, "fftwf_destroy_plan");
+			}
+		}
+
+		return symbols;
+	}
+}
+#endif
+
+//==============================================================================
+struct RealFFT::Plan
+{
+	explicit Plan(int size_)
+	: size(size_),
+		half(size_ / 2),
+		bitReverse(size_ / 2),
+		twiddleRe(size_ / 2),
+		twiddleIm(size_ / 2),
+		realRe(size_ / 4 + 1),
+		realIm(size_ / 4 + 1),
+		fftwForward(nullptr),
+		fftwInverse(nullptr)
+	{
+		int bits = 0;
+		while ((1 << bits) < half)
+			++bits;
+
+		for (int i=0; i<half; ++i)
+		{
+			int r = 0;
+			for (int b=0; b<bits; ++b)
+				r |= ((i >> b) & 1) << (bits - 1 - b);
+			bitReverse[i] = r;
+		}
+
+		// the table of the stage with half length L starts at index L
+		for (int L=1; L<half; L*=2)
+		{
+			for (int j=0; j<L; ++j)
+			{
+				const double phase = -M_PI * j / L;
+				twiddleRe[L + j] = (float) std::cos(phase);
+				twiddleIm[L + j] = (float) std::sin(phase);
+			}
+		}
+
+		for (int k=0; k<=half/2; ++k)
+		{
+			const double phase = -2.0 * M_PI * k / size;
+			realRe[k] = (float) std::cos(phase);
+			realIm[k] = (float) std::sin(phase);
+		}
+
+	   #if JUCE_DSP_USE_SHARED_FFTW
+		const FFTWSymbols& fftw = getFFTW();
+
+		if (fftw.loaded)
+		{
+			// interleaved complex, the split-complex FFTW interface is a lot less tested
+			AlignedBuffer x(size), c(size + 2);
+
+			fftwForward = fftw.planR2C(size, x, c, kFFTWUnaligned | kFFTWEstimate);
+			fftwInverse = fftw.planC2R(size, c, x, kFFTWUnaligned | kFFTWEstimate);
+
+			if (fftwForward == nullptr || fftwInverse == nullptr)
+			{
+				if (fftwForward != nullptr) fftw.destroyPlan(fftwForward);
+				if (fftwInverse != nullptr) fftw.destroyPlan(fftwInverse);
+				fftwForward = fftwInverse = nullptr;
+			}
+		}
+	   #endif
+	}
+
+	~Plan()
+	{
+	   #if JUCE_DSP_USE_SHARED_FFTW
+		if (fftwForward != nullptr)
+		{
+			getFFTW().destroyPlan(fftwForward);
+			getFFTW().destroyPlan(fftwInverse);
+		}
+	   #endif
+	}
+
+	// in-place complex FFT of half points on bit reversed input, forward sign,
+	// re and im must be 16 byte aligned so they are always the RealFFT scratch
+	void transform(float* re, float* im) const;
+
+	void radix2(float* re, float* im, int L) const;
+	void radix4(float* re, float* im, int L) const;
+
+	const int size;
+	const int half;
+	std::vector<int> bitReverse;
+	AlignedBuffer twiddleRe, twiddleIm;
+	AlignedBuffer realRe, realIm;
+	void* fftwForward;
+	void* fftwInverse;
+};
+
+namespace
+{
+	struct PlanCache
+	{
+		~PlanCache()
+		{
+			for (std::map<int, RealFFT::Plan*>::iterator it = plans.begin(); it != plans.end(); ++it)
+				delete it->second;
+		}
+
+		std::mutex lock;
+		std::map<int, RealFFT::Plan*> plans;
+	};
+
+	const RealFFT::Plan* getPlan(int size)
+	{
+		static PlanCache cache;
+		std::lock_guard<std::mutex> sl(cache.lock);
+
+		RealFFT::Plan*& plan = cache.plans[size];
+		if (plan == nullptr)
+			plan = new RealFFT::Plan(size);
+
+		return plan;
+	}
+}
+
+//==============================================================================
+void RealFFT::Plan::radix2(float* re, float* im, int L) const
+{
+	const float* const wr = twiddleRe + L;
+	const float* const wi = twiddleIm + L;
+
+	for (int base=0; base<half; base+=2*L)
+	{
+		float* const r0 = re + base;
+		float* const i0 = im + base;
+		float* const r1 = r0 + L;
+		float* const i1 = i0 + L;
+
+#if SHAREDFFT_USE_SSE2
+		for (int j=0; j<L; j+=4)
+		{
+			const __m128 vwr = _mm_load_ps(wr + j);
+			const __m128 vwi = _mm_load_ps(wi + j);
+			const __m128 xr = _mm_load_ps(r1 + j);
+			const __m128 xi = _mm_load_ps(i1 + j);
+			const __m128 tr = _mm_sub_ps(_mm_mul_ps(xr, vwr), _mm_mul_ps(xi, vwi));
+			const __m128 ti = _mm_add_ps(_mm_mul_ps(xr, vwi), _mm_mul_ps(xi, vwr));
+			const __m128 ar = _mm_load_ps(r0 + j);
+			const __m128 ai = _mm_load_ps(i0 + j);
+			_mm_store_ps(r0 + j, _mm_add_ps(ar, tr));
+			_mm_store_ps(i0 + j, _mm_add_ps(ai, ti));
+			_mm_store_ps(r1 + j, _mm_sub_ps(ar, tr));
+			_mm_store_ps(i1 + j, _mm_sub_ps(ai, ti));
+		}
+#else
+		for (int j=0; j<L; ++j)
+		{
+			const float tr = r1[j]*wr[j] - i1[j]*wi[j];
+			const float ti = r1[j]*wi[j] + i1[j]*wr[j];
+			r1[j] = r0[j] - tr;
+			i1[j] = i0[j] - ti;
+			r0[j] += tr;
+			i0[j] += ti;
+		}
+#endif
+	}
+}
+
+void RealFFT::Plan::radix4(float* re, float* im, int L) const
+{
+	// the stages with half length L and 2L in one pass
+	const float* const w1r = twiddleRe + L;
+	const float* const w1i = twiddleIm + L;
+	const float* const w2r = twiddleRe + 2*L;
+	const float* const w2i = twiddleIm + 2*L;
+
+	for (int base=0; base<half; base+=4*L)
+	{
+		float* const r0 = re + base;
+		float* const i0 = im + base;
+		float* const r1 = r0 + L;
+		float* const i1 = i0 + L;
+		float* const r2 = r0 + 2*L;
+		float* const i2 = i0 + 2*L;
+		float* const r3 = r0 + 3*L;
+		float* const i3 = i0 + 3*L;
+
+#if SHAREDFFT_USE_SSE2
+		for (int j=0; j<L; j+=4)
+		{
+			const __m128 v1r = _mm_load_ps(w1r + j);
+			const __m128 v1i = _mm_load_ps(w1i + j);
+			const __m128 v2r = _mm_load_ps(w2r + j);
+			const __m128 v2i = _mm_load_ps(w2i + j);
+
+			__m128 xr = _mm_load_ps(r1 + j);
+			__m128 xi = _mm_load_ps(i1 + j);
+			__m128 tr = _mm_sub_ps(_mm_mul_ps(xr, v1r), _mm_mul_ps(xi, v1i));
+			__m128 ti = _mm_add_ps(_mm_mul_ps(xr, v1i), _mm_mul_ps(xi, v1r));
+			const __m128 x0r = _mm_load_ps(r0 + j);
+			const __m128 x0i = _mm_load_ps(i0 + j);
+			const __m128 a0r = _mm_add_ps(x0r, tr);
+			const __m128 a0i = _mm_add_ps(x0i, ti);
+			const __m128 a1r = _mm_sub_ps(x0r, tr);
+			const __m128 a1i = _mm_sub_ps(x0i, ti);
+
+			xr = _mm_load_ps(r3 + j);
+			xi = _mm_load_ps(i3 + j);
+			tr = _mm_sub_ps(_mm_mul_ps(xr, v1r), _mm_mul_ps(xi, v1i));
+			ti = _mm_add_ps(_mm_mul_ps(xr, v1i), _mm_mul_ps(xi, v1r));
+			const __m128 x2r = _mm_load_ps(r2 + j);
+			const __m128 x2i = _mm_load_ps(i2 + j);
+			const __m128 a2r = _mm_add_ps(x2r, tr);
+			const __m128 a2i = _mm_add_ps(x2i, ti);
+			const __m128 a3r = _mm_sub_ps(x2r, tr);
+			const __m128 a3i = _mm_sub_ps(x2i, ti);
+
+			tr = _mm_sub_ps(_mm_mul_ps(a2r, v2r), _mm_mul_ps(a2i, v2i));
+			ti = _mm_add_ps(_mm_mul_ps(a2r, v2i), _mm_mul_ps(a2i, v2r));
+			_mm_store_ps(r0 + j, _mm_add_ps(a0r, tr));
+			_mm_store_ps(i0 + j, _mm_add_ps(a0i, ti));
+			_mm_store_ps(r2 + j, _mm_sub_ps(a0r, tr));
+			_mm_store_ps(i2 + j, _mm_sub_ps(a0i, ti));
+
+			// the twiddle of index j+L is the one of index j times -i
+			const __m128 ur = _mm_sub_ps(_mm_mul_ps(a3r, v2r), _mm_mul_ps(a3i, v2i));
+			const __m128 ui = _mm_add_ps(_mm_mul_ps(a3r, v2i), _mm_mul_ps(a3i, v2r));
+			_mm_store_ps(r1 + j, _mm_add_ps(a1r, ui));
+			_mm_store_ps(i1 + j, _mm_sub_ps(a1i, ur));
+			_mm_store_ps(r3 + j, _mm_sub_ps(a1r, ui));
+			_mm_store_ps(i3 + j, _mm_add_ps(a1i, ur));
+		}
+#else
+		for (int j=0; j<L; ++j)
+		{
+			float tr = r1[j]*w1r[j] - i1[j]*w1i[j];
+			float ti = r1[j]*w1i[j] + i1[j]*w1r[j];
+			const float a0r = r0[j] + tr, a0i = i0[j] + ti;
+			const float a1r = r0[j] - tr, a1i = i0[j] - ti;
+
+			tr = r3[j]*w1r[j] - i3[j]*w1i[j];
+			ti = r3[j]*w1i[j] + i3[j]*w1r[j];
+			const float a2r = r2[j] + tr, a2i = i2[j] + ti;
+			const float a3r = r2[j] - tr, a3i = i2[j] - ti;
+
+			tr = a2r*w2r[j] - a2i*w2i[j];
+			ti = a2r*w2i[j] + a2i*w2r[j];
+			r0[j] = a0r + tr; i0[j] = a0i + ti;
+			r2[j] = a0r - tr; i2[j] = a0i - ti;
+
+			const float ur = a3r*w2r[j] - a3i*w2i[j];
+			const float ui = a3r*w2i[j] + a3i*w2r[j];
+			r1[j] = a1r + ui; i1[j] = a1i - ur;
+			r3[j] = a1r - ui; i3[j] = a1i + ur;
+		}
+#endif
+	}
+}
+
+void RealFFT::Plan::transform(float* re, float* im) const
+{
+	if (half < 2)
+		return;
+
+	assert(((size_t) re & 15) == 0 && ((size_t) im & 15) == 0);
+
+	if (half == 2)
+	{
+		const float r = re[1], i = im[1];
+		re[1] = re[0] - r; im[1] = im[0] - i;
+		re[0] += r; im[0] += i;
+		return;
+	}
+
+	// the first two stages have the twiddles 1 and -i only
+	for (int base=0; base<half; base+=4)
+	{
+		float* const r = re + base;
+		float* const i = im + base;
+
+		const float a0r = r[0] + r[1], a0i = i[0] + i[1];
+		const float a1r = r[0] - r[1], a1i = i[0] - i[1];
+		const float a2r = r[2] + r[3], a2i = i[2] + i[3];
+		const float a3r = r[2] - r[3], a3i = i[2] - i[3];
+
+		r[0] = a0r + a2r; i[0] = a0i + a2i;
+		r[2] = a0r - a2r; i[2] = a0i - a2i;
+		r[1] = a1r + a3i; i[1] = a1i - a3r;
+		r[3] = a1r - a3i; i[3] = a1i + a3r;
+	}
+
+	int L = 4;
+
+	for (; 4*L <= half; L *= 4)
+		radix4(re, im, L);
+
+	if (L < half)
+		radix2(re, im, L);
+}
+
+//==============================================================================
+RealFFT::RealFFT()
+: plan(nullptr),
+	size(0)
+{
+}
+
+RealFFT::RealFFT(int size_)
+: plan(nullptr),
+	size(0)
+{
+	init(size_);
+}
+
+void RealFFT::init(int newSize)
+{
+	assert(newSize == 0 || (newSize >= 2 && (newSize & (newSize - 1)) == 0));
+
+	if (newSize == size)
+		return;
+
+	size = newSize;
+	plan = size > 0 ? getPlan(size) : nullptr;
+	scratchRe.setSize(size / 2);
+	scratchIm.setSize(size / 2);
+	fftwBuffer.setSize(plan != nullptr && plan->fftwForward != nullptr ? size + 2 : 0);
+}
+
+void RealFFT::forward(const float* input, float* re, float* im)
+{
+	assert(plan != nullptr);
+
+   #if JUCE_DSP_USE_SHARED_FFTW
+	if (plan->fftwForward != nullptr)
+	{
+		float* const c = fftwBuffer;
+		getFFTW().executeR2C(plan->fftwForward, const_cast<float*>(input), c);
+
+		for (int k=0; k<=size/2; ++k)
+		{
+			re[k] = c[2*k];
+			im[k] = c[2*k + 1];
+		}
+		return;
+	}
+   #endif
+
+	const int M = plan->half;
+	const int* const rev = plan->bitReverse.data();
+	float* const zr = scratchRe;
+	float* const zi = scratchIm;
+
+	// even samples as the real, odd ones as the imaginary part of a half size transform,
+	// done in the scratch buffers as the caller's arrays may not be aligned
+	for (int n=0; n<M; ++n)
+	{
+		zr[rev[n]] = input[2*n];
+		zi[rev[n]] = input[2*n + 1];
+	}
+
+	plan->transform(zr, zi);
+
+	re[0] = zr[0] + zi[0];
+	im[0] = 0;
+	re[M] = zr[0] - zi[0];
+	im[M] = 0;
+
+	if (M >= 2)
+	{
+		re[M/2] = zr[M/2];
+		im[M/2] = -zi[M/2];
+	}
+
+	// split the bins k and M-k into the spectra of the even and odd samples
+	const float* const wr = plan->realRe;
+	const float* const wi = plan->realIm;
+
+	for (int k=1; k<M/2; ++k)
+	{
+		const float ar = zr[k], ai = zi[k];
+		const float br = zr[M - k], bi = -zi[M - k];
+
+		const float er = 0.5f * (ar + br);
+		const float ei = 0.5f * (ai + bi);
+		const float odr = 0.5f * (ai - bi);
+		const float odi = 0.5f * (br - ar);
+
+		const float tr = wr[k]*odr - wi[k]*odi;
+		const float ti = wr[k]*odi + wi[k]*odr;
+
+		re[k] = er + tr;
+		im[k] = ei + ti;
+		re[M - k] = er - tr;
+		im[M - k] = ti - ei;
+	}
+}
+
+void RealFFT::inverse(const float* re, const float* im, float* output)
+{
+	assert(plan != nullptr);
+
+   #if JUCE_DSP_USE_SHARED_FFTW
+	if (plan->fftwInverse != nullptr)
+	{
+		float* const c = fftwBuffer;
+
+		for (int k=0; k<=size/2; ++k)
+		{
+			c[2*k] = re[k];
+			c[2*k + 1] = im[k];
+		}
+
+		// c2r overwrites its input, which is our own copy here
+		getFFTW().executeC2R(plan->fftwInverse, c, output);
+		return;
+	}
+   #endif
+
+	const int M = plan->half;
+	const int* const rev = plan->bitReverse.data();
+	const float* const wr = plan->realRe;
+	const float* const wi = plan->realIm;
+	float* const zr = scratchRe;
+	float* const zi = scratchIm;
+
+	zr[0] = re[0] + re[M];
+	zi[0] = re[0] - re[M];
+
+	if (M >= 2)
+	{
+		zr[rev[M/2]] = 2.0f * re[M/2];
+		zi[rev[M/2]] = -2.0f * im[M/2];
+	}
+
+	// merge the even and odd spectra back into bins k and M-k, bit reversed
+	for (int k=1; k<M/2; ++k)
+	{
+		const float ar = re[k], ai = im[k];
+		const float br = re[M - k], bi = -im[M - k];
+
+		const float er = ar + br;
+		const float ei = ai + bi;
+		const float dr = ar - br;
+		const float di = ai - bi;
+
+		const float odr = wr[k]*dr + wi[k]*di;
+		const float odi = wr[k]*di - wi[k]*dr;
+
+		zr[rev[k]] = er - odi;
+		zi[rev[k]] = ei + odr;
+		zr[rev[M - k]] = er + odi;
+		zi[rev[M - k]] = odr - ei;
+	}
+
+	// swapping real and imaginary parts turns the forward into the inverse transform
+	plan->transform(zi, zr);
+
+#if SHAREDFFT_USE_SSE2
+	if (M >= 4)
+	{
+		for (int n=0; n<M; n+=4)
+		{
+			const __m128 r = _mm_load_ps(zr + n);
+			const __m128 i = _mm_load_ps(zi + n);
+			_mm_storeu_ps(output + 2*n, _mm_unpacklo_ps(r, i));
+			_mm_storeu_ps(output + 2*n + 4, _mm_unpackhi_ps(r, i));
+		}
+		return;
+	}
+#endif
+
+	for (int n=0; n<M; ++n)
+	{
+		output[2*n] = zr[n];
+		output[2*n + 1] = zi[n];
+	}
+}
+
+const char* RealFFT::getBackendName()
+{
+   #if JUCE_DSP_USE_SHARED_FFTW
+	// the library is loaded together with the first plan
+	getPlan(4);
+	return getFFTW().loaded ? "fftw" : "builtin";
+   #else
+	return "builtin";
+   #endif
+}
+
+}
@@ -0,0 +1,127 @@
+/*
+  ==============================================================================
+
+   Shared real FFT for the plugin ports
+
+  ==============================================================================
+*/
+
+#ifndef SHAREDFFT_H_INCLUDED
+#define SHAREDFFT_H_INCLUDED
+
+/*
+	Real-to-complex and complex-to-real FFTs for power of two sizes.
+
+	Twiddles and bit reversal tables are computed once per size and shared by
+	every RealFFT of that size in the process, so creating a RealFFT for a size
+	that is already in use costs one scratch allocation only. The butterflies
+	work on split-complex data (separate real and imaginary arrays) and use
+	SSE2 on x86.
+
+	When built with JUCE_DSP_USE_SHARED_FFTW=1 the plans are handed to
+	libfftw3f if it can be loaded at runtime, otherwise the builtin code is
+	used. Both produce the same results within rounding.
+
+	Conventions follow FFTW:
+	  forward:  X[k] = sum x[n] exp(-2 pi i k n / N), k = 0 .. N/2
+	  inverse:  x[n] = sum X[k] exp(+2 pi i k n / N), unscaled, so a forward
+	            and inverse round trip multiplies the signal by N.
+	The imaginary parts of the DC and Nyquist bins are ignored by inverse() and
+	written as zero by forward().
+
+	The input, output and spectrum arrays passed to forward() and inverse() need
+	no particular alignment, the butterflies run in the RealFFT's own aligned
+	scratch buffers.
+
+	init() allocates, forward() and inverse() do not and are safe to call from
+	the audio thread. One RealFFT must not be used by two threads at once.
+*/
+
+namespace sharedfft
+{
+
+//==============================================================================
+/** Float storage aligned for SIMD loads, zeroed by setSize(). */
+class AlignedBuffer
+{
+public:
+	AlignedBuffer();
+	explicit AlignedBuffer(int size);
+	~AlignedBuffer();
+
+	void setSize(int newSize);
+	void clear();
+
+	int getSize() const { return size; }
+
+	float* get() { return ptr; }
+	const float* get() const { return ptr; }
+
+	operator float*() { return ptr; }
+	operator const float*() const { return ptr; }
+
+private:
+	float* data;
+	float* ptr;
+	int size;
+
+	AlignedBuffer(const AlignedBuffer&);
+	AlignedBuffer& operator=(const AlignedBuffer&);
+};
+
+//==============================================================================
+/** Real and imaginary parts of a spectrum, getComplexSize() bins each. */
+struct SplitComplex
+{
+	void setSize(int numBins)
+	{
+		re.setSize(numBins);
+		im.setSize(numBins);
+	}
+
+	AlignedBuffer re;
+	AlignedBuffer im;
+};
+
+//==============================================================================
+class RealFFT
+{
+public:
+	RealFFT();
+	explicit RealFFT(int size);
+
+	/** Prepares for a transform size, a power of two from 2 on, or 0 to release. */
+	void init(int size);
+
+	int getSize() const { return size; }
+
+	/** Number of bins from DC to Nyquist, size/2 + 1. */
+	int getComplexSize() const { return size / 2 + 1; }
+
+	/** input has getSize() samples, re and im getComplexSize() bins. */
+	void forward(const float* input, float* re, float* im);
+
+	/** output has getSize() samples, re and im getComplexSize() bins. */
+	void inverse(const float* re, const float* im, float* output);
+
+	static int getComplexSize(int size) { return size / 2 + 1; }
+
+	/** "builtin" or "fftw", the latter only with JUCE_DSP_USE_SHARED_FFTW. */
+	static const char* getBackendName();
+
+	struct Plan;
+
+private:
+	const Plan* plan;
+	int size;
+	AlignedBuffer scratchRe;
+	AlignedBuffer scratchIm;
+	AlignedBuffer fftwBuffer;
+
+	RealFFT(const RealFFT&);
+	RealFFT& operator=(const RealFFT&);
+};
+
+}
+
+#endif  // SHAREDFFT_H_INCLUDED
@@ -136,6 +136,11 @@ void SpectrumAnalyserAudioProcessor::prepareToPlay (double newSampleRate, int sa
     spectrumProcessor.setSampleRate (newSampleRate);
 }
 
+void SpectrumAnalyserAudioProcessor::setSpectrumActive (bool shouldBeActive)
+{
+    spectrumProcessor.setActive (shouldBeActive);
+}
+
 void SpectrumAnalyserAudioProcessor::releaseResources()
 {
     // When playback stops, you can use this as an opportunity to free up any
@@ -148,9 +153,8 @@ void SpectrumAnalyserAudioProcessor::processBlock (AudioSampleBuffer& buffer, Mi
     {
         float* channelData = buffer.getWritePointer (channel);
 
-        // Only proceed if the editor is visible.
-        if (getActiveEditor() != nullptr
-            && channel == 0)
+        // Does nothing unless the editor is open, see setSpectrumActive().
+        if (channel == 0)
         {
             spectrumProcessor.copySamples(channelData, buffer.getNumSamples());
         }
@@ -67,6 +67,9 @@ public:
     void setStateInformation (const void* data, int sizeInBytes);
     
     Value sampleRate;
+    
+    /** Lets the spectrum processor take samples while an editor is open. */
+    void setSpectrumActive (bool shouldBeActive);
 
 private:
     TimeSliceThread renderThread;
@@ -47,10 +47,13 @@ SpectrumAnalyserAudioProcessorEditor::SpectrumAnalyserAudioProcessorEditor (Spec
     
     // The plugin's initial editor size.
     setSize (1000, 500);
+    
+    getProcessor()->setSpectrumActive (true);
 }
 
 SpectrumAnalyserAudioProcessorEditor::~SpectrumAnalyserAudioProcessorEditor()
 {
+    getProcessor()->setSpectrumActive (false);
 }
 
 //==============================================================================
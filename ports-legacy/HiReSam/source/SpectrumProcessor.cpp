@@ -15,15 +15,13 @@
 SpectrumProcessor::SpectrumProcessor (int fftSizeLog2)
   : fftEngine         {fftSizeLog2},
     tempBlock         (fftEngine.getFFTSize()),
-// TODO: Make the circularBuffer dependant of the buffer size of the incoming audio stream.
-    circularBuffer    (jmax (fftEngine.getMagnitudesBuffer().getSize() * 4, 2048)),
-    needToProcess     {false},
+// A render thread that falls behind by more than the tap holds just skips samples.
+    tap               (1, jmax (fftEngine.getFFTSize() * 16, 32768)),
+    shouldBeActive    (0),
     detectedFrequency {var(0)},
     repaintViewer     (var(false))
 {
     fftEngine.setWindowType (drow::Window::Hann);
-    
-    circularBuffer.reset();
 }
 
 SpectrumProcessor::~SpectrumProcessor()
@@ -35,19 +33,25 @@ void SpectrumProcessor::setSampleRate (double newSampleRate)
     sampleRate = newSampleRate;
 }
 
+void SpectrumProcessor::setActive (bool active)
+{
+    shouldBeActive = active ? 1 : 0;
+}
+
 void SpectrumProcessor::copySamples (const float* samples, int numSamples)
 {
-	circularBuffer.writeSamples (samples, numSamples);
-	needToProcess = true;
+	tap.push (samples, numSamples);
 }
 
 int SpectrumProcessor::useTimeSlice()
 {
-    if (needToProcess)
-    {
+    // the tap belongs to this thread on the reading side
+    const bool active = shouldBeActive.get() != 0;
+    if (active != tap.isActive())
+        tap.setActive (active);
+
+    if (tap.getNumReady() > fftEngine.getFFTSize())
         process();
-        needToProcess = false;
-    }
     
     const int sleepTime = 5; // [ms]
     return sleepTime;
@@ -55,11 +59,9 @@ int SpectrumProcessor::useTimeSlice()
 
 void SpectrumProcessor::process()
 {
-    jassert (circularBuffer.getNumFree() != 0); // buffer is too small!
-    
-    while (circularBuffer.getNumAvailable() > fftEngine.getFFTSize())
+    while (tap.getNumReady() > fftEngine.getFFTSize())
 	{
-		circularBuffer.readSamples (tempBlock.getData(), fftEngine.getFFTSize());
+		tap.pull (tempBlock.getData(), fftEngine.getFFTSize());
 		fftEngine.performFFT (tempBlock);
 		fftEngine.updateMagnitudesIfBigger();
         
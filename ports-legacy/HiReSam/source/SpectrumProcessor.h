@@ -15,6 +15,7 @@
 
 
 #include "SpectrumAnalyserHeader.h"
+#include "AnalysisTap.h"
 
 #if JUCE_MAC || JUCE_IOS || DROWAUDIO_USE_FFTREAL
 
@@ -22,8 +23,9 @@
 /** Provides the audio processing part for a spectrum analyser.
  
     Register it with a TimeSliceThread, make sure its running and then continually
-    call the copySamples() method. The FFT itself will be performed on a background
-    thread.
+    call the copySamples() method. The samples go through a lock-free analysis tap,
+    the FFT itself will be performed on a background thread, and only while the
+    processor is active (see setActive()).
  */
 class SpectrumProcessor : public TimeSliceClient
 {
@@ -40,9 +42,15 @@ public:
     
     void setSampleRate (double sampleRate);
     
+    /** Starts or stops taking samples, usually when an editor opens or closes.
+        Can be called from any thread, the background thread picks it up.
+     */
+    void setActive (bool shouldBeActive);
+    
 	/** Copy a set of samples, ready to be processed.
         Your audio callback should continually call this method to pass it its
-        audio data. When the scope has enough samples to perform an fft it will do
+        audio data. It never blocks and does nothing while the processor is not
+        active. When the scope has enough samples to perform an fft it will do
         so on a background thread.
      */
 	void copySamples (const float* samples, int numSamples);
@@ -61,8 +69,8 @@ public:
 private:
     drow::FFTEngine fftEngine;
 	HeapBlock<float> tempBlock;
-    drow::FifoBuffer<float> circularBuffer;
-	bool needToProcess;
+    analysistap::AnalysisTap tap;
+    Atomic<int> shouldBeActive;
     
     double sampleRate;
     Value detectedFrequency;
@@ -0,0 +1,308 @@
+/**
+ *
+ * Copyright (c) 2015 Pascal Gauthier.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+ *
+ */
+
+#include "CartLibrary.h"
+#include "Dexed.h"
+
+// "DXLB", bump the version when the layout changes, old indexes are rebuilt
+static const int INDEX_MAGIC = 0x424c5844;
+static const int INDEX_VERSION = 1;
+
+// files looked at per time slice, a slice must stay short so removeTimeSliceClient doesn't wait
+static const int FILES_PER_SLICE = 16;
+
+CartLibrary::CartLibrary(const File &cartDir, const File &indexFile) {
+    this->cartDir = cartDir;
+    this->indexFile = indexFile;
+    dirty = false;
+    state = LOAD;
+    scanning = 1;
+    rescanPending = 1;
+}
+
+CartLibrary::~CartLibrary() {
+    if ( dirty )
+        save();
+}
+
+void CartLibrary::rescan() {
+    rescanPending = 1;
+}
+
+bool CartLibrary::isScanning() const {
+    return scanning.get() != 0;
+}
+
+int CartLibrary::getNumVoices() const {
+    const ScopedLock sl(lock);
+    int count = 0;
+
+    for (int i = 0; i < entries.size(); i++)
+        count += entries[i]->numVoices;
+    return count;
+}
+
+int64 CartLibrary::hashProgram(const uint8_t *unpackPgm) {
+    // FNV-1a over everything before the name (offset 145)
+    uint64 hash = 0xcbf29ce484222325ULL;
+
+    for (int i = 0; i < 145; i++) {
+        hash ^= unpackPgm[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return (int64) hash;
+}
+
+void CartLibrary::search(const String &text, Array<Result> &results, int maxResults) const {
+    results.clearQuick();
+
+    if ( text.isEmpty() )
+        return;
+
+    HashMap<int64, int> found;
+    const ScopedLock sl(lock);
+
+    for (int i = 0; i < entries.size(); i++) {
+        const Entry *entry = entries[i];
+
+        for (int j = 0; j < entry->numVoices; j++) {
+            if ( ! entry->names[j].containsIgnoreCase(text) )
+                continue;
+
+            int64 hash = entry->hashes[j];
+            if ( found.contains(hash) ) {
+                results.getReference(found[hash]).duplicates++;
+                continue;
+            }
+
+            if ( results.size() >= maxResults )
+                continue;
+
+            Result result;
+            result.name = entry->names[j];
+            result.file = File(entry->path);
+            result.program = j;
+            result.duplicates = 0;
+            found.set(hash, results.size());
+            results.add(result);
+        }
+    }
+}
+
+int CartLibrary::useTimeSlice() {
+    if ( state == LOAD ) {
+        load();
+        state = IDLE;
+        sendChangeMessage();
+    }
+
+    if ( state == IDLE ) {
+        if ( ! rescanPending.compareAndSetBool(0, 1) )
+            return 500;
+
+        {
+            const ScopedLock sl(lock);
+            for (int i = 0; i < entries.size(); i++)
+                entries[i]->seen = false;
+        }
+
+        scanning = 1;
+        scanner = new DirectoryIterator(cartDir, true, "*", File::findFiles);
+        state = SCAN;
+    }
+
+    bool changed = false;
+
+    for (int i = 0; i < FILES_PER_SLICE; i++) {
+        int64 size;
+        Time modified;
+
+        if ( ! scanner->next(nullptr, nullptr, &size, &modified, nullptr, nullptr) ) {
+            endScan();
+            return 500;
+        }
+
+        File file = scanner->getFile();
+        if ( file.getFileExtension().toLowerCase() != ".syx" || size < 4096 )
+            continue;
+
+        changed |= processFile(file, modified.toMilliseconds());
+    }
+
+    if ( changed )
+        sendChangeMessage();
+
+    return 0;
+}
+
+bool CartLibrary::processFile(const File &file, int64 modified) {
+    String path = file.getFullPathName();
+
+    {
+        const ScopedLock sl(lock);
+        Entry *entry = entryByPath[path];
+
+        if ( entry != nullptr && entry->modified == modified ) {
+            entry->seen = true;
+            return false;
+        }
+    }
+
+    // new or modified cartridge, this is the only place where files are parsed
+    Cartridge cart;
+    ScopedPointer<Entry> parsed = new Entry();
+
+    parsed->path = path;
+    parsed->modified = modified;
+    parsed->numVoices = 0;
+    parsed->seen = true;
+
+    int rc = cart.load(file);
+
+    // rc == 2 is random data, it is remembered so it isn't parsed again
+    if ( rc == 0 || rc == 1 ) {
+        StringArray names;
+        cart.getProgramNames(names);
+
+        for (int i = 0; i < 32; i++) {
+            uint8_t unpackPgm[161];
+            cart.unpackProgram(unpackPgm, i);
+            parsed->names[i] = names[i];
+            parsed->hashes[i] = hashProgram(unpackPgm);
+        }
+        parsed->numVoices = 32;
+    }
+
+    const ScopedLock sl(lock);
+    Entry *entry = entryByPath[path];
+
+    if ( entry == nullptr ) {
+        entry = entries.add(parsed.release());
+        entryByPath.set(path, entry);
+    } else {
+        *entry = *parsed;
+    }
+    dirty = true;
+
+    return true;
+}
+
+void CartLibrary::endScan() {
+    scanner = nullptr;
+
+    {
+        const ScopedLock sl(lock);
+
+        // files that went away
+        for (int i = entries.size(); --i >= 0;) {
+            if ( ! entries[i]->seen ) {
+                entryByPath.remove(entries[i]->path);
+                entries.remove(i);
+                dirty = true;
+            }
+        }
+    }
+
+    if ( dirty )
+        save();
+
+    state = IDLE;
+    scanning = 0;
+    sendChangeMessage();
+}
+
+void CartLibrary::load() {
+    FileInputStream fis(indexFile);
+
+    if ( fis.failedToOpen() )
+        return;
+
+    if ( fis.readInt() != INDEX_MAGIC || fis.readInt() != INDEX_VERSION ) {
+        TRACE("cartridge index has an unknown format, rebuilding it");
+        return;
+    }
+
+    int numEntries = fis.readInt();
+    OwnedArray<Entry> loaded;
+
+    for (int i = 0; i < numEntries; i++) {
+        Entry *entry = loaded.add(new Entry());
+
+        entry->path = fis.readString();
+        entry->modified = fis.readInt64();
+        entry->numVoices = fis.readInt();
+        entry->seen = false;
+
+        if ( entry->numVoices != 0 && entry->numVoices != 32 ) {
+            TRACE("cartridge index is corrupted, rebuilding it");
+            return;
+        }
+
+        for (int j = 0; j < entry->numVoices; j++) {
+            entry->names[j] = fis.readString();
+            entry->hashes[j] = fis.readInt64();
+        }
+
+        if ( fis.isExhausted() && i != numEntries - 1 ) {
+            TRACE("cartridge index is truncated, rebuilding it");
+            return;
+        }
+    }
+
+    const ScopedLock sl(lock);
+    entries.swapWith(loaded);
+    entryByPath.clear();
+    for (int i = 0; i < entries.size(); i++)
+        entryByPath.set(entries[i]->path, entries[i]);
+}
+
+void CartLibrary::save() {
+    TemporaryFile temp(indexFile);
+
+    {
+        FileOutputStream fos(temp.getFile());
+
+        if ( fos.failedToOpen() ) {
+            TRACE("unable to write the cartridge index");
+            return;
+        }
+
+        const ScopedLock sl(lock);
+
+        fos.writeInt(INDEX_MAGIC);
+        fos.writeInt(INDEX_VERSION);
+        fos.writeInt(entries.size());
+
+        for (int i = 0; i < entries.size(); i++) {
+            const Entry *entry = entries[i];
+
+            fos.writeString(entry->path);
+            fos.writeInt64(entry->modified);
+            fos.writeInt(entry->numVoices);
+            for (int j = 0; j < entry->numVoices; j++) {
+                fos.writeString(entry->names[j]);
+                fos.writeInt64(entry->hashes[j]);
+            }
+        }
+        dirty = false;
+    }
+
+    temp.overwriteTargetFileWithTemporary();
+}
@@ -0,0 +1,108 @@
+/**
+ *
+ * Copyright (c) 2015 Pascal Gauthier.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+ *
+ */
+
+#ifndef CARTLIBRARY_H_INCLUDED
+#define CARTLIBRARY_H_INCLUDED
+
+#include "JuceHeader.h"
+#include "PluginData.h"
+
+/**
+ * Index of every voice found in the cartridge directory.
+ *
+ * The index is kept on disk and brought up to date on a TimeSliceThread: a
+ * cartridge is only parsed again when its modification time changed, so
+ * opening a large library only costs a directory walk. Searching runs on the
+ * in-memory index and never touches the files.
+ */
+class CartLibrary : public TimeSliceClient, public ChangeBroadcaster {
+public:
+    struct Result {
+        String name;
+        File file;
+        int program;
+        // how many other matching voices have the same parameters
+        int duplicates;
+    };
+
+    CartLibrary(const File &cartDir, const File &indexFile);
+
+    /**
+     * Saves what was indexed so far, remove it from the thread first
+     */
+    ~CartLibrary();
+
+    /**
+     * Walks the cartridge directory again, called from any thread
+     */
+    void rescan();
+    bool isScanning() const;
+    int getNumVoices() const;
+
+    /**
+     * Finds the voices whose name contains text, voices with identical
+     * parameters are returned once
+     */
+    void search(const String &text, Array<Result> &results, int maxResults) const;
+
+    int useTimeSlice() override;
+
+    /**
+     * Hash of a voice parameters, the name is not included
+     */
+    static int64 hashProgram(const uint8_t *unpackPgm);
+
+private:
+    struct Entry {
+        String path;
+        int64 modified;
+        // 0 if the file is not a cartridge
+        int numVoices;
+        String names[32];
+        int64 hashes[32];
+        bool seen;
+    };
+
+    enum State {
+        LOAD,
+        SCAN,
+        IDLE
+    };
+
+    File cartDir;
+    File indexFile;
+
+    CriticalSection lock;
+    OwnedArray<Entry> entries;
+    HashMap<String, Entry *> entryByPath;
+    bool dirty;
+
+    State state;
+    Atomic<int> scanning;
+    Atomic<int> rescanPending;
+    ScopedPointer<DirectoryIterator> scanner;
+
+    void load();
+    void save();
+    bool processFile(const File &file, int64 modified);
+    void endScan();
+};
+
+#endif  // CARTLIBRARY_H_INCLUDED
@@ -94,9 +94,23 @@ CartManager::CartManager(DexedAudioProcessorEditor *editor) : Component("CartMan
     cartBrowser->addKeyListener(this);
     addAndMakeVisible(cartBrowser);
     
-    cartBrowser->setBounds(23, 18, 590, 384);
+    cartBrowser->setBounds(23, 46, 590, 356);
     cartBrowser->setDragAndDropDescription("Sysex Browser");
     cartBrowser->addListener(this);
+    
+    library = new CartLibrary(cartDir, DexedAudioProcessor::dexedAppDir.getChildFile("Dexed_library.idx"));
+    library->addChangeListener(this);
+    timeSliceThread->addTimeSliceClient(library);
+    
+    addAndMakeVisible(searchBox = new TextEditor("search"));
+    searchBox->setBounds(23, 18, 590, 24);
+    searchBox->setTextToShowWhenEmpty("search the library", Colours::grey);
+    searchBox->addListener(this);
+    
+    addChildComponent(searchResults = new ListBox("searchResults", this));
+    searchResults->setBounds(23, 46, 590, 356);
+    searchResults->setRowHeight(18);
+    searchResults->setColour(ListBox::backgroundColourId, DXLookNFeel::background);
             
     addAndMakeVisible(closeButton = new TextButton("CLOSE"));
     closeButton->setBounds(4, 545, 50, 30);
@@ -129,6 +143,9 @@ CartManager::CartManager(DexedAudioProcessorEditor *editor) : Component("CartMan
 }
 
 CartManager::~CartManager() {
+    timeSliceThread->removeTimeSliceClient(library);
+    library->removeChangeListener(this);
+    library = nullptr;
     timeSliceThread->stopThread(500);
     delete cartBrowser;
     delete cartBrowserList;
@@ -141,6 +158,13 @@ void CartManager::paint(Graphics &g) {
     g.fillRoundedRectangle(8, 418, 843, 126, 15);
     g.setColour(Colours::whitesmoke);
     g.drawText("currently loaded cartridge", 38, 410, 150, 40, Justification::left);
+    
+    String status;
+    status << library->getNumVoices() << " voices in library";
+    if ( library->isScanning() )
+        status << ", indexing...";
+    g.setFont(11);
+    g.drawText(status, 23, 402, 590, 16, Justification::right);
 }
 
 void CartManager::programSelected(ProgramListBox *source, int pos) {
@@ -232,6 +256,7 @@ void CartManager::fileClicked(const File& file, const MouseEvent& e) {
             break;
         case 1020:
             cartBrowserList->refresh();
+            library->rescan();
             break;
         }
         return;
@@ -328,10 +353,13 @@ void CartManager::programDragged(ProgramListBox *destListBox, int dest, char *pa
         memcpy(cart.getRawVoice()+(dest*128), packedPgm, 128);
         cart.saveVoice(file);
         browserCart->setCartridge(cart);
+        library->rescan();
     }
 }
 
 void CartManager::initialFocus() {
+    // cheap when nothing changed, only the modification times are compared
+    library->rescan();
     cartBrowser->grabKeyboardFocus();
 }
 
@@ -353,6 +381,80 @@ void CartManager::showSysexConfigMsg() {
             "In order to use this correctly, you need to connect your midi in and midi out of your DX7 to a midi interface and configure this midi interface with the [PARM] dialog. THIS ONLY WORKS ON A DX7-II");
 }
 
+void CartManager::textEditorTextChanged(TextEditor &editor) {
+    updateSearch();
+}
+
+void CartManager::changeListenerCallback(ChangeBroadcaster *source) {
+    if ( searchResults->isVisible() )
+        updateSearch();
+    repaint(23, 402, 590, 16);
+}
+
+void CartManager::updateSearch() {
+    String text = searchBox->getText().trim();
+    
+    library->search(text, results, 1000);
+    searchResults->updateContent();
+    searchResults->repaint();
+    
+    searchResults->setVisible(text.isNotEmpty());
+    cartBrowser->setVisible(text.isEmpty());
+}
+
+int CartManager::getNumRows() {
+    return results.size();
+}
+
+void CartManager::paintListBoxItem(int rowNumber, Graphics &g, int width, int height, bool rowIsSelected) {
+    if ( rowNumber >= results.size() )
+        return;
+    
+    const CartLibrary::Result &result = results.getReference(rowNumber);
+    
+    if ( rowIsSelected )
+        g.fillAll(DXLookNFeel::fillColour);
+    
+    g.setColour(Colours::white);
+    g.setFont(height * 0.7f);
+    g.drawText(result.name, 4, 0, 100, height, Justification::left, true);
+    
+    String source;
+    source << result.file.getFileName() << " #" << (result.program + 1);
+    if ( result.duplicates > 0 )
+        source << "  (+" << result.duplicates << " identical)";
+    g.setColour(Colours::lightgrey);
+    g.drawText(source, 110, 0, width - 114, height, Justification::left, true);
+}
+
+bool CartManager::showResult(int row) {
+    if ( row < 0 || row >= results.size() )
+        return false;
+    
+    const CartLibrary::Result &result = results.getReference(row);
+    Cartridge browserSysex;
+    int rc = browserSysex.load(result.file);
+    if ( rc < 0 ) {
+        AlertWindow::showMessageBoxAsync (AlertWindow::WarningIcon, "Error", "Unable to open file");
+        library->rescan();
+        return false;
+    }
+    
+    browserCart->readOnly = rc != 0;
+    browserCart->setCartridge(browserSysex);
+    browserCart->setSelected(result.program);
+    return true;
+}
+
+void CartManager::listBoxItemClicked(int row, const MouseEvent &e) {
+    showResult(row);
+}
+
+void CartManager::listBoxItemDoubleClicked(int row, const MouseEvent &e) {
+    if ( showResult(row) )
+        programSelected(browserCart, results[row].program);
+}
+
 // unused stuff from FileBrowserListener
 void CartManager::browserRootChanged (const File& newRoot) {}
 
@@ -25,9 +25,10 @@
 #include "PluginData.h"
 #include "ProgramListBox.h"
 #include "PluginData.h"
+#include "CartLibrary.h"
 
 class CartManager  : public Component, public Button::Listener, public DragAndDropContainer, public FileBrowserListener
-    , public ProgramListBoxListener, public KeyListener {
+    , public ProgramListBoxListener, public KeyListener, public TextEditor::Listener, public ChangeListener, public ListBoxModel {
     ScopedPointer<TextButton> newButton;
     ScopedPointer<TextButton> loadButton;
     ScopedPointer<TextButton> saveButton;
@@ -44,6 +45,15 @@ class CartManager  : public Component, public Button::Listener, public DragAndDr
     FileTreeComponent *cartBrowser;
     TimeSliceThread *timeSliceThread;
     DirectoryContentsList *cartBrowserList;
+    
+    // the search box replaces the browser with the voices of the library that match
+    ScopedPointer<CartLibrary> library;
+    ScopedPointer<TextEditor> searchBox;
+    ScopedPointer<ListBox> searchResults;
+    Array<CartLibrary::Result> results;
+    
+    void updateSearch();
+    bool showResult(int row);
         
     File cartDir;
     
@@ -69,6 +79,14 @@ public:
     virtual void programRightClicked(ProgramListBox *source, int pos) override;
     virtual void programDragged(ProgramListBox *destListBox, int dest, char *packedPgm) override;
     virtual bool keyPressed(const KeyPress& key, Component* originatingComponent) override;
+    
+    void textEditorTextChanged(TextEditor &editor) override;
+    void changeListenerCallback(ChangeBroadcaster *source) override;
+    
+    int getNumRows() override;
+    void paintListBoxItem(int rowNumber, Graphics &g, int width, int height, bool rowIsSelected) override;
+    void listBoxItemClicked(int row, const MouseEvent &e) override;
+    void listBoxItemDoubleClicked(int row, const MouseEvent &e) override;
         
     void initialFocus();
 };
@@ -644,8 +644,28 @@ void GlobalEditor::mouseDown(const MouseEvent &e) {
     if ( e.mods.isRightButtonDown() || e.mods.isAnyModifierKeyDown() ) {
         PopupMenu popup;
         popup.addItem(1, "Send current program to DX7");
-        if ( popup.show() == 1 )
-           processor->sendCurrentSysexProgram();
+        popup.addSeparator();
+        popup.addItem(2, "Multi-timbral mode", true, processor->isMultiMode());
+
+        PopupMenu parts;
+        for(int i=0;i<processor->getNumParts();i++)
+            parts.addItem(100 + i, "Part " + String(i + 1), true, processor->getEditPart() == i);
+        popup.addSubMenu("Edit part", parts, processor->isMultiMode());
+
+        int result = popup.show();
+        switch(result) {
+        case 1:
+            processor->sendCurrentSysexProgram();
+            break;
+        case 2:
+            processor->setMultiMode(!processor->isMultiMode());
+            processor->updateUI();
+            break;
+        default:
+            if ( result >= 100 )
+                processor->setEditPart(result - 100);
+            break;
+        }
     }
 }
 //[/MiscUserCode]
@@ -188,7 +188,7 @@ void DexedAudioProcessor::unpackOpSwitch(char packOpValue) {
 int DexedAudioProcessor::updateProgramFromSysex(const uint8_t *rawdata) {
     memcpy(data, rawdata, 155);
     unpackOpSwitch(0x3F);
-    lfo.reset(data + 137);
+    parts[editPart].lfo.reset(data + 137);
     triggerAsyncUpdate();
     if (sysexChecksum(rawdata, 155) != rawdata[155]) // rawdata[155] is a checksum in a sysex dump
         return 1; // just return 1 if the checksum doesn't match, might be normal if it is loaded from a cartridge
@@ -315,6 +315,8 @@ void DexedAudioProcessor::getStateInformation(MemoryBlock& destData) {
     dexedState.setAttribute("gain", fx.uiGain);
     dexedState.setAttribute("currentProgram", currentProgram);
     dexedState.setAttribute("monoMode", monoMode);
+    dexedState.setAttribute("multiMode", multiMode);
+    dexedState.setAttribute("editPart", editPart);
     dexedState.setAttribute("engineType", (int) engineType);
     dexedState.setAttribute("masterTune", controllers.masterTune);
     //TRACE("saving opswitch %s", controllers.opSwitch);
@@ -337,6 +339,16 @@ void DexedAudioProcessor::getStateInformation(MemoryBlock& destData) {
     blobSet.set("sysex", var((void *) currentCart.getVoiceSysex(), 4104));
     blobSet.set("program", var((void *) &data, 161));
     
+    // multi-timbral parts, the edited one is also in "program"
+    MemoryBlock partsBlob(MAX_PARTS * 161);
+    StringArray partPrograms;
+    for (int part = 0; part < MAX_PARTS; part++) {
+        partsBlob.copyFrom(getPartData(part), part * 161, 161);
+        partPrograms.add(String(part == editPart ? currentProgram : parts[part].program));
+    }
+    blobSet.set("parts", var(partsBlob));
+    dexedState.setAttribute("partPrograms", partPrograms.joinIntoString(","));
+
     blobSet.copyToXmlAttributes(*dexedBlob);
     
     copyXmlToBinary(dexedState, destData);
@@ -376,6 +388,8 @@ void DexedAudioProcessor::setStateInformation(const void* source, int sizeInByte
     
     setEngineType(root->getIntAttribute("engineType", 1));
     monoMode = root->getIntAttribute("monoMode", 0);
+    setMultiMode(root->getIntAttribute("multiMode", 0) != 0);
+    editPart = jlimit(0, MAX_PARTS - 1, root->getIntAttribute("editPart", 0));
     controllers.masterTune = root->getIntAttribute("masterTune", 0);
     
     File possibleCartridge = File(root->getStringAttribute("activeFileCartridge"));
@@ -404,6 +418,22 @@ void DexedAudioProcessor::setStateInformation(const void* source, int sizeInByte
     loadCartridge(cart);
     memcpy(data, program.getBinaryData()->getData(), 161);
 
+    // states saved before the multi-timbral mode have every part on the current program
+    var parts_blob = blobSet["parts"];
+    StringArray partPrograms;
+    partPrograms.addTokens(root->getStringAttribute("partPrograms"), ",", "");
+    for (int part = 0; part < MAX_PARTS; part++) {
+        if ( part == editPart )
+            continue;
+        if ( parts_blob.isBinaryData() && parts_blob.getBinaryData()->getSize() == MAX_PARTS * 161 )
+            parts_blob.getBinaryData()->copyTo(parts[part].data, part * 161, 161);
+        else
+            memcpy(parts[part].data, data, 161);
+        parts[part].program = part < partPrograms.size() ? partPrograms[part].getIntValue() : currentProgram;
+        parts[part].lfo.reset(parts[part].data + 137);
+    }
+    parts[editPart].lfo.reset(data + 137);
+
     lastStateSave = (long) time(NULL);    
     TRACE("setting VST STATE");
     updateUI();
@@ -214,6 +214,15 @@ void DexedAudioProcessorEditor::updateUI() {
     }
     rebuildProgramCombobox();
     global.updateDisplay();
+
+    // the on-screen keyboard plays and shows the edited part
+    if ( processor->isMultiMode() ) {
+        midiKeyboard.setMidiChannel(processor->getEditPart() + 1);
+        midiKeyboard.setMidiChannelsToDisplay(1 << processor->getEditPart());
+    } else {
+        midiKeyboard.setMidiChannel(1);
+        midiKeyboard.setMidiChannelsToDisplay(0xffff);
+    }
 }
 
 void DexedAudioProcessorEditor::rebuildProgramCombobox() {
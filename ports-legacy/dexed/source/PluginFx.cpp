@@ -44,6 +44,20 @@ inline static float tptlpupw(float & state , float inp , float cutoff , float sr
 	return res;
 }
 
+// same as tptpc, with the coefficient cutoff/(1+cutoff) already computed
+inline static float tptpcc(float& state, float inp, float coef) {
+	float v = (inp - state) * coef;
+	float res = v + state;
+	state = res + v;
+	return res;
+}
+
+// rational tan, 1e-5 relative error up to 1.5 rad; the cutoff warping doesn't need more
+inline static float tanApprox(float x) {
+    float x2 = x * x;
+    return x * (945 + x2 * (-105 + x2)) / (945 + x2 * (-420 + x2 * 15));
+}
+
 static float linsc(float param,const float min,const float max) {
     return (param) * (max - min) + min;
 }
@@ -73,6 +87,10 @@ void PluginFx::init(int sr) {
     rcor24Inv = 1 / rcor24;
     
     bright = tan((sampleRate*0.5f-10) * juce::float_Pi * sampleRateInv);
+    brightc = bright / (1 + bright);
+    
+    float hpCutoff = 15 * sampleRateInv * juce::float_Pi;
+    hpc = hpCutoff / (1 + hpCutoff);
     
     R = 1;
 	rcor = (480.0 / 44000)*rcrate;
@@ -81,6 +99,8 @@ void PluginFx::init(int sr) {
 
     pCutoff = -1;
     pReso = -1;
+    sCutoff = -1;
+    sR24 = 0;
     
     dc_r = 1.0-(126.0/sr);
     dc_id = 0;
@@ -88,7 +108,8 @@ void PluginFx::init(int sr) {
 }
 
 inline float PluginFx::NR24(float sample,float g,float lpc) {
-    float ml = 1 / (1+g);
+    // lpc = g/(1+g), so 1/(1+g) = 1 - lpc
+    float ml = 1 - lpc;
     float S = (lpc*(lpc*(lpc*s1 + s2) + s3) +s4)*ml;
     float G = lpc*lpc*lpc*lpc;
     float y = (sample - R24 * S) / (1 + R24*G);
@@ -113,52 +134,66 @@ void PluginFx::process(float *work, int sampleSize) {
     }
     dc_od = work[sampleSize-1];
     
-    if ( uiGain != 1 ) {
-        for(int i=0; i < sampleSize; i++ )
-            work[i] *= uiGain;
-    }
+    if ( uiGain != 1 )
+        FloatVectorOperations::multiply(work, uiGain, sampleSize);
     
     // don't apply the LPF if the cutoff is to maximum
-    if ( uiCutoff == 1 )
+    if ( uiCutoff == 1 ) {
+        sCutoff = -1;
         return;
+    }
     
     if ( uiCutoff != pCutoff || uiReso != pReso ) {
         rReso = (0.991-logsc(1-uiReso,0,0.991));
-        R24 = 3.5 * rReso;
         
         float cutoffNorm = logsc(uiCutoff,60,19000);
-        rCutoff = (float)tan(cutoffNorm * sampleRateInv * juce::float_Pi);
+        rCutoff = tanApprox(jmin(cutoffNorm * sampleRateInv * juce::float_Pi, 1.5f));
             
         pCutoff = uiCutoff;
         pReso = uiReso;
         
         R = 1 - rReso;
     }
+    
+    if ( sCutoff < 0 ) {
+        sCutoff = rCutoff;
+        sR24 = 3.5 * rReso;
+    }
         
     // THIS IS MY FAVORITE 4POLE OBXd filter
-        
-    // maybe smooth this value
-    float g = rCutoff;
-    float lpc = g / (1 + g);
+    
+    // the coefficients move linearly from where the last block left them
+    float g = sCutoff;
+    float gInc = (rCutoff - sCutoff) / sampleSize;
+    float res24 = sR24;
+    float res24Inc = (3.5f * rReso - sR24) / sampleSize;
     
     for(int i=0; i < sampleSize; i++ ) {
+        g += gInc;
+        res24 += res24Inc;
+        R24 = res24;
+        float lpc = g / (1 + g);
+        
         float s = work[i];
-        s = s - 0.45*tptlpupw(c,s,15,sampleRateInv);
-        s = tptpc(d,s,bright);
+        s = s - 0.45f*tptpcc(c,s,hpc);
+        s = tptpcc(d,s,brightc);
         
         float y0 = NR24(s,g,lpc);
         
         //first low pass in cascade
-        double v = (y0 - s1) * lpc;
-        double res = v + s1;
+        float v = (y0 - s1) * lpc;
+        float res = v + s1;
         s1 = res + v;
         
         //damping
-        s1 =atan(s1*rcor24)*rcor24Inv;
-        float y1= res;
-        float y2 = tptpc(s2,y1,g);
-        float y3 = tptpc(s3,y2,g);
-        float y4 = tptpc(s4,y3,g);
+        s1 = atanf(s1*rcor24)*rcor24Inv;
+        
+        // the stages depend on each other within the sample, the ladder
+        // can't be spread across vector lanes
+        float y1 = res;
+        float y2 = tptpcc(s2,y1,lpc);
+        float y3 = tptpcc(s3,y2,lpc);
+        float y4 = tptpcc(s4,y3,lpc);
         float mc = 0.0f;
     
         switch(mmch) {
@@ -177,8 +212,11 @@ void PluginFx::process(float *work, int sampleSize) {
         }
         
         //half volume comp
-        work[i] = mc * (1 + R24 * 0.45);
+        work[i] = mc * (1 + R24 * 0.45f);
     }
+    
+    sCutoff = rCutoff;
+    sR24 = 3.5f * rReso;
 }
 
 /*
@@ -32,6 +32,10 @@ class PluginFx {
 	float rcor24,rcor24Inv;
     float bright;
     
+    // one pole coefficients g/(1+g) of the input conditioning, they don't move
+    float hpc;
+    float brightc;
+    
 	// 24 db multimode
     float mm;
 	float mmt;
@@ -43,6 +47,11 @@ class PluginFx {
     float rReso;
     float rGain;
     
+    // coefficients the filter is at, they ramp to rCutoff and 3.5*rReso
+    // over each block to avoid zipper noise; -1 means jump to the target
+    float sCutoff;
+    float sR24;
+    
     // thread values; if these are different from the UI,
     // it needs to be recalculated.
     float pReso;
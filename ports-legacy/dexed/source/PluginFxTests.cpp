@@ -0,0 +1,233 @@
+/**
+ *
+ * Copyright (c) 2013-2018 Pascal Gauthier.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301  USA
+ *
+ */
+
+#if JUCE_UNIT_TESTS
+
+#define _USE_MATH_DEFINES
+#include <math.h>
+#include "PluginFx.h"
+
+namespace {
+
+/**
+ * The 4 pole filter as it was before the coefficients were ramped, with tan()
+ * and the coefficients recomputed on every cutoff change. It is only here to
+ * check that the response of PluginFx didn't move.
+ */
+class ReferenceFx {
+    float s1, s2, s3, s4;
+    float sampleRateInv;
+    float d, c;
+    float R24;
+    float rcor24, rcor24Inv;
+    float bright;
+    float rCutoff, rReso;
+    float pCutoff, pReso;
+    float dc_id, dc_od, dc_r;
+
+    static float tptpc(float &state, float inp, float cutoff) {
+        double v = (inp - state) * cutoff / (1 + cutoff);
+        double res = v + state;
+        state = res + v;
+        return res;
+    }
+
+    static float logsc(float param, const float min, const float max, const float rolloff = 19.0f) {
+        return ((expf(param * logf(rolloff+1)) - 1.0f) / (rolloff)) * (max-min) + min;
+    }
+
+public:
+    float uiCutoff;
+    float uiReso;
+
+    void init(int sr) {
+        s1 = s2 = s3 = s4 = c = d = 0;
+        R24 = 0;
+        rCutoff = rReso = 0;
+        float sampleRate = sr;
+        sampleRateInv = 1 / sampleRate;
+        float rcrate = sqrt((44000 / sampleRate));
+        rcor24 = (970.0 / 44000) * rcrate;
+        rcor24Inv = 1 / rcor24;
+        bright = tan((sampleRate*0.5f-10) * juce::float_Pi * sampleRateInv);
+        pCutoff = -1;
+        pReso = -1;
+        dc_r = 1.0-(126.0/sr);
+        dc_id = 0;
+        dc_od = 0;
+        uiCutoff = 1;
+        uiReso = 0;
+    }
+
+    void process(float *work, int sampleSize) {
+        float t_fd = work[0];
+        work[0] = work[0] - dc_id + dc_r * dc_od;
+        dc_id = t_fd;
+        for (int i=1; i<sampleSize; i++) {
+            t_fd = work[i];
+            work[i] = work[i] - dc_id + dc_r * work[i-1];
+            dc_id = t_fd;
+        }
+        dc_od = work[sampleSize-1];
+
+        if ( uiCutoff == 1 )
+            return;
+
+        if ( uiCutoff != pCutoff || uiReso != pReso ) {
+            rReso = (0.991-logsc(1-uiReso,0,0.991));
+            R24 = 3.5 * rReso;
+            float cutoffNorm = logsc(uiCutoff,60,19000);
+            rCutoff = (float)tan(cutoffNorm * sampleRateInv * juce::float_Pi);
+            pCutoff = uiCutoff;
+            pReso = uiReso;
+        }
+
+        float g = rCutoff;
+        float lpc = g / (1 + g);
+
+        for(int i=0; i < sampleSize; i++ ) {
+            float s = work[i];
+            float hp = (15 * sampleRateInv) * juce::float_Pi;
+            s = s - 0.45*tptpc(c,s,hp);
+            s = tptpc(d,s,bright);
+
+            float ml = 1 / (1+g);
+            float S = (lpc*(lpc*(lpc*s1 + s2) + s3) +s4)*ml;
+            float G = lpc*lpc*lpc*lpc;
+            float y0 = (s - R24 * S) / (1 + R24*G) + 1e-8;
+
+            double v = (y0 - s1) * lpc;
+            double res = v + s1;
+            s1 = res + v;
+            s1 = atan(s1*rcor24)*rcor24Inv;
+
+            float y1 = res;
+            float y2 = tptpc(s2,y1,g);
+            float y3 = tptpc(s3,y2,g);
+            float y4 = tptpc(s4,y3,g);
+
+            work[i] = y4 * (1 + R24 * 0.45);
+        }
+    }
+};
+
+}
+
+class PluginFxTests : public UnitTest {
+public:
+    PluginFxTests() : UnitTest("Dexed PluginFx") {}
+
+    void runTest() {
+        beginTest("Frequency response matches the reference filter");
+
+        const float cutoffs[] = { 0.2f, 0.5f, 0.8f, 0.95f };
+        const float resos[] = { 0.0f, 0.5f, 0.9f };
+        const float freqs[] = { 50, 200, 1000, 4000, 12000 };
+
+        for (int ci = 0; ci < numElementsInArray(cutoffs); ci++) {
+            for (int ri = 0; ri < numElementsInArray(resos); ri++) {
+                for (int fi = 0; fi < numElementsInArray(freqs); fi++) {
+                    float expected = referenceGain(cutoffs[ci], resos[ri], freqs[fi]);
+                    float actual = pluginFxGain(cutoffs[ci], resos[ri], freqs[fi]);
+
+                    // the responses differ by the float rounding and the tan approximation only
+                    expect(std::abs(actual - expected) < 0.1f,
+                           String::formatted("cutoff %.2f reso %.2f at %.0f Hz: %.2f dB, expected %.2f dB",
+                                             cutoffs[ci], resos[ri], freqs[fi], actual, expected));
+                }
+            }
+        }
+
+        beginTest("Cutoff sweeps stay bounded");
+
+        PluginFx fx;
+        fx.init(sampleRate);
+        fx.uiReso = 0.9f;
+
+        HeapBlock<float> block(blockSize);
+        int phase = 0;
+        float peak = 0;
+
+        for (int b = 0; b < 400; b++) {
+            fx.uiCutoff = 0.05f + 0.9f * (b % 100) / 100.0f;
+            fillSine(block, blockSize, 440, phase);
+            fx.process(block, blockSize);
+            peak = jmax(peak, FloatVectorOperations::findMaximum(block, blockSize),
+                        -FloatVectorOperations::findMinimum(block, blockSize));
+        }
+
+        expect(peak < 4.0f, "peak " + String(peak));
+    }
+
+private:
+    static const int sampleRate = 44100;
+    static const int blockSize = 256;
+
+    static void fillSine(float *dest, int size, float freq, int &phase) {
+        for (int i = 0; i < size; i++, phase++)
+            dest[i] = 0.25f * std::sin(2 * double_Pi * freq * phase / sampleRate);
+    }
+
+    template <class Filter>
+    static float measureGain(Filter &filter, float freq) {
+        HeapBlock<float> block(blockSize);
+        int phase = 0;
+        double in = 0, out = 0;
+
+        // half a second to settle, then a quarter to measure
+        for (int b = 0; b < (sampleRate * 3 / 4) / blockSize; b++) {
+            bool measure = b >= (sampleRate / 2) / blockSize;
+
+            fillSine(block, blockSize, freq, phase);
+            if ( measure ) {
+                for (int i = 0; i < blockSize; i++)
+                    in += block[i] * block[i];
+            }
+
+            filter.process(block, blockSize);
+            if ( measure ) {
+                for (int i = 0; i < blockSize; i++)
+                    out += block[i] * block[i];
+            }
+        }
+
+        return 10 * log10(out / in);
+    }
+
+    static float referenceGain(float cutoff, float reso, float freq) {
+        ReferenceFx fx;
+        fx.init(sampleRate);
+        fx.uiCutoff = cutoff;
+        fx.uiReso = reso;
+        return measureGain(fx, freq);
+    }
+
+    static float pluginFxGain(float cutoff, float reso, float freq) {
+        PluginFx fx;
+        fx.init(sampleRate);
+        fx.uiCutoff = cutoff;
+        fx.uiReso = reso;
+        return measureGain(fx, freq);
+    }
+};
+
+static PluginFxTests pluginFxTests;
+
+#endif
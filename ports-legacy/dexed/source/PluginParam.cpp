@@ -600,8 +600,12 @@ void DexedAudioProcessor::setDxValue(int offset, int v) {
     refreshVoice = true;
 
     // MIDDLE C (transpose)
-    if (offset == 144)
-        panic();
+    if (offset == 144) {
+        if ( multiMode )
+            panicPart(editPart);
+        else
+            panic();
+    }
     
     if (!sendSysexChange)
         return;
@@ -652,12 +656,16 @@ void DexedAudioProcessor::setCurrentProgram(int index) {
         return;
     }
     
-    panic();
+    // in multi-timbral mode the other parts keep playing
+    if ( multiMode )
+        panicPart(editPart);
+    else
+        panic();
     
     index = index > 31 ? 31 : index;
     currentCart.unpackProgram(data, index);
     unpackOpSwitch(0x3F);
-    lfo.reset(data + 137);
+    parts[editPart].lfo.reset(data + 137);
     currentProgram = index;
     triggerAsyncUpdate();
     
@@ -668,7 +676,24 @@ void DexedAudioProcessor::setCurrentProgram(int index) {
     }
     editor->global.setParamMessage("");
     
-    panic();
+    if ( multiMode )
+        panicPart(editPart);
+    else
+        panic();
+}
+
+void DexedAudioProcessor::setPartProgram(int part, int index) {
+    if ( part == editPart ) {
+        setCurrentProgram(index);
+        return;
+    }
+
+    panicPart(part);
+
+    index = index > 31 ? 31 : index;
+    currentCart.unpackProgram(parts[part].data, index);
+    parts[part].lfo.reset(parts[part].data + 137);
+    parts[part].program = index;
 }
 
 const String DexedAudioProcessor::getProgramName(int index) {
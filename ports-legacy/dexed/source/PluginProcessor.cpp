@@ -84,6 +84,8 @@ DexedAudioProcessor::DexedAudioProcessor() {
     
     vuSignal = 0;
     monoMode = 0;
+    multiMode = false;
+    editPart = 0;
     
     resolvAppDir();
     
@@ -104,8 +106,14 @@ DexedAudioProcessor::DexedAudioProcessor() {
 
     for (int note = 0; note < MAX_ACTIVE_NOTES; ++note) {
         voices[note].dx7_note = NULL;
+        voices[note].part = 0;
     }
     setCurrentProgram(0);    
+    for (int part = 0; part < MAX_PARTS; ++part) {
+        memcpy(parts[part].data, data, 161);
+        parts[part].program = currentProgram;
+        resetPartControllers(part);
+    }
     nextMidi = NULL;
     midiMsg = NULL;
 
@@ -129,8 +137,9 @@ void DexedAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     Env::init_sr(sampleRate);
     fx.init(sampleRate);
     
+    // the voices past the single mode ones only get a note in multi mode, see setMultiMode
     for (int note = 0; note < MAX_ACTIVE_NOTES; ++note) {
-        voices[note].dx7_note = new Dx7Note;
+        voices[note].dx7_note = note < getNumVoices() ? new Dx7Note : NULL;
         voices[note].keydown = false;
         voices[note].sustained = false;
         voices[note].live = false;
@@ -144,13 +153,15 @@ void DexedAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     controllers.aftertouch_cc = 0;
 	controllers.refresh(); 
 
-    sustain = false;
+    for (int part = 0; part < MAX_PARTS; ++part) {
+        resetPartControllers(part);
+        parts[part].lfo.reset(getPartData(part) + 137);
+    }
+
     extra_buf_size = 0;
 
     keyboardState.reset();
     
-    lfo.reset(data + 137);
-    
     nextMidi = new MidiMessage(0xF0);
 	midiMsg = new MidiMessage(0xF0);
 }
@@ -185,13 +196,15 @@ void DexedAudioProcessor::processBlock(AudioSampleBuffer& buffer, MidiBuffer& mi
     
     if ( refreshVoice ) {
         for(i=0;i < MAX_ACTIVE_NOTES;i++) {
-            if ( voices[i].live )
+            if ( voices[i].live && voices[i].part == editPart )
                 voices[i].dx7_note->update(data, voices[i].midi_note, voices[i].velocity);
         }
-        lfo.reset(data + 137);
+        parts[editPart].lfo.reset(data + 137);
         refreshVoice = false;
     }
 
+    syncPartControllers();
+
     keyboardState.processNextMidiBuffer(midiMessages, 0, numSamples, true);
     
     MidiBuffer::Iterator it(midiMessages);
@@ -228,12 +241,17 @@ void DexedAudioProcessor::processBlock(AudioSampleBuffer& buffer, MidiBuffer& mi
                 audiobuf.get()[j] = 0;
                 sumbuf[j] = 0;
             }
-            int32_t lfovalue = lfo.getsample();
-            int32_t lfodelay = lfo.getdelay();
+            for (int part = 0; part < MAX_PARTS; ++part) {
+                if ( multiMode || part == editPart ) {
+                    parts[part].lfoValue = parts[part].lfo.getsample();
+                    parts[part].lfoDelay = parts[part].lfo.getdelay();
+                }
+            }
             
             for (int note = 0; note < MAX_ACTIVE_NOTES; ++note) {
                 if (voices[note].live) {
-                    voices[note].dx7_note->compute(audiobuf.get(), lfovalue, lfodelay, &controllers);
+                    DexedPart &part = parts[voices[note].part];
+                    voices[note].dx7_note->compute(audiobuf.get(), part.lfoValue, part.lfoDelay, &part.controllers);
                     
                     for (int j=0; j < N; ++j) {
                         int32_t val = audiobuf.get()[j];
@@ -243,7 +261,7 @@ void DexedAudioProcessor::processBlock(AudioSampleBuffer& buffer, MidiBuffer& mi
                         float f = ((float) clip_val) / (float) 0x8000;
                         if( f > 1 ) f = 1;
                         if( f < -1 ) f = -1;
-                        sumbuf[j] += f;
+                        sumbuf[j] += f * part.gain;
                         audiobuf.get()[j] = 0;
                     }
                 }
@@ -303,14 +321,16 @@ void DexedAudioProcessor::processMidiMessage(const MidiMessage *msg) {
     
     const uint8 *buf  = msg->getRawData();
     uint8_t cmd = buf[0];
+    int part = multiMode ? (cmd & 0x0f) : editPart;
+    Controllers &ctrls = parts[part].controllers;
 
     switch(cmd & 0xf0) {
         case 0x80 :
-            keyup(buf[1]);
+            keyup(part, buf[1]);
         return;
 
         case 0x90 :
-            keydown(buf[1], buf[2]);
+            keydown(part, buf[1], buf[2]);
         return;
             
         case 0xb0 : {
@@ -319,22 +339,27 @@ void DexedAudioProcessor::processMidiMessage(const MidiMessage *msg) {
             
             switch(ctrl) {
                 case 1:
-                    controllers.modwheel_cc = value;
-                    controllers.refresh();
+                    ctrls.modwheel_cc = value;
+                    ctrls.refresh();
                     break;
                 case 2:
-                    controllers.breath_cc = value;
-                    controllers.refresh();
+                    ctrls.breath_cc = value;
+                    ctrls.refresh();
                     break;
                 case 4:
-                    controllers.foot_cc = value;
-                    controllers.refresh();
+                    ctrls.foot_cc = value;
+                    ctrls.refresh();
+                    break;
+                case 7:
+                    // part level, the single mode keeps ignoring it
+                    if ( multiMode )
+                        parts[part].gain = (value * value) / (127.0f * 127.0f);
                     break;
                 case 64:
-                    sustain = value > 63;
-                    if (!sustain) {
+                    parts[part].sustain = value > 63;
+                    if (!parts[part].sustain) {
                         for (int note = 0; note < MAX_ACTIVE_NOTES; note++) {
-                            if (voices[note].sustained && !voices[note].keydown) {
+                            if (voices[note].part == part && voices[note].sustained && !voices[note].keydown) {
                                 voices[note].dx7_note->keyup();
                                 voices[note].sustained = false;
                             }
@@ -346,8 +371,8 @@ void DexedAudioProcessor::processMidiMessage(const MidiMessage *msg) {
                     break;
                 case 123:
                     for (int note = 0; note < MAX_ACTIVE_NOTES; note++) {
-                        if (voices[note].keydown)
-                            keyup(voices[note].midi_note);
+                        if (voices[note].part == part && voices[note].keydown)
+                            keyup(part, voices[note].midi_note);
                     }
                     break;
                 default:
@@ -357,56 +382,59 @@ void DexedAudioProcessor::processMidiMessage(const MidiMessage *msg) {
         return;
 
         case 0xc0 :
-            setCurrentProgram(buf[1]);
+            setPartProgram(part, buf[1]);
         return;
             
         // aftertouch
         case 0xd0 :
-            controllers.aftertouch_cc = buf[1];
-            controllers.refresh();
+            ctrls.aftertouch_cc = buf[1];
+            ctrls.refresh();
         return;
             
     }
 
     if ( cmd & 0xe0 ) {
-       controllers.values_[kControllerPitch] = buf[1] | (buf[2] << 7);
+       ctrls.values_[kControllerPitch] = buf[1] | (buf[2] << 7);
     }
 }
 
 #define ACT(v) (v.keydown ? v.midi_note : -1)
 
-void DexedAudioProcessor::keydown(uint8_t pitch, uint8_t velo) {
+void DexedAudioProcessor::keydown(int part, uint8_t pitch, uint8_t velo) {
     if ( velo == 0 ) {
-        keyup(pitch);
+        keyup(part, pitch);
         return;
     }
 
-    pitch += data[144] - 24;
+    uint8_t *patch = getPartData(part);
+    pitch += patch[144] - 24;
     
     if ( normalizeDxVelocity ) {
         velo = ((float)velo) * 0.7874015; // 100/127
     }
     
+    int numVoices = getNumVoices();
     int note = currentNote;
-    for (int i=0; i<MAX_ACTIVE_NOTES; i++) {
+    for (int i=0; i<numVoices; i++) {
         if (!voices[note].keydown) {
-            currentNote = (note + 1) % MAX_ACTIVE_NOTES;
-            lfo.keydown();  // TODO: should only do this if # keys down was 0
+            currentNote = (note + 1) % numVoices;
+            parts[part].lfo.keydown();  // TODO: should only do this if # keys down was 0
             voices[note].midi_note = pitch;
             voices[note].velocity = velo;
-            voices[note].sustained = sustain;
+            voices[note].part = part;
+            voices[note].sustained = parts[part].sustain;
             voices[note].keydown = true;
-            voices[note].dx7_note->init(data, pitch, velo);
-            if ( data[136] )
+            voices[note].dx7_note->init(patch, pitch, velo);
+            if ( patch[136] )
                 voices[note].dx7_note->oscSync();
             break;
         }
-        note = (note + 1) % MAX_ACTIVE_NOTES;
+        note = (note + 1) % numVoices;
     }
     
     if ( monoMode ) {
         for(int i=0; i<MAX_ACTIVE_NOTES; i++) {            
-            if ( voices[i].live ) {
+            if ( voices[i].live && voices[i].part == part ) {
                 // all keys are up, only transfert signal
                 if ( ! voices[i].keydown ) {
                     voices[i].live = false;
@@ -427,12 +455,12 @@ void DexedAudioProcessor::keydown(uint8_t pitch, uint8_t velo) {
 	//TRACE("activate %d [ %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d ]", pitch, ACT(voices[0]), ACT(voices[1]), ACT(voices[2]), ACT(voices[3]), ACT(voices[4]), ACT(voices[5]), ACT(voices[6]), ACT(voices[7]), ACT(voices[8]), ACT(voices[9]), ACT(voices[10]), ACT(voices[11]), ACT(voices[12]), ACT(voices[13]), ACT(voices[14]), ACT(voices[15]));
 }
 
-void DexedAudioProcessor::keyup(uint8_t pitch) {
-    pitch += data[144] - 24;
+void DexedAudioProcessor::keyup(int part, uint8_t pitch) {
+    pitch += getPartData(part)[144] - 24;
 
     int note;
     for (note=0; note<MAX_ACTIVE_NOTES; ++note) {
-        if ( voices[note].midi_note == pitch && voices[note].keydown ) {
+        if ( voices[note].midi_note == pitch && voices[note].keydown && voices[note].part == part ) {
             voices[note].keydown = false;
 			//TRACE("deactivate %d [ %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d %d ]", pitch, ACT(voices[0]), ACT(voices[1]), ACT(voices[2]), ACT(voices[3]), ACT(voices[4]), ACT(voices[5]), ACT(voices[6]), ACT(voices[7]), ACT(voices[8]), ACT(voices[9]), ACT(voices[10]), ACT(voices[11]), ACT(voices[12]), ACT(voices[13]), ACT(voices[14]), ACT(voices[15]));
             break;
@@ -449,7 +477,7 @@ void DexedAudioProcessor::keyup(uint8_t pitch) {
         int highNote = -1;
         int target = 0;
         for (int i=0; i<MAX_ACTIVE_NOTES;i++) {
-            if ( voices[i].keydown && voices[i].midi_note > highNote ) {
+            if ( voices[i].keydown && voices[i].part == part && voices[i].midi_note > highNote ) {
                 target = i;
                 highNote = voices[i].midi_note;
             }
@@ -462,7 +490,7 @@ void DexedAudioProcessor::keyup(uint8_t pitch) {
         }
     }
     
-    if ( sustain ) {
+    if ( parts[part].sustain ) {
         voices[note].sustained = true;
     } else {
         voices[note].dx7_note->keyup();
@@ -480,6 +508,18 @@ void DexedAudioProcessor::panic() {
     keyboardState.reset();
 }
 
+void DexedAudioProcessor::panicPart(int part) {
+    for(int i=0;i<MAX_ACTIVE_NOTES;i++) {
+        if ( voices[i].part != part )
+            continue;
+        voices[i].keydown = false;
+        voices[i].live = false;
+        if ( voices[i].dx7_note != NULL ) {
+            voices[i].dx7_note->oscSync();
+        }
+    }
+}
+
 void DexedAudioProcessor::handleIncomingMidiMessage(MidiInput* source, const MidiMessage& message) {
     if ( message.isActiveSense() ) 
         return;
@@ -582,6 +622,110 @@ void DexedAudioProcessor::setMonoMode(bool mode) {
     monoMode = mode;
 }
 
+void DexedAudioProcessor::setMultiMode(bool mode) {
+    // the notes of the multi mode voices are made and freed outside the audio lock
+    bool prepared = voices[0].dx7_note != NULL;
+    Dx7Note *added[MAX_ACTIVE_NOTES] = {};
+    Dx7Note *removed[MAX_ACTIVE_NOTES] = {};
+    if ( mode && prepared ) {
+        for (int note = SINGLE_ACTIVE_NOTES; note < MAX_ACTIVE_NOTES; ++note) {
+            if ( voices[note].dx7_note == NULL )
+                added[note] = new Dx7Note;
+        }
+    }
+
+    {
+        const ScopedLock sl(getCallbackLock());
+
+        panic();
+        if ( currentNote > 0 )
+            currentNote = 0;
+        multiMode = mode;
+
+        // part levels only apply in multi mode, start from unity either way
+        for (int part = 0; part < MAX_PARTS; ++part)
+            parts[part].gain = 1;
+
+        for (int note = SINGLE_ACTIVE_NOTES; note < MAX_ACTIVE_NOTES && prepared; ++note) {
+            if ( mode ) {
+                if ( added[note] != NULL )
+                    voices[note].dx7_note = added[note];
+            } else {
+                removed[note] = voices[note].dx7_note;
+                voices[note].dx7_note = NULL;
+                voices[note].sustained = false;
+            }
+        }
+    }
+
+    for (int note = SINGLE_ACTIVE_NOTES; note < MAX_ACTIVE_NOTES; ++note)
+        delete removed[note];
+}
+
+void DexedAudioProcessor::setEditPart(int part) {
+    if ( part == editPart || part < 0 || part >= MAX_PARTS )
+        return;
+
+    {
+        const ScopedLock sl(getCallbackLock());
+
+        // the patch of the edited part lives in data, where the controls and displays point to
+        memcpy(parts[editPart].data, data, 161);
+        parts[editPart].program = currentProgram;
+        memcpy(data, parts[part].data, 161);
+        currentProgram = parts[part].program;
+        editPart = part;
+        unpackOpSwitch(0x3F);
+    }
+
+    triggerAsyncUpdate();
+}
+
+static bool sameMod(const FmMod &a, const FmMod &b) {
+    return a.range == b.range && a.pitch == b.pitch && a.amp == b.amp && a.eg == b.eg;
+}
+
+void DexedAudioProcessor::syncPartControllers() {
+    for (int part = 0; part < MAX_PARTS; part++) {
+        Controllers &ctrls = parts[part].controllers;
+
+        ctrls.values_[kControllerPitchRange] = controllers.values_[kControllerPitchRange];
+        ctrls.values_[kControllerPitchStep] = controllers.values_[kControllerPitchStep];
+        ctrls.masterTune = controllers.masterTune;
+        ctrls.core = controllers.core;
+
+        // the operator switches are an edit aid, they only apply to the edited part
+        memcpy(ctrls.opSwitch, part == editPart ? controllers.opSwitch : "111111", 6);
+
+        if ( !sameMod(ctrls.wheel, controllers.wheel) || !sameMod(ctrls.foot, controllers.foot) ||
+             !sameMod(ctrls.breath, controllers.breath) || !sameMod(ctrls.at, controllers.at) ) {
+            ctrls.wheel = controllers.wheel;
+            ctrls.foot = controllers.foot;
+            ctrls.breath = controllers.breath;
+            ctrls.at = controllers.at;
+            ctrls.refresh();
+        }
+    }
+}
+
+void DexedAudioProcessor::resetPartControllers(int part) {
+    Controllers &ctrls = parts[part].controllers;
+
+    ctrls.values_[kControllerPitch] = 0x2000;
+    ctrls.modwheel_cc = 0;
+    ctrls.foot_cc = 0;
+    ctrls.breath_cc = 0;
+    ctrls.aftertouch_cc = 0;
+    ctrls.wheel = controllers.wheel;
+    ctrls.foot = controllers.foot;
+    ctrls.breath = controllers.breath;
+    ctrls.at = controllers.at;
+    ctrls.refresh();
+
+    parts[part].sustain = false;
+    parts[part].gain = 1;
+}
+
 // ====================================================================
 bool DexedAudioProcessor::peekVoiceStatus() {
     if ( currentNote == -1 )
@@ -590,7 +734,7 @@ bool DexedAudioProcessor::peekVoiceStatus() {
     // we are trying to find the last "keydown" note
     int note = currentNote;
     for (int i = 0; i < MAX_ACTIVE_NOTES; i++) {
-        if (voices[note].keydown) {
+        if (voices[note].keydown && voices[note].part == editPart) {
             voices[note].dx7_note->peekVoiceStatus(voiceStatus);
             return true;
         }
@@ -601,7 +745,7 @@ bool DexedAudioProcessor::peekVoiceStatus() {
     // not found; try a live note
     note = currentNote;
     for (int i = 0; i < MAX_ACTIVE_NOTES; i++) {
-        if (voices[note].live) {
+        if (voices[note].live && voices[note].part == editPart) {
             voices[note].dx7_note->peekVoiceStatus(voiceStatus);
             return true;
         }
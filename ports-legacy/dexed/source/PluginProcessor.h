@@ -38,12 +38,31 @@
 struct ProcessorVoice {
     int midi_note;
     int velocity;
+    int part;
     bool keydown;
     bool sustained;
     bool live;
     Dx7Note *dx7_note;
 };
 
+/**
+ * One timbre of the multi-timbral mode, played on its own MIDI channel. The
+ * part being edited keeps its patch in DexedAudioProcessor::data, the copy
+ * in here is only used once the part is not edited anymore.
+ */
+struct DexedPart {
+    uint8_t data[161];
+    int program;
+
+    // per channel midi state; the modulation setup is copied from the global controllers
+    Controllers controllers;
+    Lfo lfo;
+    int32_t lfoValue;
+    int32_t lfoDelay;
+    bool sustain;
+    float gain;
+};
+
 enum DexedEngineResolution {
     DEXED_ENGINE_MODERN,
     DEXED_ENGINE_MARKI,
@@ -55,14 +74,20 @@ enum DexedEngineResolution {
 */
 class DexedAudioProcessor  : public AudioProcessor, public AsyncUpdater, public MidiInputCallback
 {
-    static const int MAX_ACTIVE_NOTES = 16;
+    // The single mode keeps the 16 notes of the DX7, the parts of the
+    // multi-timbral mode share the whole pool.
+    static const int MAX_ACTIVE_NOTES = 64;
+    static const int SINGLE_ACTIVE_NOTES = 16;
+    static const int MAX_PARTS = 16;
     ProcessorVoice voices[MAX_ACTIVE_NOTES];
     int currentNote;
 
     // The original DX7 had one single LFO. Later units had an LFO per note.
-    Lfo lfo;
+    // Here every part has its own.
+    DexedPart parts[MAX_PARTS];
+    int editPart;
+    bool multiMode;
 
-    bool sustain;
     bool monoMode;
     
     // Extra buffering for when GetSamples wants a buffer not a multiple of N
@@ -90,8 +115,19 @@ class DexedAudioProcessor  : public AudioProcessor, public AsyncUpdater, public
     bool sendSysexChange;
     
     void processMidiMessage(const MidiMessage *msg);
-    void keydown(uint8_t pitch, uint8_t velo);
-    void keyup(uint8_t pitch);
+    void keydown(int part, uint8_t pitch, uint8_t velo);
+    void keyup(int part, uint8_t pitch);
+    void panicPart(int part);
+
+    uint8_t *getPartData(int part) {
+        return part == editPart ? data : parts[part].data;
+    }
+    int getNumVoices() {
+        return multiMode ? MAX_ACTIVE_NOTES : SINGLE_ACTIVE_NOTES;
+    }
+    void syncPartControllers();
+    void resetPartControllers(int part);
+    void setPartProgram(int part, int index);
     
     /**
      * this is called from the Audio thread to tell
@@ -175,6 +211,22 @@ public :
         return monoMode;
     }
     void setMonoMode(bool mode);
+
+    /**
+     * In multi-timbral mode MIDI channel n plays part n, all the parts render
+     * in the same voice pool. Otherwise every channel plays the edited part.
+     */
+    bool isMultiMode() {
+        return multiMode;
+    }
+    void setMultiMode(bool mode);
+    int getNumParts() {
+        return MAX_PARTS;
+    }
+    int getEditPart() {
+        return editPart;
+    }
+    void setEditPart(int part);
     
     void copyToClipboard(int srcOp);
     void pasteOpFromClipboard(int destOp);
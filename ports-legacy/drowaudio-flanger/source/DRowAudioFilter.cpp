@@ -45,9 +45,9 @@ AudioProcessor* JUCE_CALLTYPE createPluginFilter()
 
 //==============================================================================
 DRowAudioFilter::DRowAudioFilter()
-    : pfCircularBufferL(nullptr),
-      pfCircularBufferR(nullptr),
-      pfLookupTable(nullptr)
+    : iBufferSize(0),
+      iBufferWritePos(0),
+      lfoPhase(0.0)
 {
     setupParams();
 
@@ -278,33 +278,12 @@ void DRowAudioFilter::prepareToPlay (double sampleRate, int samplesPerBlock)
 	currentSampleRate = sampleRate;
 	oneOverCurrentSampleRate = 1.0f/currentSampleRate;
 
-	// set up wave buffer and fill with triangle data
-	iLookupTableSize = 8192;
-	iLookupTableSizeMask =  iLookupTableSize-1;
-
-	pfLookupTable = new float[iLookupTableSize];
-	float fPhaseStep = (2 * double_Pi) / iLookupTableSize;
-	for(int i = 0; i < iLookupTableSize; i++){
-		if(i < iLookupTableSize * 0.5)
-			pfLookupTable[i] = -1.0f + (2.0/double_Pi)*i*fPhaseStep;
-		else
-			pfLookupTable[i] = 3.0f - (2.0/double_Pi)*i*fPhaseStep;
-	}
-	iLookupTablePos = 0;
-	iSamplesProcessed = 0;
-
+	// the triangle LFO starts at its lowest point
+	lfoPhase = 0.0;
 
-	// set up circular buffers
+	// set up circular buffer, room for two channels whatever the layout
 	iBufferSize = (int)sampleRate;
-	pfCircularBufferL = new float[iBufferSize];
-	for (int i = 0; i < iBufferSize; i++)
-		pfCircularBufferL[i] = 0;
-
-	if (getTotalNumInputChannels() == 2) {
-		pfCircularBufferR = new float[iBufferSize];
-		for (int i = 0; i < iBufferSize; i++)
-			pfCircularBufferR[i] = 0;
-	}
+	circularBuffer.calloc(2 * iBufferSize);
 	iBufferWritePos = 0;
 
 	updateFilters();
@@ -312,12 +291,7 @@ void DRowAudioFilter::prepareToPlay (double sampleRate, int samplesPerBlock)
 
 void DRowAudioFilter::releaseResources()
 {
-        if (pfLookupTable != nullptr)
-            delete[] pfLookupTable;
-        if (pfCircularBufferL != nullptr)
-            delete[] pfCircularBufferL;
-	if (getTotalNumInputChannels() == 2 && pfCircularBufferR != nullptr)
-		delete[] pfCircularBufferR;
+	circularBuffer.free();
 }
 
 void DRowAudioFilter::processBlock (AudioSampleBuffer& buffer,
@@ -333,101 +307,24 @@ void DRowAudioFilter::processBlock (AudioSampleBuffer& buffer,
 	float fFeedback = params[FEEDBACK].getSmoothedNormalisedValue();
 	float fWetDryMix = params[MIX].getSmoothedNormalisedValue();
 
-	// calculate current phase step
-	float phaseStep = iLookupTableSize * oneOverCurrentSampleRate * fRate;
+	// LFO phase step in cycles per sample
+	double phaseIncrement = fRate * oneOverCurrentSampleRate;
 
-	// set up array of pointers to samples
-	int numSamples = buffer.getNumSamples();
-	float* pfSample[numInputChannels];
-	for (int channel = 0; channel < numInputChannels; channel++)
-		pfSample[channel] = buffer.getWritePointer(channel);
+	const int numSamples = buffer.getNumSamples();
+	int readIndices[readPositionBlockSize];
+	float readFractions[readPositionBlockSize];
 
-	if (numInputChannels == 2)
-	{
-		//========================================================================
-		while (--numSamples >= 0)
-		{
-			int index =  (int)(iSamplesProcessed * phaseStep) &	iLookupTableSizeMask;
-
-			iSamplesProcessed++;
-			float fOsc = (pfLookupTable[index] * fDepth) + fDepth;
-
-			float fBufferReadPos1 = (iBufferWritePos - (fOsc * iBufferSize));
-			if (fBufferReadPos1 < 0)
-				fBufferReadPos1 += iBufferSize;
-
-			// read values from buffers
-			int iPos1, iPos2;
-			float fDiff, fDelL, fDelR;
-
-			iPos1 = (int)fBufferReadPos1;
-			iPos2 = iPos1 + 1;
-			if (iPos2 == iBufferSize)
-				iPos2 = 0;
-			fDiff = fBufferReadPos1 - iPos1;
-			fDelL = pfCircularBufferL[iPos2]*fDiff + pfCircularBufferL[iPos1]*(1-fDiff);
-			fDelR = pfCircularBufferR[iPos2]*fDiff + pfCircularBufferR[iPos1]*(1-fDiff);
-
-			// store current samples in buffers
-			iBufferWritePos++;
-			if (iBufferWritePos >= iBufferSize)
-				iBufferWritePos = 0;
-			pfCircularBufferL[iBufferWritePos] = *pfSample[0] + (fFeedback * fDelL);
-			pfCircularBufferR[iBufferWritePos] = *pfSample[1] + (fFeedback * fDelR);
-
-			// calculate output samples
-			float fOutL = 0.5f * (*pfSample[0] + fWetDryMix*fDelL);
-			float fOutR = 0.5f * (*pfSample[1] + fWetDryMix*fDelR);
-
-			*pfSample[0] = fOutL;
-			*pfSample[1] = fOutR;
-
-			// incriment sample pointers
-			pfSample[0]++;
-			pfSample[1]++;
-		}
-		//========================================================================
-	}
-	else if (numInputChannels == 1)
+	for (int start = 0; start < numSamples; start += readPositionBlockSize)
 	{
-		//========================================================================
-		while (--numSamples >= 0)
-		{
-			int index =  (int)(iSamplesProcessed * phaseStep) &	iLookupTableSizeMask;
-
-			iSamplesProcessed++;
-			float fOsc = (pfLookupTable[index] * fDepth) + fDepth;
-
-			float fBufferReadPos1 = (iBufferWritePos - (fOsc * iBufferSize));
-			if (fBufferReadPos1 < 0)
-				fBufferReadPos1 += iBufferSize;
-
-			// read values from buffers
-			int iPos1, iPos2;
-			float fDiff, fDelL;
-
-			iPos1 = (int)fBufferReadPos1;
-			iPos2 = iPos1 + 1;
-			if (iPos2 == iBufferSize)
-				iPos2 = 0;
-			fDiff = fBufferReadPos1 - iPos1;
-			fDelL = pfCircularBufferL[iPos2]*fDiff + pfCircularBufferL[iPos1]*(1-fDiff);
-
-			// store current samples in buffers
-			iBufferWritePos++;
-			if (iBufferWritePos >= iBufferSize)
-				iBufferWritePos = 0;
-			pfCircularBufferL[iBufferWritePos] = *pfSample[0] + (fFeedback * fDelL);
-
-			// calculate output samples
-			float fOutL = 0.5f * (*pfSample[0] + fWetDryMix*fDelL);
-
-			*pfSample[0] = fOutL;
-
-			// incriment sample pointers
-			pfSample[0]++;
-		}
-		//========================================================================
+		const int numThisTime = jmin ((int) readPositionBlockSize, numSamples - start);
+
+		calculateReadPositions(readIndices, readFractions, numThisTime, fDepth, phaseIncrement);
+
+		if (numInputChannels == 2)
+			processStereo(buffer.getWritePointer(0, start), buffer.getWritePointer(1, start),
+						  readIndices, readFractions, numThisTime, fFeedback, fWetDryMix);
+		else if (numInputChannels == 1)
+			processMono(buffer.getWritePointer(0, start), readIndices, readFractions, numThisTime, fFeedback, fWetDryMix);
 	}
 
     // in case we have more outputs than inputs, we'll clear any output
@@ -439,6 +336,99 @@ void DRowAudioFilter::processBlock (AudioSampleBuffer& buffer,
     }
 }
 
+void DRowAudioFilter::calculateReadPositions(int* readIndices, float* readFractions, int numSamples,
+											 float fDepth, double phaseIncrement)
+{
+	const float fPhase = (float) lfoPhase;
+	const float fPhaseIncrement = (float) phaseIncrement;
+
+	// Nothing is carried from one sample to the next and the buffer wrap is done
+	// on integers without branches, so this loop vectorises.
+	for (int i = 0; i < numSamples; i++)
+	{
+		float fLfoPhase = fPhase + i * fPhaseIncrement;
+		fLfoPhase -= (int) fLfoPhase;
+
+		// triangle from -1 at phase 0 to 1 at phase 0.5
+		const float fOsc = (1.0f - 4.0f * std::abs(fLfoPhase - 0.5f)) * fDepth + fDepth;
+		const float fDelay = fOsc * iBufferSize;
+		const int iDelay = (int) fDelay;
+
+		// read between the sample before and the one after the delay
+		int iPos1 = iBufferWritePos + i - iDelay - 1;
+		iPos1 += iBufferSize & (iPos1 >> 31);
+		iPos1 -= iBufferSize & ((iBufferSize - 1 - iPos1) >> 31);
+
+		readIndices[i] = iPos1;
+		readFractions[i] = 1.0f - (fDelay - iDelay);
+	}
+
+	// the phase is wrapped here in double precision so it never drifts
+	lfoPhase += numSamples * phaseIncrement;
+	lfoPhase -= std::floor(lfoPhase);
+}
+
+void DRowAudioFilter::processStereo(float* left, float* right, const int* readIndices, const float* readFractions,
+									int numSamples, float fFeedback, float fWetDryMix)
+{
+	float* const pfBuffer = circularBuffer;
+
+	for (int i = 0; i < numSamples; i++)
+	{
+		// read values from buffer, both channels at once
+		const int iPos1 = readIndices[i];
+		int iPos2 = iPos1 + 1;
+		if (iPos2 == iBufferSize)
+			iPos2 = 0;
+		const float fDiff = readFractions[i];
+
+		const float* const pfFrame1 = pfBuffer + 2 * iPos1;
+		const float* const pfFrame2 = pfBuffer + 2 * iPos2;
+		const float fIn[2] = { left[i], right[i] };
+		float fDel[2];
+
+		for (int c = 0; c < 2; c++)
+			fDel[c] = pfFrame2[c]*fDiff + pfFrame1[c]*(1-fDiff);
+
+		// store current samples in buffer
+		if (++iBufferWritePos >= iBufferSize)
+			iBufferWritePos = 0;
+
+		float* const pfWrite = pfBuffer + 2 * iBufferWritePos;
+		for (int c = 0; c < 2; c++)
+			pfWrite[c] = fIn[c] + (fFeedback * fDel[c]);
+
+		// calculate output samples
+		left[i] = 0.5f * (fIn[0] + fWetDryMix*fDel[0]);
+		right[i] = 0.5f * (fIn[1] + fWetDryMix*fDel[1]);
+	}
+}
+
+void DRowAudioFilter::processMono(float* samples, const int* readIndices, const float* readFractions,
+								  int numSamples, float fFeedback, float fWetDryMix)
+{
+	float* const pfBuffer = circularBuffer;
+
+	for (int i = 0; i < numSamples; i++)
+	{
+		// read values from buffer
+		const int iPos1 = readIndices[i];
+		int iPos2 = iPos1 + 1;
+		if (iPos2 == iBufferSize)
+			iPos2 = 0;
+		const float fDiff = readFractions[i];
+		const float fDel = pfBuffer[iPos2]*fDiff + pfBuffer[iPos1]*(1-fDiff);
+
+		// store current samples in buffer
+		if (++iBufferWritePos >= iBufferSize)
+			iBufferWritePos = 0;
+		pfBuffer[iBufferWritePos] = samples[i] + (fFeedback * fDel);
+
+		// calculate output samples
+		samples[i] = 0.5f * (samples[i] + fWetDryMix*fDel);
+	}
+}
+
 //==============================================================================
 #if ! JUCE_AUDIOPROCESSOR_NO_GUI
 AudioProcessorEditor* DRowAudioFilter::createEditor()
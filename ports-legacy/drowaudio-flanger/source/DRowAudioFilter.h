@@ -115,19 +115,26 @@ public:
 	PluginParameter* getParameterPointer(int index);
 
 private:
+	// samples the read positions are worked out for at a time
+	enum { readPositionBlockSize = 64 };
+
+	void calculateReadPositions(int* readIndices, float* readFractions, int numSamples, float fDepth, double phaseIncrement);
+	void processStereo(float* left, float* right, const int* readIndices, const float* readFractions,
+					   int numSamples, float fFeedback, float fWetDryMix);
+	void processMono(float* samples, const int* readIndices, const float* readFractions,
+					 int numSamples, float fFeedback, float fWetDryMix);
 
 	// parameter variables
 	PluginParameter params[noParams];
 
 	double currentSampleRate, oneOverCurrentSampleRate;
 
-	float* pfCircularBufferL;
-	float* pfCircularBufferR;
+	// channels are interleaved so a stereo frame is read and written as a pair
+	HeapBlock<float> circularBuffer;
 	int iBufferSize, iBufferWritePos;
 
-	float* pfLookupTable;
-	int iLookupTableSize, iLookupTableSizeMask, iLookupTablePos;
-	uint32 iSamplesProcessed;
+	// LFO phase in cycles, kept in [0, 1)
+	double lfoPhase;
 };
 
 
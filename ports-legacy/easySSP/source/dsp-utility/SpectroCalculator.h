@@ -48,6 +48,10 @@ namespace tomatl { namespace dsp {
 			mChannelCount = 0;
 			checkChannelCount(channelCount);
 
+			mFft.init((int)fftSize);
+			mFftInput.setSize((int)fftSize);
+			mFftOutput.setSize(sharedfft::RealFFT::getComplexSize((int)fftSize));
+
 			setAttackSpeed(attackRelease.first);
 			setReleaseSpeed(attackRelease.second);
 		}
@@ -152,19 +156,22 @@ namespace tomatl { namespace dsp {
 					mWindowFunction->applyFunction(chData + s * 2, s, 1, true);
 				}
 
-				// In-place calculate FFT
-				FftCalculator<T>::calculateFast(chData, mFftSize);
+				// The imaginary parts of the input are zero, so a real FFT will do
+				for (int s = 0; s < (int)mFftSize; ++s)
+				{
+					mFftInput[s] = (float)chData[s * 2];
+				}
+
+				mFft.forward(mFftInput, mFftOutput.re, mFftOutput.im);
 
 				// Calculate frequency-magnitude pairs (omitting phase information, as we won't need it) for all frequency bins
 				for (int bin = 0; bin < (mFftSize / 2.); ++bin)
 				{
 					T ampl = 0.;
 
-					T* ftResult = chData;
-
 					// FFT bin in rectangle form
-					T mFftSin = ftResult[bin * 2];
-					T mFftCos = ftResult[bin * 2 + 1];
+					T mFftSin = mFftOutput.re[bin];
+					T mFftCos = mFftOutput.im[bin];
 
 					// http://www.dsprelated.com/showmessage/69952/1.php or see below
 					mFftSin *= 2;
@@ -203,6 +210,9 @@ namespace tomatl { namespace dsp {
 		std::pair<double, double>* mData;
 		std::pair<double, double> mAttackRelease;
 		std::unique_ptr<WindowFunction<T>> mWindowFunction;
+		sharedfft::RealFFT mFft;
+		sharedfft::AlignedBuffer mFftInput;
+		sharedfft::SplitComplex mFftOutput;
 		size_t mChannelCount;
 		size_t mFftSize;
 		size_t mIndex;
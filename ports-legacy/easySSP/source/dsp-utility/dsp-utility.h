@@ -63,7 +63,7 @@
 #include "WindowFunction.h"
 #include "EnvelopeWalker.h"
 #include "GonioCalculator.h"
-#include "FftCalculator.h"
+#include "SharedFFT.h"
 #include "SpectroCalculator.h"
 //#include "BiQuad.h"
 #include "FrequencyDomainGrid.h"
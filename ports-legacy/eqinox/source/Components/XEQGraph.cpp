@@ -145,26 +145,33 @@ void EQGraph::paint (Graphics& g)
     // paint grid !
     paintBackgroundGrid (g);
 
-    // draw the frequency response
+    // draw the frequency response, evaluated for all the points at once
     float frq;
-    int iy, oiy = getResponse (ly, getFrequencyX (0.0));
+    int numPoints = 0;
     int halfSampleRate = (int) eff->getSampleRate () / 2;
 
-    Path path;
-    path.startNewSubPath (0.0f,
-                          (float)(ly - oiy));
+    HeapBlock<float> frequencies (jmax (lx, 1));
+    HeapBlock<float> responses (jmax (lx, 1));
 
+    frequencies [numPoints++] = getFrequencyX (0.0);
     for (i = 2; i < lx; i++)
     {
         frq = getFrequencyX (i / (float) lx);
         if (frq > halfSampleRate) break;
-        
-        iy = getResponse (ly, frq);
 
-        path.lineTo ((float)(i),
-                     (float)(ly - iy));
-                     
-        oiy = iy;
+        frequencies [numPoints++] = frq;
+    }
+
+    eff->getFrequencyResponse (frequencies, responses, numPoints);
+
+    Path path;
+    path.startNewSubPath (0.0f,
+                          (float)(ly - getResponse (ly, responses [0])));
+
+    for (i = 1; i < numPoints; i++)
+    {
+        path.lineTo ((float)(i + 1),
+                     (float)(ly - getResponse (ly, responses [i])));
     }
 
     // fill path if we want it to
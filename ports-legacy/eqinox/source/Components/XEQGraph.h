@@ -91,9 +91,8 @@ protected:
     void paintBackgroundGrid (Graphics& g);
 
     //==============================================================================
-    inline int getResponse (int maxy, float freq)
+    inline int getResponse (int maxy, float dbresp)
     {
-        float dbresp = eff->getFrequencyResponse (freq);
         return (int) ((dbresp / maxdB + 1.0) * maxy * 0.5);
     }
 
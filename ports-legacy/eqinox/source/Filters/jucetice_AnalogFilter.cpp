@@ -38,7 +38,6 @@ AnalogFilter::AnalogFilter (uint8 Ftype, float Ffreq, float Fq, uint8 Fstages)
     : samplerate (44100),
       blocksize (512)
 {
-    ismp = 0;
     firsttime = 1;
 
     type = Ftype;
@@ -46,24 +45,34 @@ AnalogFilter::AnalogFilter (uint8 Ftype, float Ffreq, float Fq, uint8 Fstages)
     q = Fq;
     gain = 1.0;
     stages = jmin (Fstages, (uint8) MAX_ANALOG_FILTER_STAGES);
+    order = 2;
+    oldorder = 2;
+
+    for (int i = 0; i < 3; i++)
+    {
+        c[i] = 0.0;
+        d[i] = 0.0;
+    }
+
+    computeFilterCoefs();
+    cleanup();
 }
 
 AnalogFilter::~AnalogFilter()
 {
-    if (ismp) delete[] ismp;
 }
 
 void AnalogFilter::cleanup()
 {
     for (int i = 0; i < MAX_ANALOG_FILTER_STAGES + 1; i++)
     {
-        x[i].c1 = 0.0;
-        x[i].c2 = 0.0;
-        y[i].c1 = 0.0;
-        y[i].c2 = 0.0;
-        oldx[i] = x[i];
-        oldy[i] = y[i];
+        st[i].ic1 = 0.0;
+        st[i].ic2 = 0.0;
     }
+
+    // the state is gone, so there is nothing to glide from
+    coefs = target;
+    oldorder = order;
     needsinterpolation = 0;
 }
 
@@ -72,29 +81,17 @@ void AnalogFilter::prepareToPlay (float sampleRate, int samplesPerBlock)
     samplerate = (int) sampleRate;
     blocksize = samplesPerBlock;
 
-    if (ismp) delete[] ismp;
-    ismp = new float [blocksize * 2];
-
     for (int i = 0; i < 3; i++)
     {
-        oldc[i] = 0.0;
-        oldd[i] = 0.0;
         c[i] = 0.0;
         d[i] = 0.0;
     }
 
-    cleanup();
-
-    firsttime = 0;
-    abovenq = 0;
-    oldabovenq = 0;
-    
-    setFreqAndQ (freq, q);
-    
     firsttime = 1;
     d[0] = 0; // this is not used
     
     computeFilterCoefs();
+    cleanup();
 }
 
 void AnalogFilter::releaseResources()
@@ -103,8 +100,8 @@ void AnalogFilter::releaseResources()
 
 void AnalogFilter::computeFilterCoefs()
 {
-    float tmp;
-    float omega, sn, cs, alpha, beta;
+    double tmp;
+    double omega, sn, cs, alpha, beta;
     int zerocoefs = 0; // this is used if the freq is too high
 
     // do not allow frequencies bigger than samplerate/2
@@ -120,7 +117,7 @@ void AnalogFilter::computeFilterCoefs()
     // do not allow bogus Q
     if (q < 0.0) q = 0.0;
 
-    float tmpq, tmpgain;
+    double tmpq, tmpgain;
     if (stages == 0)
     {
         tmpq = q;
@@ -332,45 +329,66 @@ void AnalogFilter::computeFilterCoefs()
     default: // wrong type
         type = 0;
         computeFilterCoefs();
-        break;
+        return;
     }
+
+    computeStateVariableCoefs();
 }
 
-void AnalogFilter::setFreq (float frequency)
+void AnalogFilter::computeStateVariableCoefs()
 {
-    if (frequency < 0.1) frequency = 0.1;
-
-    float rap = freq / frequency;
-    if (rap < 1.0) rap = 1.0 / rap;
-
-    oldabovenq = abovenq;
-    abovenq = frequency > (samplerate / 2 - 500.0);
-
-    int nyquistthresh = (abovenq ^ oldabovenq);
+    // match the biquad  (c0 + c1 z^-1 + c2 z^-2) / (1 - d1 z^-1 - d2 z^-2)
+    // with the trapezoidal filter, whose output mixes the input with the
+    // integrator outputs: the poles give g and k, the zeros give the mix
+    if (order == 1)
+    {
+        const double p = d[1];
+        const double g = (1.0 - p) / (1.0 + p);
+        const double m0 = (c[0] - c[1]) / (1.0 + p);
+
+        target.g = (float) g;
+        target.k = 0.0f;
+        target.m0 = (float) m0;
+        target.m1 = (float) ((c[0] - m0) * (1.0 + g) / g);
+        target.m2 = 0.0f;
+    }
+    else
+    {
+        const double a1 = -d[1];
+        const double a2 = -d[2];
+        const double an = 1.0 - a1 + a2; // denominator at nyquist
+        const double g = sqrt ((1.0 + a1 + a2) / an);
+        const double m0 = (c[0] - c[1] + c[2]) / an;
+
+        target.g = (float) g;
+        target.k = (float) (2.0 * (1.0 - a2) / (an * g));
+        target.m0 = (float) m0;
+        target.m1 = (float) (2.0 * (c[0] - c[2] - m0 * (1.0 - a2)) / (an * g));
+        target.m2 = (float) (2.0 * (c[1] - m0 * a1) / (an * g * g));
+    }
 
-    if ((rap > 3.0) || (nyquistthresh != 0))
+    // any change glides along the next block, only a change of order
+    // (where the integrators mean something else) jumps
+    if (firsttime != 0 || order != oldorder)
     {
-        // if the frequency is changed fast, it needs interpolation
-        // (now, filter and coeficients backup)
-        for (int i = 0; i < 3; i++)
-        {
-            oldc[i] = c[i];
-            oldd[i] = d[i];
-        }
+        coefs = target;
+        oldorder = order;
+        needsinterpolation = 0;
+    }
+    else
+    {
+        needsinterpolation = 1;
+    }
 
-        for (int i = 0; i < MAX_ANALOG_FILTER_STAGES + 1; i++)
-        {
-            oldx[i] = x[i];
-            oldy[i] = y[i];
-        }
+    firsttime = 0;
+}
 
-        if (firsttime == 0)
-            needsinterpolation = 1;
-    }
+void AnalogFilter::setFreq (float frequency)
+{
+    if (frequency < 0.1) frequency = 0.1;
 
     freq = frequency;
     computeFilterCoefs();
-    firsttime = 0;
     
 #if 0
     DBG ("AnalogFilter: " + String (freq));
@@ -410,67 +428,142 @@ void AnalogFilter::setStages (int stages_)
 }
 
 void AnalogFilter::singleFilterOut (float *smp,
-                                    AnalogFilterStage &x,
-                                    AnalogFilterStage &y,
-                                    float *c,
-                                    float *d,
+                                    AnalogFilterStage &s,
                                     int numSamples)
 {
-    float y0;
+    const float g = coefs.g, k = coefs.k;
+    const float m0 = coefs.m0, m1 = coefs.m1, m2 = coefs.m2;
 
     if (order == 1)
     {
         // First order filter
+        const float a = g / (1.0f + g);
+        float ic1 = s.ic1;
+
         for (int i = 0; i < numSamples; i++)
         {
-            y0 = smp[i] * c[0] + x.c1 * c[1] + y.c1 * d[1];
-            y.c1 = y0;
-            x.c1 = smp[i];
+            const float v0 = smp[i];
+            const float v1 = (v0 - ic1) * a;
+            const float lp = v1 + ic1;
+            ic1 = lp + v1;
             // output
-            smp[i] = y0;
+            smp[i] = m0 * v0 + m1 * lp;
         }
+
+        s.ic1 = ic1;
     }
     else if (order == 2)
     {
         // Second order filter
+        const float a1 = 1.0f / (1.0f + g * (g + k));
+        const float a2 = g * a1;
+        const float a3 = g * a2;
+        float ic1 = s.ic1, ic2 = s.ic2;
+
         for (int i = 0; i < numSamples; i++)
         {
-            y0 = smp[i] * c[0] + x.c1 * c[1] + x.c2 * c[2] + y.c1 * d[1] + y.c2 * d[2];
-            y.c2 = y.c1;
-            y.c1 = y0;
-            x.c2 = x.c1;
-            x.c1 = smp[i];
+            const float v0 = smp[i];
+            const float v3 = v0 - ic2;
+            const float v1 = a1 * ic1 + a2 * v3;
+            const float v2 = ic2 + a2 * ic1 + a3 * v3;
+            ic1 = 2.0f * v1 - ic1;
+            ic2 = 2.0f * v2 - ic2;
             // output
-            smp[i] = y0;
+            smp[i] = m0 * v0 + m1 * v1 + m2 * v2;
         }
+
+        s.ic1 = ic1;
+        s.ic2 = ic2;
     }
 }
 
-void AnalogFilter::filterOut (float *smp, int numSamples)
+void AnalogFilter::singleFilterOutRamp (float *smp,
+                                        AnalogFilterStage &s,
+                                        int numSamples)
 {
-    if (needsinterpolation != 0)
+    // same as singleFilterOut, with every coefficient moving linearly from
+    // the running set to the target, reaching it at the last sample
+    const float samplesInv = 1.0f / (float) numSamples;
+    const float dg = (target.g - coefs.g) * samplesInv;
+    const float dk = (target.k - coefs.k) * samplesInv;
+    const float dm0 = (target.m0 - coefs.m0) * samplesInv;
+    const float dm1 = (target.m1 - coefs.m1) * samplesInv;
+    const float dm2 = (target.m2 - coefs.m2) * samplesInv;
+
+    float g = coefs.g, k = coefs.k;
+    float m0 = coefs.m0, m1 = coefs.m1, m2 = coefs.m2;
+
+    if (order == 1)
     {
-        for (int i = 0; i < numSamples; i++)
-            ismp[i] = smp[i];
-        for (int i = 0; i < stages + 1; i++)
-            singleFilterOut (ismp, oldx[i], oldy[i], oldc, oldd, numSamples);
-    }
+        // First order filter
+        float ic1 = s.ic1;
 
-    for (int i = 0; i < stages + 1; i++)
-        singleFilterOut (smp, x[i], y[i], c, d, numSamples);
+        for (int i = 0; i < numSamples; i++)
+        {
+            g += dg;
+            m0 += dm0;
+            m1 += dm1;
+
+            const float v0 = smp[i];
+            const float v1 = (v0 - ic1) * g / (1.0f + g);
+            const float lp = v1 + ic1;
+            ic1 = lp + v1;
+            // output
+            smp[i] = m0 * v0 + m1 * lp;
+        }
 
-    if (needsinterpolation != 0)
+        s.ic1 = ic1;
+    }
+    else if (order == 2)
     {
-        float samplesInv = 1.0f / (float) numSamples;
-        
+        // Second order filter
+        float ic1 = s.ic1, ic2 = s.ic2;
+
         for (int i = 0; i < numSamples; i++)
         {
-            float x = i * samplesInv;
-            smp[i] = ismp[i] * (1.0 - x) + smp[i] * x;
+            g += dg;
+            k += dk;
+            m0 += dm0;
+            m1 += dm1;
+            m2 += dm2;
+
+            const float a1 = 1.0f / (1.0f + g * (g + k));
+            const float a2 = g * a1;
+            const float a3 = g * a2;
+
+            const float v0 = smp[i];
+            const float v3 = v0 - ic2;
+            const float v1 = a1 * ic1 + a2 * v3;
+            const float v2 = ic2 + a2 * ic1 + a3 * v3;
+            ic1 = 2.0f * v1 - ic1;
+            ic2 = 2.0f * v2 - ic2;
+            // output
+            smp[i] = m0 * v0 + m1 * v1 + m2 * v2;
         }
 
+        s.ic1 = ic1;
+        s.ic2 = ic2;
+    }
+}
+
+void AnalogFilter::filterOut (float *smp, int numSamples)
+{
+    if (numSamples <= 0)
+        return;
+
+    if (needsinterpolation != 0)
+    {
+        for (int i = 0; i < stages + 1; i++)
+            singleFilterOutRamp (smp, st[i], numSamples);
+
+        coefs = target;
         needsinterpolation = 0;
     }
+    else
+    {
+        for (int i = 0; i < stages + 1; i++)
+            singleFilterOut (smp, st[i], numSamples);
+    }
 }
 
 float AnalogFilter::H (float freq)
@@ -498,3 +591,28 @@ float AnalogFilter::H (float freq)
     return pow (h, (stages + 1.0f) / 2.0f);
 }
 
+void AnalogFilter::multiplyResponse (const float *cosw,
+                                     const float *sinw,
+                                     const float *cos2w,
+                                     const float *sin2w,
+                                     float *magnitudes,
+                                     int numPoints) const
+{
+    const float c0 = (float) c[0], c1 = (float) c[1], c2 = (float) c[2];
+    const float d1 = (float) d[1], d2 = (float) d[2];
+
+    // no branches depending on the point, so the loop vectorises
+    for (int i = 0; i < numPoints; i++)
+    {
+        const float xb = c0 + c1 * cosw[i] + c2 * cos2w[i];
+        const float yb = c1 * sinw[i] + c2 * sin2w[i];
+        const float xa = 1.0f - d1 * cosw[i] - d2 * cos2w[i];
+        const float ya = d1 * sinw[i] + d2 * sin2w[i];
+
+        const float h = (xb * xb + yb * yb) / (xa * xa + ya * ya);
+        const float r = sqrtf (h);
+
+        magnitudes[i] *= (stages == 0) ? r : ((stages == 1) ? h : h * r);
+    }
+}
+
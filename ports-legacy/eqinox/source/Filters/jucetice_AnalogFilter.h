@@ -61,24 +61,42 @@ public:
 
     float H (float freq); // Obtains the response for a given frequency
 
+    // Multiplies the magnitudes with the response of the filter, one value per
+    // point. The caller evaluates the angles (2 * pi * freq / samplerate) once
+    // and shares them between all the filters of the same sample rate
+    void multiplyResponse (const float *cosw,
+                           const float *sinw,
+                           const float *cos2w,
+                           const float *sin2w,
+                           float *magnitudes,
+                           int numPoints) const;
+
 
 private:
 
+    // The filter runs as a trapezoidal integrated state variable filter (or a
+    // one pole for the first order types), that stays well behaved while its
+    // coefficients change every sample. The coefficients are converted from the
+    // biquad designs, so the responses are the same as the cookbook ones
     struct AnalogFilterStage {
-      float c1, c2;
-    } x[MAX_ANALOG_FILTER_STAGES + 1],
-      y[MAX_ANALOG_FILTER_STAGES + 1],
-      oldx[MAX_ANALOG_FILTER_STAGES + 1],
-      oldy[MAX_ANALOG_FILTER_STAGES + 1];
+      float ic1, ic2;                 // integrator states
+    } st[MAX_ANALOG_FILTER_STAGES + 1];
+
+    struct AnalogFilterCoefs {
+      float g, k;                     // integrator gain and damping
+      float m0, m1, m2;               // mix of the input, band and low pass outputs
+    };
 
     void singleFilterOut (float *smp,
-                          AnalogFilterStage &x,
-                          AnalogFilterStage &y,
-                          float *c,
-                          float *d,
+                          AnalogFilterStage &s,
                           int numSamples);
 
+    void singleFilterOutRamp (float *smp,
+                              AnalogFilterStage &s,
+                              int numSamples);
+
     void computeFilterCoefs ();
+    void computeStateVariableCoefs ();
 
     int type;                         // The type of the filter (LPF1,HPF1,LPF2,HPF2...)
     int stages;                       // how many times the filter is applied (0->1,1->2,etc.)
@@ -86,15 +104,12 @@ private:
     float freq;                       // Frequency given in Hz
     float q;                          // Q factor (resonance or Q factor)
     float gain;                       // the gain of the filter (if are shelf/peak) filters
-    float c[3],d[3];                  // coefficients
-    float oldc[3],oldd[3];            // old coefficients(used only if some filter paremeters changes very fast, and it needs interpolation)
-    float xd[3],yd[3];                // used if the filter is applied more times
-    float *ismp;                      // used if it needs interpolation
-    //float outgain;
+    double c[3],d[3];                 // biquad coefficients (used for the response)
+    AnalogFilterCoefs coefs;          // coefficients the filter is running with
+    AnalogFilterCoefs target;         // coefficients of the settings, reached along the next block
+    int oldorder;                     // order of the running coefficients
     int samplerate, blocksize;
     int needsinterpolation, firsttime;
-    int abovenq;                      // this is 1 if the frequency is above the nyquist
-    int oldabovenq;                   // if the last time was above nyquist (used to see if it needs interpolation)
 };
 
 
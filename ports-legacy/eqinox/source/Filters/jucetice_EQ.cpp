@@ -279,14 +279,42 @@ void Equalizer::updateFromXML (XmlElement *xml)
 //==============================================================================
 float Equalizer::getFrequencyResponse (float freq)
 {
-    float resp = 1.0;
+    float dB;
+    getFrequencyResponse (&freq, &dB, 1);
+    return dB;
+}
+
+void Equalizer::getFrequencyResponse (const float *freqs, float *dBs, const int numPoints)
+{
+    if (numPoints <= 0)
+        return;
+
+    // the angles are the same for every band, evaluate them once per point
+    HeapBlock<float> angles (numPoints * 4);
+    float *cosw = angles;
+    float *sinw = angles + numPoints;
+    float *cos2w = angles + numPoints * 2;
+    float *sin2w = angles + numPoints * 3;
+
+    const float fr = double_Pi * 2.0 / sampleRate;
+    for (int i = 0; i < numPoints; i++)
+    {
+        const float w = freqs[i] * fr;
+        cosw[i] = cos (w);
+        sinw[i] = sin (w);
+        cos2w[i] = 2.0f * cosw[i] * cosw[i] - 1.0f;
+        sin2w[i] = 2.0f * sinw[i] * cosw[i];
+        dBs[i] = outvolume;
+    }
 
     for (int i = 0; i < MAX_EQ_BANDS; i++)
     {
         if (filter[i].Ptype == 0) continue;
-        resp *= filter[i].l->H (freq);
+        filter[i].l->multiplyResponse (cosw, sinw, cos2w, sin2w, dBs, numPoints);
     }
-    return 20 * log (resp * outvolume) / double_Log10;
+
+    for (int i = 0; i < numPoints; i++)
+        dBs[i] = 20.0f * log10 (dBs[i]);
 }
 
 float Equalizer::getSampleRate ()
@@ -66,6 +66,7 @@ public:
     void clean();
 
     float getFrequencyResponse (float freq);
+    void getFrequencyResponse (const float *freqs, float *dBs, const int numPoints);
     float getSampleRate ();
 
 private:
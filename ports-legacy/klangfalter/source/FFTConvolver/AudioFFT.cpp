@@ -33,6 +33,9 @@
 #elif defined (AUDIOFFT_FFTW3)
   #define AUDIOFFT_FFTW3_USED
   #include <fftw3.h>
+#elif defined (AUDIOFFT_SHAREDFFT)
+  #define AUDIOFFT_SHAREDFFT_USED
+  #include "SharedFFT.h"
 #else
   #if !defined(AUDIOFFT_OOURA)
     #define AUDIOFFT_OOURA
@@ -979,6 +982,59 @@ namespace audiofft
 
 #endif // AUDIOFFT_FFTW3_USED
 
+
+    // ================================================================
+
+
+#ifdef AUDIOFFT_SHAREDFFT_USED
+
+
+    /**
+     * @internal
+     * @class SharedFFT
+     * @brief FFT implementation using the plan-caching FFT from libs/sharedfft
+     */
+    class SharedFFT : public AudioFFTImpl
+    {
+    public:
+      SharedFFT() :
+        AudioFFTImpl(),
+        _fft()
+      {
+      }
+
+      virtual void init(size_t size) override
+      {
+        _fft.init(static_cast<int>(size));
+      }
+
+      virtual void fft(const float* data, float* re, float* im) override
+      {
+        _fft.forward(data, re, im);
+      }
+
+      virtual void ifft(float* data, const float* re, const float* im) override
+      {
+        _fft.inverse(re, im, data);
+        ScaleBuffer(data, data, 1.0f / static_cast<float>(_fft.getSize()), static_cast<size_t>(_fft.getSize()));
+      }
+
+    private:
+      sharedfft::RealFFT _fft;
+
+      SharedFFT(const SharedFFT&) = delete;
+      SharedFFT& operator=(const SharedFFT&) = delete;
+    };
+
+
+    std::unique_ptr<AudioFFTImpl> MakeAudioFFTImpl()
+    {
+      return std::unique_ptr<SharedFFT>(new SharedFFT());
+    }
+
+
+#endif // AUDIOFFT_SHAREDFFT_USED
+
   } // End of namespace details
 
 
@@ -237,10 +237,9 @@ void LuftikusAudioProcessor::changeProgramName (int /*index*/, const String& /*n
 }
 
 //==============================================================================
-void LuftikusAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
+void LuftikusAudioProcessor::prepareToPlay (double sampleRate, int /*samplesPerBlock*/)
 {
 	eqDsp.setSampleRate(sampleRate);
-	eqDsp.setBlockSize(samplesPerBlock);
 }
 
 void LuftikusAudioProcessor::releaseResources()
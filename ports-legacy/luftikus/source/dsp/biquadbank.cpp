@@ -0,0 +1,324 @@
+#include "biquadbank.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <emmintrin.h>
+#define BIQUADBANK_USE_SSE2 1
+#endif
+
+namespace
+{
+	// noise is read for every lane of every channel plus the output of every channel
+	const int kNoiseSize = 65536;
+	const int kNoiseGuard = 256;
+
+	template <bool analog, bool rampCoeffs>
+	struct BankLoop
+	{
+		static void run(double* const* lanes, int numLanes, float* data, int numSamples,
+		                double dry, double deltaDry,
+		                const double* laneNoise, const double* outputNoise, int noisePos, int noiseStep)
+		{
+			double* const b0 = lanes[0];
+			double* const b1 = lanes[1];
+			double* const b2 = lanes[2];
+			double* const a1 = lanes[3];
+			double* const a2 = lanes[4];
+			double* const s1 = lanes[10];
+			double* const s2 = lanes[11];
+			double* const w = lanes[12];
+			const double* const dw = lanes[13];
+
+			for (int i=0; i<numSamples; ++i)
+			{
+				const double x = data[i];
+
+#if BIQUADBANK_USE_SSE2
+				const __m128d xIn = _mm_set1_pd(x);
+				const __m128d signMask = _mm_set1_pd(-0.0);
+				const __m128d threshold = _mm_set1_pd(1e-10);
+				__m128d acc = _mm_setzero_pd();
+
+				for (int l=0; l<numLanes; l+=2)
+				{
+					const __m128d x0 = analog ? _mm_add_pd(xIn, _mm_loadu_pd(laneNoise + noisePos + l)) : xIn;
+
+					const __m128d vb0 = _mm_load_pd(b0 + l);
+					const __m128d vb1 = _mm_load_pd(b1 + l);
+					const __m128d vb2 = _mm_load_pd(b2 + l);
+					const __m128d va1 = _mm_load_pd(a1 + l);
+					const __m128d va2 = _mm_load_pd(a2 + l);
+					const __m128d vs1 = _mm_load_pd(s1 + l);
+					const __m128d vs2 = _mm_load_pd(s2 + l);
+
+					__m128d y0 = _mm_add_pd(_mm_mul_pd(vb0, x0), vs1);
+
+					if (! analog)
+					{
+						const __m128d keep = _mm_cmpge_pd(_mm_andnot_pd(signMask, y0), threshold);
+						y0 = _mm_and_pd(y0, keep);
+					}
+
+					_mm_store_pd(s1 + l, _mm_add_pd(_mm_sub_pd(_mm_mul_pd(vb1, x0), _mm_mul_pd(va1, y0)), vs2));
+					_mm_store_pd(s2 + l, _mm_sub_pd(_mm_mul_pd(vb2, x0), _mm_mul_pd(va2, y0)));
+
+					const __m128d vw = _mm_load_pd(w + l);
+					acc = _mm_add_pd(acc, _mm_mul_pd(vw, y0));
+					_mm_store_pd(w + l, _mm_add_pd(vw, _mm_load_pd(dw + l)));
+
+					if (rampCoeffs)
+					{
+						_mm_store_pd(b0 + l, _mm_add_pd(vb0, _mm_load_pd(lanes[5] + l)));
+						_mm_store_pd(b1 + l, _mm_add_pd(vb1, _mm_load_pd(lanes[6] + l)));
+						_mm_store_pd(b2 + l, _mm_add_pd(vb2, _mm_load_pd(lanes[7] + l)));
+						_mm_store_pd(a1 + l, _mm_add_pd(va1, _mm_load_pd(lanes[8] + l)));
+						_mm_store_pd(a2 + l, _mm_add_pd(va2, _mm_load_pd(lanes[9] + l)));
+					}
+				}
+
+				double y = _mm_cvtsd_f64(_mm_add_sd(acc, _mm_unpackhi_pd(acc, acc)));
+#else
+				double y = 0;
+
+				for (int l=0; l<numLanes; ++l)
+				{
+					const double x0 = analog ? x + laneNoise[noisePos + l] : x;
+					double y0 = x0*b0[l] + s1[l];
+
+					if (! analog && y0 > -1e-10 && y0 < 1e-10)
+						y0 = 0;
+
+					s1[l] = x0*b1[l] - y0*a1[l] + s2[l];
+					s2[l] = x0*b2[l] - y0*a2[l];
+
+					y += w[l] * y0;
+					w[l] += dw[l];
+
+					if (rampCoeffs)
+					{
+						b0[l] += lanes[5][l];
+						b1[l] += lanes[6][l];
+						b2[l] += lanes[7][l];
+						a1[l] += lanes[8][l];
+						a2[l] += lanes[9][l];
+					}
+				}
+#endif
+
+				y += dry * x;
+				dry += deltaDry;
+
+				if (analog)
+				{
+					y += outputNoise[noisePos];
+
+					noisePos += noiseStep;
+					if (noisePos >= kNoiseSize)
+						noisePos -= kNoiseSize;
+				}
+
+				data[i] = (float) y;
+			}
+		}
+	};
+}
+
+BiquadBank::BiquadBank(int numChannels_, int numSections_)
+: numChannels(numChannels_),
+	numSections(numSections_),
+	lanesPerChannel((numSections_ + 1) & ~1),
+	numLanes(numChannels_ * ((numSections_ + 1) & ~1)),
+	coeffsChanged(false),
+	analog(false),
+	prepared(false),
+	noisePos(0)
+{
+	jassert(numChannels > 0 && numSections > 0);
+	jassert(numLanes + numChannels <= kNoiseGuard);
+
+	for (int i=0; i<kNumArrays; ++i)
+		arrays[i].setSize(numLanes);
+
+	targetCoeffs.calloc(numLanes * 5);
+	targetWeights.calloc(numLanes);
+	dryWeights.calloc(numChannels);
+	targetDryWeights.calloc(numChannels);
+
+	// let every instance start somewhere else in the shared noise table
+	noisePos = Random::getSystemRandom().nextInt(kNoiseSize);
+}
+
+void BiquadBank::clear()
+{
+	for (int i=0; i<numLanes; ++i)
+	{
+		get(kS1)[i] = 0;
+		get(kS2)[i] = 0;
+	}
+}
+
+void BiquadBank::setCoeffs(int section, double b0, double b1, double b2, double a1, double a2)
+{
+	jassert(section >= 0 && section < numSections);
+
+	for (int c=0; c<numChannels; ++c)
+	{
+		double* const target = targetCoeffs + (c*lanesPerChannel + section) * 5;
+		target[0] = b0;
+		target[1] = b1;
+		target[2] = b2;
+		target[3] = a1;
+		target[4] = a2;
+	}
+
+	if (! prepared)
+	{
+		for (int c=0; c<numChannels; ++c)
+		{
+			const int lane = c*lanesPerChannel + section;
+
+			get(kB0)[lane] = b0;
+			get(kB1)[lane] = b1;
+			get(kB2)[lane] = b2;
+			get(kA1)[lane] = a1;
+			get(kA2)[lane] = a2;
+		}
+	}
+
+	coeffsChanged = prepared;
+}
+
+void BiquadBank::setWeights(int channel, const float* sectionWeights, float dryWeight)
+{
+	jassert(channel >= 0 && channel < numChannels);
+
+	for (int s=0; s<numSections; ++s)
+		targetWeights[channel*lanesPerChannel + s] = sectionWeights[s];
+
+	targetDryWeights[channel] = dryWeight;
+
+	if (! prepared)
+	{
+		for (int s=0; s<numSections; ++s)
+			get(kWeight)[channel*lanesPerChannel + s] = sectionWeights[s];
+
+		dryWeights[channel] = dryWeight;
+	}
+}
+
+void BiquadBank::setAnalog(bool newAnalog)
+{
+	analog = newAnalog;
+}
+
+const double* BiquadBank::getNoiseTable()
+{
+	struct NoiseTable
+	{
+		NoiseTable()
+		{
+			Random rnd(0x1f7a2b);
+
+			for (int i=0; i<kNoiseSize; ++i)
+				data[i] = 1e-5 * (rnd.nextDouble() - 0.5);
+
+			for (int i=0; i<kNoiseGuard; ++i)
+				data[kNoiseSize + i] = data[i];
+		}
+
+		double data[kNoiseSize + kNoiseGuard];
+	};
+
+	static const NoiseTable table;
+	return table.data;
+}
+
+void BiquadBank::processBlock(float** in, int numChannels_, int numSamples)
+{
+	jassert(numChannels_ <= numChannels);
+	numChannels_ = jmin(numChannels_, numChannels);
+
+	if (numSamples <= 0)
+		return;
+
+	prepared = true;
+
+	const double invNumSamples = 1.0 / numSamples;
+
+	double* const w = get(kWeight);
+	double* const dw = get(kDeltaWeight);
+
+	for (int i=0; i<numLanes; ++i)
+		dw[i] = (targetWeights[i] - w[i]) * invNumSamples;
+
+	if (coeffsChanged)
+	{
+		for (int i=0; i<numLanes; ++i)
+		{
+			for (int k=0; k<5; ++k)
+				get(Arrays(kDeltaB0 + k))[i] = (targetCoeffs[i*5 + k] - get(Arrays(kB0 + k))[i]) * invNumSamples;
+		}
+	}
+
+	const double* const noise = getNoiseTable();
+	const int noiseStep = numLanes + numChannels;
+
+	for (int c=0; c<numChannels_; ++c)
+	{
+		float* const data = in[c];
+		double* const lanes[kNumArrays] = {
+			get(kB0) + c*lanesPerChannel, get(kB1) + c*lanesPerChannel, get(kB2) + c*lanesPerChannel,
+			get(kA1) + c*lanesPerChannel, get(kA2) + c*lanesPerChannel,
+			get(kDeltaB0) + c*lanesPerChannel, get(kDeltaB1) + c*lanesPerChannel, get(kDeltaB2) + c*lanesPerChannel,
+			get(kDeltaA1) + c*lanesPerChannel, get(kDeltaA2) + c*lanesPerChannel,
+			get(kS1) + c*lanesPerChannel, get(kS2) + c*lanesPerChannel,
+			get(kWeight) + c*lanesPerChannel, get(kDeltaWeight) + c*lanesPerChannel
+		};
+
+		const double* const channelNoise = noise + c*lanesPerChannel;
+		const double* const outputNoise = noise + numLanes + c;
+
+		double dry = dryWeights[c];
+		const double deltaDry = (targetDryWeights[c] - dry) * invNumSamples;
+
+		if (analog)
+		{
+			if (coeffsChanged)
+				BankLoop<true, true>::run(lanes, lanesPerChannel, data, numSamples, dry, deltaDry, channelNoise, outputNoise, noisePos, noiseStep);
+			else
+				BankLoop<true, false>::run(lanes, lanesPerChannel, data, numSamples, dry, deltaDry, channelNoise, outputNoise, noisePos, noiseStep);
+		}
+		else
+		{
+			if (coeffsChanged)
+				BankLoop<false, true>::run(lanes, lanesPerChannel, data, numSamples, dry, deltaDry, channelNoise, outputNoise, noisePos, noiseStep);
+			else
+				BankLoop<false, false>::run(lanes, lanesPerChannel, data, numSamples, dry, deltaDry, channelNoise, outputNoise, noisePos, noiseStep);
+		}
+	}
+
+	if (analog)
+		noisePos = (noisePos + numSamples * noiseStep) % kNoiseSize;
+
+	// snap to the targets so the ramps never accumulate rounding errors
+	for (int i=0; i<numLanes; ++i)
+	{
+		w[i] = targetWeights[i];
+		dw[i] = 0;
+	}
+
+	for (int c=0; c<numChannels; ++c)
+		dryWeights[c] = targetDryWeights[c];
+
+	if (coeffsChanged)
+	{
+		for (int i=0; i<numLanes; ++i)
+		{
+			for (int k=0; k<5; ++k)
+			{
+				get(Arrays(kB0 + k))[i] = targetCoeffs[i*5 + k];
+				get(Arrays(kDeltaB0 + k))[i] = 0;
+			}
+		}
+
+		coeffsChanged = false;
+	}
+}
@@ -0,0 +1,88 @@
+#ifndef __BIQUADBANK_H_5A1E3D27__
+#define __BIQUADBANK_H_5A1E3D27__
+
+#include "JuceHeader.h"
+
+/*
+	A bank of parallel biquads for all channels at once.
+
+	Every channel feeds its input into numSections transposed direct form II
+	biquads. The section outputs are weighted and summed together with the
+	dry input, so one "lane" is one section of one channel. Lanes are
+	processed in pairs with SSE2 doubles.
+
+	Weights are linearly ramped over each block and new coefficients are
+	ramped in over the block following setCoeffs(). Both a1/a2 end points
+	lie in the (convex) stability triangle, so every intermediate filter
+	is stable too.
+
+	With static settings the output matches the scalar direct form I chain
+	within 1e-6 (about -120 dBFS) for full scale input, the difference
+	being rounding only.
+*/
+class BiquadBank
+{
+public:
+
+	BiquadBank(int numChannels, int numSections);
+
+	void clear();
+
+	void setCoeffs(int section, double b0, double b1, double b2, double a1, double a2);
+
+	// weights for the block about to be processed, numSections per channel
+	void setWeights(int channel, const float* sectionWeights, float dryWeight);
+
+	void setAnalog(bool newAnalog);
+
+	void processBlock(float** in, int numChannels, int numSamples);
+
+private:
+
+	struct AlignedDoubles
+	{
+		void setSize(int size)
+		{
+			data.calloc(size + 2);
+			const size_t addr = (size_t) (double*) data;
+			ptr = (double*) ((addr + 0xF) & ~(size_t) 0xF);
+		}
+
+		double* ptr;
+		HeapBlock<double> data;
+	};
+
+	enum Arrays
+	{
+		kB0, kB1, kB2, kA1, kA2,
+		kDeltaB0, kDeltaB1, kDeltaB2, kDeltaA1, kDeltaA2,
+		kS1, kS2,
+		kWeight, kDeltaWeight,
+
+		kNumArrays
+	};
+
+	double* get(Arrays which) { return arrays[which].ptr; }
+
+	static const double* getNoiseTable();
+
+	const int numChannels;
+	const int numSections;
+	const int lanesPerChannel;
+	const int numLanes;
+
+	AlignedDoubles arrays[kNumArrays];
+
+	HeapBlock<double> targetCoeffs;
+	HeapBlock<double> targetWeights;
+	HeapBlock<double> dryWeights;
+	HeapBlock<double> targetDryWeights;
+
+	bool coeffsChanged;
+	bool analog;
+	bool prepared;
+	int noisePos;
+};
+
+
+#endif  // __BIQUADBANK_H_5A1E3D27__
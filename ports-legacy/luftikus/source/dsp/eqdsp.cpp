@@ -3,7 +3,6 @@
 
 EqDsp::EqDsp()
 : highShelf(kHighOff),
-	blockSize(0),
 	analog(false),
 	mastering(false),
 	keepGain(false),
@@ -11,12 +10,11 @@ EqDsp::EqDsp()
 {
 	for (int i=0; i<kNumTypes; ++i)
 	{
+		gains[i] = 0;
 		setGain((Type) i, 0);
 		//gains[i] = 0.5f*56.2f/505.62f;
-		biquads.add(new SimpleBiquad());
 	}
 
-	setBlockSize(2048);
 	setSampleRate(44100);
 }
 
@@ -44,31 +42,13 @@ float EqDsp::getGain(Type type)
 void EqDsp::setHighShelf(HighShelf type)
 {
 	highShelf = type;
-
-	for (int i=0; i<kNumTypes; ++i)
-		setupFilter((Type) i);}
+}
 
 EqDsp::HighShelf EqDsp::getHighShelf()
 {
 	return highShelf;
 }
 
-void EqDsp::setBlockSize(int newBlockSize)
-{
-	if (newBlockSize > blockSize)
-	{
-		blockSize = newBlockSize;
-
-		data10.realloc(blockSize);
-		data40.realloc(blockSize);
-		data160.realloc(blockSize);
-		data640.realloc(blockSize);
-		data2k5.realloc(blockSize);
-		dataHi.realloc(blockSize);
-		dataOut.realloc(blockSize);
-	}
-}
-
 void EqDsp::setSampleRate(double newSR)
 {
 	sampleRate = newSR <=  44100 ? CoeffCreator::k44100 
@@ -78,15 +58,10 @@ void EqDsp::setSampleRate(double newSR)
 		         : newSR <= 176400 ? CoeffCreator::k176400 
 		         : newSR <= 192000 ? CoeffCreator::k192000 
 						 : CoeffCreator::k192000;
-
-	for (int i=0; i<kNumTypes; ++i)
-		setupFilter((Type) i);
 }
 
-void EqDsp::processBlock(float* in, int numSamples)
+void EqDsp::getWeights(float* sectionWeights, float& dryWeight)
 {
-	setBlockSize(numSamples);
-
 	float g[kNumTypes];
 	float pg[kNumTypes];
 
@@ -118,73 +93,26 @@ void EqDsp::processBlock(float* in, int numSamples)
 		//g[kShelfHi] = x <= 0.5f? 500 - 823.6f*x : 3258.2f * exp(-7.4126f*x) - 1.8466f;
 	}
 
+	if (highShelf == kHighOff)
+		g[kShelfHi] = 0.f;
 
-	float* data[kNumTypes];
-	data[kBand10] = data10;
-	data[kBand40] = data40;
-	data[kBand160] = data160;
-	data[kBand640] = data640;
-	data[kShelf2k5] = data2k5;
-	data[kShelfHi] = dataHi;
-
-	for (int i=0; i<kNumTypes; ++i)
-		memcpy(data[i], in, sizeof(float)*numSamples);
-
+	// every band adds (filtered * pg + dry) * g, so the dry parts sum up to dcGain
 	float dcGain = 0.f;
 
 	for (int i=0; i<kNumTypes; ++i)
-	{
-		SimpleBiquad* biquad = biquads[i];
-		jassert(biquad != nullptr);
-
-		if (biquad != nullptr)
-		{
-			biquad->processBlock(data[i], numSamples);
-
-			if (i != kShelfHi || highShelf != kHighOff)
-				dcGain += g[i];
-		}
-	}
-
-	if (highShelf != kHighOff)
-	{
-		for (int i=0; i<numSamples; ++i)
-			dataOut[i] = (data[kShelfHi][i] * pg[kShelfHi] + in[i]) * g[kShelfHi];
-	}
-	else
-	{
-		for (int i=0; i<numSamples; ++i)
-			dataOut[i] = 0.f;
-	}
-
-	for (int n=0; n<kShelfHi; ++n)
-	{
-		for (int i=0; i<numSamples; ++i)
-			dataOut[i] += (data[n][i] * pg[n] + in[i]) * g[n];
-	}
+		dcGain += g[i];
 
 	const float globalGain = keepGain ? 0.398f/dcGain : 0.29f;
 
-	if (analog)
-	{
-		Random& rnd(Random::getSystemRandom());
+	for (int i=0; i<kNumTypes; ++i)
+		sectionWeights[i] = g[i] * pg[i] * globalGain;
 
-		for (int i=0; i<numSamples; ++i)
-			in[i] = dataOut[i] * globalGain + float(1e-5) * (rnd.nextFloat() - 0.5f);
-	}
-	else
-	{
-		for (int i=0; i<numSamples; ++i)
-			in[i] = dataOut[i] * globalGain;
-	}
+	dryWeight = dcGain * globalGain;
 }
 
 void EqDsp::setAnalog(bool newAnalog)
 {
 	analog = newAnalog;
-
-	for (int i=0; i<biquads.size(); ++i)
-		biquads.getUnchecked(i)->setAnalog(analog);
 }
 
 bool EqDsp::getAnalog()
@@ -212,10 +140,10 @@ bool EqDsp::getKeepGain()
 	return keepGain;
 }
 
-void EqDsp::setupFilter(Type type)
+void EqDsp::getCoeffs(Type type, double* b, double* a)
 {
-	double b[3] = {0, 0, 0};
-	double a[3] = {1, 0, 0};
+	b[0] = 0; b[1] = 0; b[2] = 0;
+	a[0] = 1; a[1] = 0; a[2] = 0;
 
 	switch (type)
 	{
@@ -267,24 +195,19 @@ void EqDsp::setupFilter(Type type)
 	}
 
 	jassert(a[0] == 1);
-
-	{
-		SimpleBiquad* biquad = biquads[type];
-		jassert(biquad != nullptr);
-
-		if (biquad != nullptr)
-			biquad->setBiquad(b[0], b[1], b[2], a[1], a[2]);
-	}
 }
 
 
 // =================================================================================
 MultiEq::MultiEq(int numChannels)
+: biquads(numChannels, EqDsp::kNumTypes)
 {
 	jassert(numChannels > 0);
 
 	for (int i=0; i<numChannels; ++i)
 		eqs.add(new EqDsp());
+
+	setupFilters();
 }
 	
 void MultiEq::setGain(EqDsp::Type type, float newValue)
@@ -302,6 +225,8 @@ void MultiEq::setHighShelf(EqDsp::HighShelf type)
 {
 	for (int i=0; i<eqs.size(); ++i)
 		eqs.getUnchecked(i)->setHighShelf(type);
+
+	setupFilters();
 }
 
 EqDsp::HighShelf MultiEq::getHighShelf()
@@ -309,33 +234,38 @@ EqDsp::HighShelf MultiEq::getHighShelf()
 	return eqs.size() > 0 ? eqs.getUnchecked(0)->getHighShelf() : EqDsp::kHighOff;
 }
 
-void MultiEq::setBlockSize(int newBlockSize)
-{
-	for (int i=0; i<eqs.size(); ++i)
-		eqs.getUnchecked(i)->setBlockSize(newBlockSize);
-}
-
 void MultiEq::setSampleRate(double newSR)
 {
 	for (int i=0; i<eqs.size(); ++i)
 		eqs.getUnchecked(i)->setSampleRate(newSR);
+
+	setupFilters();
 }
 
 void MultiEq::processBlock(float** in, int numChannels, int numSamples)
 {
 	jassert (numChannels <= eqs.size());
 
-	for (int i=0; i<jmin(numChannels, eqs.size()); ++i)
+	numChannels = jmin(numChannels, eqs.size());
+
+	for (int i=0; i<numChannels; ++i)
 	{
-		float* data = in[i];
-		EqDsp* dsp = eqs.getUnchecked(i);
-		dsp->processBlock(data, numSamples);
+		float weights[EqDsp::kNumTypes];
+		float dryWeight;
+
+		eqs.getUnchecked(i)->getWeights(weights, dryWeight);
+		biquads.setWeights(i, weights, dryWeight);
 	}
+
+	biquads.processBlock(in, numChannels, numSamples);
 }
+
 void MultiEq::setAnalog(bool newAnalog)
 {
 	for (int i=0; i<eqs.size(); ++i)
 		eqs.getUnchecked(i)->setAnalog(newAnalog);
+
+	biquads.setAnalog(newAnalog);
 }
 
 bool MultiEq::getAnalog()
@@ -363,4 +293,19 @@ void MultiEq::setKeepGain(bool keep)
 bool MultiEq::getKeepGain()
 {
 	return eqs.size() > 0 ? eqs.getUnchecked(0)->getKeepGain() : false;
-}
\ No newline at end of file
+}
+
+void MultiEq::setupFilters()
+{
+	if (eqs.size() == 0)
+		return;
+
+	for (int i=0; i<EqDsp::kNumTypes; ++i)
+	{
+		double b[3];
+		double a[3];
+
+		eqs.getUnchecked(0)->getCoeffs((EqDsp::Type) i, b, a);
+		biquads.setCoeffs(i, b[0], b[1], b[2], a[1], a[2]);
+	}
+}
\ No newline at end of file
@@ -15,7 +15,11 @@
 //==============================================================================
 PitchedDelayAudioProcessor::PitchedDelayAudioProcessor()
 : currentTab(-1),
-	showTooltips(true)
+	showTooltips(true),
+	jobGeneration(0),
+	jobInL(nullptr),
+	jobInR(nullptr),
+	jobNumSamples(0)
 {
 	for (int i=0; i<NUMDELAYTABS; ++i)
 	{
@@ -32,6 +36,7 @@ PitchedDelayAudioProcessor::PitchedDelayAudioProcessor()
 
 PitchedDelayAudioProcessor::~PitchedDelayAudioProcessor()
 {
+	tabWorkers.clear();
 }
 
 //==============================================================================
@@ -320,14 +325,87 @@ void PitchedDelayAudioProcessor::prepareToPlay (double sampleRate, int samplesPe
 	const int latency = delays[0]->getLatencySamples() / underSampling;
 	setLatencySamples(latency);
 	latencyCompensation.setLength(latency);
+
+	// the audio thread takes jobs too
+	const int numWorkers = jmin(NUMDELAYTABS, SystemStats::getNumCpus()) - 1;
+
+	while (tabWorkers.size() < numWorkers)
+		tabWorkers.add(new TabWorker(*this, tabWorkers.size() + 1));
 }
 
 void PitchedDelayAudioProcessor::releaseResources()
 {
+	tabWorkers.clear();
 	upSamplers.clear();
 	downSamplers.clear();
 }
 
+void PitchedDelayAudioProcessor::processTabs(const float* inL, const float* inR, int numSamples)
+{
+	int numJobs = 0;
+
+	for (int i=0; i<NUMDELAYTABS; ++i)
+	{
+		DelayTabDsp* dsp = delays[i];
+
+		if (dsp->isEnabled())
+			activeTabs[numJobs++] = i;
+		else
+			dsp->processBlock(inL, inR, numSamples);
+	}
+
+	if (numJobs < 2 || tabWorkers.size() == 0)
+	{
+		for (int i=0; i<numJobs; ++i)
+			delays[activeTabs[i]]->processBlock(inL, inR, numSamples);
+
+		return;
+	}
+
+	jobInL = inL;
+	jobInR = inR;
+	jobNumSamples = numSamples;
+	jobsDone = 0;
+
+	// The generation keeps a worker that still holds the state of the last
+	// block from taking a job of this one.
+	jobGeneration = (jobGeneration + 1) & 0x7fff;
+	jobState = (jobGeneration << 16) | (numJobs << 8);
+
+	const int numWorkers = jmin(tabWorkers.size(), numJobs - 1);
+
+	for (int i=0; i<numWorkers; ++i)
+		tabWorkers[i]->process();
+
+	// The audio thread never waits for a worker to wake up, it takes whatever
+	// is left itself. It only waits for jobs a worker is already running.
+	processTabJobs();
+
+	while (jobsDone.get() < numJobs)
+		jobsDoneEvent.wait();
+}
+
+void PitchedDelayAudioProcessor::processTabJobs()
+{
+	for (;;)
+	{
+		const int state = jobState.get();
+		const int job = state & 0xff;
+		const int numJobs = (state >> 8) & 0xff;
+
+		if (job >= numJobs)
+			return;
+
+		if (! jobState.compareAndSetBool(state + 1, state))
+			continue;
+
+		delays[activeTabs[job]]->processBlock(jobInL, jobInR, jobNumSamples);
+
+		if (++jobsDone == numJobs)
+			jobsDoneEvent.signal();
+	}
+}
+
 void PitchedDelayAudioProcessor::processBlock (AudioSampleBuffer& buffer, MidiBuffer& /*midiMessages*/)
 {
 	const int numSamples = buffer.getNumSamples();
@@ -357,11 +435,7 @@ void PitchedDelayAudioProcessor::processBlock (AudioSampleBuffer& buffer, MidiBu
 			dspProcR = osBufferR[i+1];
 		}
 
-		for (int i=0; i<NUMDELAYTABS; ++i)
-		{
-			DelayTabDsp* dsp = delays[i];
-			dsp->processBlock(dspProcL, dspProcR, blockSize);
-		}
+		processTabs(dspProcL, dspProcR, blockSize);
 
 		for (int n=0; n<blockSize; ++n)
 		{
@@ -118,11 +118,68 @@ public:
 
 private:	
 
+	// Takes tab jobs next to the audio thread, woken once per block.
+	class TabWorker : public Thread
+	{
+	public:
+		TabWorker(PitchedDelayAudioProcessor& p, int index)
+			: Thread("PitchedDelay tab worker " + String(index)),
+			  processor(p)
+		{
+			startThread(realtimeAudioPriority);
+		}
+
+		~TabWorker()
+		{
+			signalThreadShouldExit();
+			startEvent.signal();
+			stopThread(2000);
+		}
+
+		void process()
+		{
+			startEvent.signal();
+		}
+
+		void run() override
+		{
+			for (;;)
+			{
+				startEvent.wait();
+
+				if (threadShouldExit())
+					return;
+
+				processor.processTabJobs();
+			}
+		}
+
+	private:
+		PitchedDelayAudioProcessor& processor;
+		WaitableEvent startEvent;
+	};
+
+	// Runs every tab on the input. The enabled ones are independent jobs that
+	// the workers and the audio thread take from a shared counter.
+	void processTabs(const float* inL, const float* inR, int numSamples);
+	void processTabJobs();
+
 	float params[kNumParameters];
 	SampleDelay latencyCompensation;
 
 	OwnedArray<DelayTabDsp> delays;
 
+	OwnedArray<TabWorker> tabWorkers;
+	int activeTabs[NUMDELAYTABS];
+	// generation << 16 | number of jobs << 8 | next job
+	Atomic<int> jobState;
+	int jobGeneration;
+	Atomic<int> jobsDone;
+	WaitableEvent jobsDoneEvent;
+	const float* jobInL;
+	const float* jobInR;
+	int jobNumSamples;
+
 	OwnedArray<DownSampler2x> downSamplers;
 	OwnedArray<UpSampler2x> upSamplers;
 	HeapBlock<float> overSampleBuffers;
@@ -24,43 +24,63 @@ public:
 protected:
 };
 
+// Describes a pitch processor without building it, so that the buffers of
+// a PitchBase only exist once a tab really shifts with it.
+class PitchProcType
+{
+public:
+	virtual ~PitchProcType() {}
+
+	virtual PitchBase* create() = 0;
+	virtual int getLatency() = 0;
+	virtual String getName() = 0;
+};
 
-class PitchProcessor
+
+class PitchProcessor : private AsyncUpdater
 {
 public:
 	PitchProcessor() 
-		: currentPitch(-1), pitch(1.f)
+		: currentPitch(-1), pitch(1.f), sampleRate(44100), blockSize(512)
 	{
 	}
 
 	virtual ~PitchProcessor() 
 	{
+		cancelPendingUpdate();
 		pitchProcs.clear();
 	}
 
-	void prepareToPlay(double sampleRate, int blockSize)
+	void prepareToPlay(double sampleRate_, int blockSize_)
 	{
-		
+		sampleRate = sampleRate_;
+		blockSize = blockSize_;
+
 		for (int i=0; i<pitchProcs.size(); ++i)
-			pitchProcs.getUnchecked(i)->prepareToPlay(sampleRate, blockSize);
+		{
+			PitchBase* p = pitchProcs.getUnchecked(i);
+
+			if (p != nullptr)
+				p->prepareToPlay(sampleRate, blockSize);
+		}
 	}
 
 	void processBlock(float* chL, float* chR, int numSamples)
 	{
-		PitchBase* p = pitchProcs[currentPitch];
-
 		ScopedLock lock(processLock);
 
+		PitchBase* p = pitchProcs[currentPitch];
+
 		if (p != 0)
 			p->processBlock(chL, chR, numSamples);
 	}
 
 	void processBlock(float* ch, int numSamples)
 	{
-		PitchBase* p = pitchProcs[currentPitch];
-
 		ScopedLock lock(processLock);
 
+		PitchBase* p = pitchProcs[currentPitch];
+
 		if (p != 0)
 			p->processBlock(ch, numSamples);
 
@@ -68,10 +88,10 @@ public:
 
 	int getLatency()
 	{
-		PitchBase* p = pitchProcs[currentPitch];
+		PitchProcType* t = pitchTypes[currentPitch];
 
-		if (p != 0)
-			return p->getLatency();
+		if (t != 0)
+			return t->getLatency();
 
 		return 0;
 	}
@@ -81,7 +101,12 @@ public:
 		pitch = newPitch;
 
 		for (int i=0; i<pitchProcs.size(); ++i)
-			pitchProcs.getUnchecked(i)->setPitch(newPitch);
+		{
+			PitchBase* p = pitchProcs.getUnchecked(i);
+
+			if (p != nullptr)
+				p->setPitch(newPitch);
+		}
 	}
 
 	virtual void setPitchSemitones(float newPitch)
@@ -89,30 +114,67 @@ public:
 		pitch = pow(2.f, newPitch / 12.f);
 
 		for (int i=0; i<pitchProcs.size(); ++i)
-			pitchProcs.getUnchecked(i)->setPitch(newPitch);
+		{
+			PitchBase* p = pitchProcs.getUnchecked(i);
+
+			if (p != nullptr)
+				p->setPitch(newPitch);
+		}
 	}
 
-	void addPitchProc(PitchBase* newPitch)
+	void addPitchProc(PitchProcType* newType)
 	{
-		jassert(newPitch != nullptr);
+		jassert(newType != nullptr);
 
-		if (newPitch != nullptr)
+		if (newType != nullptr)
 		{
-			newPitch->setPitch(pitch);
-			pitchProcs.add(newPitch);
+			pitchTypes.add(newType);
+			pitchProcs.add(nullptr);
 		}
 	}
 
-	void setPitchProc(int index)
+	// Makes sure the current pitch processor gets built if it was never used.
+	// Building allocates, so parameter changes from any other thread than the
+	// message thread (host automation may come from the audio thread) only
+	// post it. Until it exists hasCurrentPitchProc() stays false.
+	void requestCurrentPitchProc()
+	{
+		if (hasCurrentPitchProc())
+			return;
+
+		MessageManager* mm = MessageManager::getInstanceWithoutCreating();
+
+		if (mm != nullptr && mm->isThisTheMessageThread())
+			createCurrentPitchProc();
+		else
+			triggerAsyncUpdate();
+	}
+
+	bool hasCurrentPitchProc()
 	{
-		jassert(index >= -1 && index < pitchProcs.size());
+		return pitchProcs[currentPitch] != nullptr;
+	}
+
+	void clear()
+	{
+		ScopedLock lock(processLock);
 
 		PitchBase* p = pitchProcs[currentPitch];
 
+		if (p != nullptr)
+			p->clear();
+	}
+
+	void setPitchProc(int index)
+	{
+		jassert(index >= -1 && index < pitchTypes.size());
+
 		if (index != currentPitch)
 		{
 			ScopedLock lock(processLock);
 
+			PitchBase* p = pitchProcs[currentPitch];
+
 			if (p != nullptr)
 				p->clear();
 
@@ -122,7 +184,7 @@ public:
 
 	int getNumPitches() 
 	{
-		return pitchProcs.size();
+		return pitchTypes.size();
 	}
 
 	int getPitchProc()
@@ -132,11 +194,11 @@ public:
 
 	String getPitchName(int index)
 	{
-		PitchBase* p = pitchProcs[index];
-		jassert(p != 0);
+		PitchProcType* t = pitchTypes[index];
+		jassert(t != 0);
 
-		if (p != 0)
-			return p->getName();
+		if (t != 0)
+			return t->getName();
 
 		return "";
 	}
@@ -152,10 +214,35 @@ public:
 	}
 
 private:
+	void handleAsyncUpdate() override
+	{
+		createCurrentPitchProc();
+	}
+
+	void createCurrentPitchProc()
+	{
+		const int index = currentPitch;
+		PitchProcType* t = pitchTypes[index];
+
+		if (t == nullptr || pitchProcs[index] != nullptr)
+			return;
+
+		PitchBase* p = t->create();
+		p->prepareToPlay(sampleRate, blockSize);
+		p->setPitch(pitch);
+
+		ScopedLock lock(processLock);
+		pitchProcs.set(index, p);
+	}
+
+	OwnedArray<PitchProcType> pitchTypes;
+	// same indices as pitchTypes, null until used
 	OwnedArray<PitchBase> pitchProcs;
 	int currentPitch;
 
 	float pitch;
+	double sampleRate;
+	int blockSize;
 
 	CriticalSection processLock;
 
@@ -98,6 +98,7 @@ void DelayTabDsp::setParam(int index, double val)
 
 	case kEnabled:
 		enabled = val > 0.5;
+		delay.setActive(enabled);
 
 		if (! enabled && dataSize > 0)
 			clearData();
@@ -1,6 +1,5 @@
 #include "pitcheddelay.h"
 
-//#include "pitchdiracle.h"
 #include "simpledetune.h"
 
 PitchedDelay::PitchedDelay(float samplerate)
@@ -10,21 +9,17 @@ PitchedDelay::PitchedDelay(float samplerate)
 		pingpong(false),
 		preDelayPitch(false),
 		enablePitch(false),
+		active(false),
+		wasShifting(false),
 		latency(0),
 		currentTime(2),
 		delayL(MAXDELAYSECONDS),
 		delayR(MAXDELAYSECONDS),
 		sizeLastData(0)
 {
-#if 0
-	pitcher.addPitchProc(new PitchDiracLE(PitchDiracLE::kPreview));
-	pitcher.addPitchProc(new PitchDiracLE(PitchDiracLE::kGood));
-	pitcher.addPitchProc(new PitchDiracLE(PitchDiracLE::kBetter));
-	pitcher.addPitchProc(new PitchDiracLE(PitchDiracLE::kBest));
-#endif
-	pitcher.addPitchProc(new Detune("Detune (low-latency)", 256));
-	pitcher.addPitchProc(new Detune("Detune (compromise)", 1024));
-	pitcher.addPitchProc(new Detune("Detune (best)", 4096));
+	pitcher.addPitchProc(new DetuneType("Detune (low-latency)", 256));
+	pitcher.addPitchProc(new DetuneType("Detune (compromise)", 1024));
+	pitcher.addPitchProc(new DetuneType("Detune (best)", 4096));
 
 	prepareToPlay(44100, 512);
 }
@@ -73,11 +68,13 @@ void PitchedDelay::setPitch(double newPitch)
 {
 	// max 3 octave up or down.
 	pitch = jlimit(0.125, 8., newPitch);
+	updatePitcher();
 }
 
 void PitchedDelay::setPitchSemitones(double semitones)
 {
 	pitch = jlimit(0.125, 8., pow(2., semitones / 12.));
+	updatePitcher();
 }
 
 
@@ -141,9 +138,8 @@ void PitchedDelay::processBlock(float* data, int numSamples)
 {
 	if (preDelayPitch)
 	{
-		if (enablePitch)
+		if (usePitcher())
 		{
-			pitcher.setPitch((float) pitch);
 			pitcher.processBlock(data, numSamples);
 		}
 		else
@@ -174,9 +170,8 @@ void PitchedDelay::processBlock(float* data, int numSamples)
 		for (int i=0; i<numSamples; ++i)
 			data[i] = data[i] + lastDataL[i]*feedback;
 
-		if (enablePitch)
+		if (usePitcher())
 		{
-			pitcher.setPitch((float) pitch);
 			pitcher.processBlock(data, numSamples);
 		}
 		else
@@ -204,9 +199,8 @@ void PitchedDelay::processBlock(float* dataL, float* dataR, int numSamples)
 {
 	if (preDelayPitch)
 	{
-		if (enablePitch)
+		if (usePitcher())
 		{
-			pitcher.setPitch((float) pitch);
 			pitcher.processBlock(dataL, dataR, numSamples);
 		}
 		else
@@ -294,9 +288,8 @@ void PitchedDelay::processBlock(float* dataL, float* dataR, int numSamples)
 		}
 
 
-		if (enablePitch)
+		if (usePitcher())
 		{
-			pitcher.setPitch((float) pitch);
 			pitcher.processBlock(dataL, dataR, numSamples);
 
 		}
@@ -417,6 +410,42 @@ void PitchedDelay::setCurrentPitch(int index)
 	pitcher.setPitchProc(index);
 	enablePitch = index >= 0;
 	updateLatency(enablePitch ? pitcher.getLatency() : 0);
+	updatePitcher();
+}
+
+void PitchedDelay::setActive(bool shouldBeActive)
+{
+	active = shouldBeActive;
+	updatePitcher();
+}
+
+void PitchedDelay::updatePitcher()
+{
+	if (active && enablePitch && pitch != 1.)
+		pitcher.requestCurrentPitchProc();
+}
+
+bool PitchedDelay::usePitcher()
+{
+	// at unity pitch the shifter would only add its latency, which unpitchedDelay
+	// does with a plain read. unpitchedDelay is as long as the pitcher latency.
+	const bool shifting = enablePitch && pitch != 1. && pitcher.hasCurrentPitchProc();
+
+	if (shifting != wasShifting)
+	{
+		// don't replay what was left in the path that was idle
+		if (shifting)
+			pitcher.clear();
+		else
+			unpitchedDelay.clearData();
+
+		wasShifting = shifting;
+	}
+
+	if (shifting)
+		pitcher.setPitch((float) pitch);
+
+	return shifting;
 }
 
 void PitchedDelay::clearLastData()
@@ -46,6 +46,9 @@ public:
 	bool getPingPong();
 
 	void setCurrentPitch(int index);
+
+	// An inactive delay never builds its pitch processor
+	void setActive(bool shouldBeActive);
 	StringArray getPitchNames() { return pitcher.getPitchNames(); }
 	int getNumPitches() { return pitcher.getNumPitches(); }
 	int getCurrentPitch() { return pitcher.getPitchProc(); }
@@ -54,6 +57,8 @@ private:
 
 	void updateLatency(int latency);
 	void clearLastData();
+	void updatePitcher();
+	bool usePitcher();
 
 
 	PitchProcessor pitcher;
@@ -65,6 +70,8 @@ private:
 	bool pingpong;
 	bool preDelayPitch;
 	bool enablePitch;
+	bool active;
+	bool wasShifting;
 
 	int latency;
 
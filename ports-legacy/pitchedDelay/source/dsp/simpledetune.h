@@ -58,6 +58,26 @@ private:
 };
 
 
+class DetuneType : public PitchProcType
+{
+public:
+
+	DetuneType(const String& name_, int windowSize_)
+		: name(name_), windowSize(windowSize_)
+	{
+	}
+
+	PitchBase* create() { return new Detune(name, windowSize); }
+	// same as Detune::getLatency(), the window never grows past the buffer it was built with
+	int getLatency() { return windowSize; }
+	String getName() { return name; }
+
+private:
+	String name;
+	int windowSize;
+};
+
+
 
 
 
@@ -6,7 +6,6 @@ struct Analyzer::Data
     Data(int size_);
     void clear();
     void copyFrom (const Data& other);
-    const juce::CriticalSection& getLock() const;
 
     const int size;
     juce::HeapBlock<float> mags;
@@ -14,7 +13,6 @@ struct Analyzer::Data
 
 private:
 
-    juce::CriticalSection lock;
     JUCE_DECLARE_NON_COPYABLE(Data)
 };
 
@@ -41,11 +39,6 @@ void Analyzer::Data::copyFrom (const Data& other)
     }
 }
 
-const juce::CriticalSection& Analyzer::Data::getLock() const
-{
-    return lock;
-}
-
 
 RmsEnvelope::RmsEnvelope (int envsize, double rmsLength, double updatetime)
 : rms (rmsLength), rmsVals (envsize+1), updateTime (updatetime), sampleRate (44100)
@@ -88,8 +81,6 @@ bool RmsEnvelope::process (const float inL, const float inR)
 
 void RmsEnvelope::processBlock (const float* inL, const float* inR, int numSamples)
 {
-	ScopedLock lock(processLock);
-
 	const int ovSize = int(updateTime * sampleRate);
 
 	jassert(ovSize > 100);
@@ -122,11 +113,6 @@ bool RmsEnvelope::getData (Array<float>& data) const
 
 	if (data.size() < dataLength)
 	{
-		ScopedTryLock lock(processLock);
-
-		if (! lock.isLocked())
-			return false;
-
 		for (int i=0; i<data.size(); ++i)
 			data.getReference(i) = rmsVals[i];
 
@@ -180,15 +166,8 @@ int Analyzer::getNumBins() const
 
 bool Analyzer::getData (Data& d) const
 {
-	ScopedTryLock lock(data->getLock());
-
-	if (lock.isLocked())
-	{
-		d.copyFrom(*data);
-		return true;
-	}
-
-	return false;
+	d.copyFrom(*data);
+	return true;
 }
 
 void Analyzer::setSampleRate (double newSampleRate)
@@ -200,9 +179,9 @@ void Analyzer::setSampleRate (double newSampleRate)
 		fftBlockSize = 512 * jmax(1, int(sampleRate / 44100));
 		numBins = fftBlockSize / 2 + 1;
 
-		fft = new ffft::FFTReal<float> (fftBlockSize);
+		fft.init(fftBlockSize);
 		x.realloc(fftBlockSize);
-		f.realloc(fftBlockSize);
+		f.setSize(numBins);
 		window.realloc(fftBlockSize);
 		data = new Data(numBins);
 
@@ -227,25 +206,21 @@ double Analyzer::getSampleRate() const
 
 void Analyzer::processFFT()
 {
-	fft->do_fft(f, x);
+	fft.forward(x, f.re, f.im);
 
-	const int imagOffset = fftBlockSize / 2;
 	const float weight = 1.f / fftBlockSize;
 
-	{
-		ScopedLock lock(data->getLock());
-
-		data->mags[0] = f[0]*f[0] * weight;
-		data->mags[imagOffset] = f[imagOffset]*f[imagOffset] * weight;
-		data->angles[0] = 0;
-		data->angles[numBins-1] = 0;
+	data->mags[0] = f.re[0]*f.re[0] * weight;
+	data->mags[numBins-1] = f.re[numBins-1]*f.re[numBins-1] * weight;
+	data->angles[0] = 0;
+	data->angles[numBins-1] = 0;
 
-		for (int i=1; i<numBins-1; ++i)
-		{
-			const float re = f[i];
-			const float im = f[imagOffset + i];
-			data->mags[i] = (re*re + im*im) * weight;
-			data->angles[i] = atan2(im, re);
-		}
+	for (int i=1; i<numBins-1; ++i)
+	{
+		// the phase display works on the conjugated spectrum
+		const float re = f.re[i];
+		const float im = -f.im[i];
+		data->mags[i] = (re*re + im*im) * weight;
+		data->angles[i] = atan2(im, re);
 	}
 }
@@ -3,7 +3,12 @@
 
 #include "JuceHeader.h"
 #include "Buffers.h"
-#include "ffft/FFTReal.h"
+#include "SharedFFT.h"
+
+/*
+	RmsEnvelope and Analyzer are not thread safe: feed and read them on the same
+	thread, the consumer side of an analysis tap (see RefineAnalysis).
+*/
 
 class RmsEnvelope
 {
@@ -27,8 +32,6 @@ private:
 	double sampleRate;
 	int updateIndex;
 
-	juce::CriticalSection processLock;
-
 	JUCE_DECLARE_NON_COPYABLE (RmsEnvelope)
 };
 
@@ -55,9 +58,9 @@ private:
 
 	void processFFT();
 
-	juce::ScopedPointer<ffft::FFTReal<float> > fft;
+	sharedfft::RealFFT fft;
 	juce::HeapBlock<float> x;
-	juce::HeapBlock<float> f;
+	sharedfft::SplitComplex f;
 	juce::HeapBlock<float> window;
 	juce::ScopedPointer<Data> data;
 
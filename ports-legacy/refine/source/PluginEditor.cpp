@@ -10,7 +10,8 @@ ReFinedAudioProcessorEditor::ReFinedAudioProcessorEditor (ReFinedAudioProcessor&
       greenSlider (ImageCache::getFromMemory(BinaryData::green_png, BinaryData::green_pngSize), ImageCache::getFromMemory (BinaryData::vu_green_png, BinaryData::vu_green_pngSize), *p.parameters, "green"),
       blueSlider (ImageCache::getFromMemory(BinaryData::blue_png, BinaryData::blue_pngSize), ImageCache::getFromMemory(BinaryData::vu_blue_png, BinaryData::vu_blue_pngSize), *p.parameters, "blue"),
       x2Button (*p.parameters, "x2"),
-      visualisation (p.getDsp())
+      analysis (p.getDsp()),
+      visualisation (analysis)
 {
     setLookAndFeel(refinedLookAndFeel);
 
@@ -59,10 +60,11 @@ void ReFinedAudioProcessorEditor::resized()
 
 void ReFinedAudioProcessorEditor::timerCallback()
 {
-    const RefineDsp& dsp(processor.getDsp());
-    const float transient = dsp.getTransient();
-    const float nonTransient = dsp.getNonTransient();
-    const float level = dsp.getLevel();
+    analysis.update();
+
+    const float transient = analysis.getTransient();
+    const float nonTransient = analysis.getNonTransient();
+    const float level = analysis.getLevel();
 
     redSlider.setVuValue(nonTransient);
     greenSlider.setVuValue(level);
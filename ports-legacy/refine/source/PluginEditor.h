@@ -28,6 +28,7 @@ private:
     RefinedSlider blueSlider;
     X2Button x2Button;
 
+    RefineAnalysis analysis;
     Visualisation visualisation;    
 
     SharedResourcePointer<RefineLookAndFeel> refinedLookAndFeel;
@@ -34,7 +34,7 @@ public:
     void getStateInformation (MemoryBlock& destData) override;
     void setStateInformation (const void* data, int sizeInBytes) override;
 
-    const RefineDsp& getDsp() const { return dsp; }
+    RefineDsp& getDsp() { return dsp; }
 
     ScopedPointer<AudioProcessorValueTreeState> parameters;
 
@@ -11,12 +11,9 @@ RefineDsp::RefineDsp()
   auxHighL (auxSize),
   auxLowR (auxSize),
   auxHighR (auxSize),
-  rms300 (static_cast<int> (44100*0.3)),
-  rms5 (static_cast<int> (44100*0.005)),
-  rms (400, 100, 0.025),
-  colors (1),
   delayL (512),
-  delayR (512)
+  delayR (512),
+  tap (2, 1 << 16)
 {
 	setSampleRate(44100);
 	clear();
@@ -31,13 +28,6 @@ void RefineDsp::clear()
 	levelSlow.clear();
 	levelMid.clear();
 	levelFast.clear();
-	levelHold.clear();
-
-	rms300.clear();
-	rms5.clear();
-	transient = 0;
-	nonTransient = 0;
-	level = 0;
 }
 
 void RefineDsp::setBlockSize (int newBlockSize)
@@ -58,9 +48,6 @@ void RefineDsp::setSampleRate (double newSampleRate)
 	{
 		sampleRate = newSampleRate;
 
-		rms.setSampleRate(sampleRate);
-		colors.setSize(rms.getDataLength()+1);
-
 		lowL.setFilter(BiquadType::kBandPass, 80.f, 0.5f);
 		lowR.setFilter(BiquadType::kBandPass, 80.f, 0.5f);
 
@@ -71,10 +58,6 @@ void RefineDsp::setSampleRate (double newSampleRate)
 		levelMid.setFilter(BiquadType::kLowPass, 50, sqrt(0.5));
 		levelFast.setFilter(BiquadType::kLowPass, 200, sqrt(0.5));
 
-		rms300.setSize(int(0.3*sampleRate));
-		rms5.setSize(int(0.02*sampleRate));
-		trSmooth.setSampleRate(sampleRate, 0.3);
-
 		delayL.setSize(512 * int(sampleRate / 44100));
 		delayR.setSize(512 * int(sampleRate / 44100));
 	}
@@ -114,71 +97,22 @@ void RefineDsp::processBlock (float* dataL, float* dataR, int numSamples)
 	if (dataR != nullptr)
 		delayR.processBlock(dataR, numSamples);
 
-	{
-		ScopedLock lock(processLock);
-
-		if (dataR != nullptr)
-			levelHold.processBlock(dataL, dataR, numSamples);
-		else
-			levelHold.processBlock(dataL, dataL, numSamples);
-
-		const float release = 1.f - 1.f / float(sampleRate * 0.001 * 100);
-
-		if (dataR == nullptr)
-			dataR = dataL; 
-
-		for (int i=0; i<numSamples; ++i)
-		{
-			if (std::abs(dataL[i]) < 1e-8f)
-				dataL[i] = 0;
-
-			if (std::abs(dataR[i]) < 1e-8f)
-				dataR[i] = 0;
-
-			float x = 0.5f * (dataL[i] + dataR[i]);
-
-			if (x > -1e-4f && x < 1e-4f)
-				x = 0;
-
-			double r300 = rms300.process(x);	
-
-			if (r300 != 0. && r300 < 1e-8f)
-			{
-				rms300.clear();
-				r300 = 0;
-			}
-
-			double r5 = rms5.process(x);
+	if (dataR == nullptr)
+		dataR = dataL; 
 
-			if (r5 != 0. && r5 < 1e-8f)
-			{
-				r5 = 0;
-				rms5.clear();
-			}
-
-			const float y = r300 > 0 ? (float) jlimit(0., 1., (r5 / r300 - 1.)) : 0.f;
-
-			trSmooth.processAttack(y*y);
-		
-			const float lHold = levelHold.getValue();			
-			const float r300s = (float) sqrt(jmax(0., r300));
-			level = lHold > 0 ? jlimit(0.f, 1.f, 1.4142f * r300s / lHold) : 0;
-		
-			jassert(level >= 0 && level < 1e8);
-
-			const float newTrans = jmin(1.f, trSmooth.getValue()) * jmin<float>(1.f, sqrt(level) * 20.f);
-			transient = newTrans > transient ? newTrans : transient * release;
-
-			const float newNonTransient = (1 - pow(newTrans, 0.2f)) * jmin<float>(1.f, sqrt(level) * 20.f);
-			nonTransient = newNonTransient > nonTransient ? newNonTransient : nonTransient * release;
+	for (int i=0; i<numSamples; ++i)
+	{
+		if (std::abs(dataL[i]) < 1e-8f)
+			dataL[i] = 0;
 
-			colorProc.add(transient, nonTransient, level);
+		if (std::abs(dataR[i]) < 1e-8f)
+			dataR[i] = 0;
+	}
 
-			if (rms.process(dataL[i], dataR[i]))
-			{
-				colors.push(colorProc.getColor());
-			}
-		}
+	// the meters and the display are computed by RefineAnalysis, on the editor side
+	{
+		const float* channels[2] = { dataL, dataR };
+		tap.push(channels, 2, numSamples);
 	}
 
 	if (gainLow > 0)
@@ -263,33 +197,165 @@ void RefineDsp::processBlock (float* dataL, float* dataR, int numSamples)
 	}
 }
 
-float RefineDsp::getTransient() const
+double RefineDsp::getSampleRate() const
 {
-	return transient;
+	return sampleRate;
 }
 
-float RefineDsp::getNonTransient() const
+analysistap::AnalysisTap& RefineDsp::getAnalysisTap()
 {
-	return nonTransient;
+	return tap;
 }
 
-float RefineDsp::getLevel() const
+
+RefineAnalysis::RefineAnalysis (RefineDsp& dsp_)
+: dsp (dsp_),
+  tap (dsp_.getAnalysisTap()),
+  sampleRate (0),
+  bufferSize (4096),
+  bufferL (bufferSize),
+  bufferR (bufferSize),
+  rms300 (static_cast<int> (44100*0.3)),
+  rms5 (static_cast<int> (44100*0.005)),
+  rms (400, 100, 0.025),
+  colors (1)
 {
-	return level;
+	setSampleRate(dsp.getSampleRate());
+	clear();
+
+	tap.setActive(true);
+}
+
+RefineAnalysis::~RefineAnalysis()
+{
+	tap.setActive(false);
+}
+
+void RefineAnalysis::setSampleRate (double newSampleRate)
+{
+	if (newSampleRate != sampleRate)
+	{
+		sampleRate = newSampleRate;
+
+		rms.setSampleRate(sampleRate);
+		colors.setSize(rms.getDataLength()+1);
+
+		rms300.setSize(int(0.3*sampleRate));
+		rms5.setSize(int(0.02*sampleRate));
+		trSmooth.setSampleRate(sampleRate, 0.3);
+	}
 }
 
+void RefineAnalysis::clear()
+{
+	levelHold.clear();
 
-bool RefineDsp::getRmsData (Array<float>& d, Array<uint32>& c) const
+	rms300.clear();
+	rms5.clear();
+	transient = 0;
+	nonTransient = 0;
+	level = 0;
+}
+
+void RefineAnalysis::update()
 {
+	if (dsp.getSampleRate() != sampleRate)
+	{
+		setSampleRate(dsp.getSampleRate());
+		clear();
+		tap.discard();
+	}
+
+	float* channels[2] = { bufferL, bufferR };
+
+	for (;;)
 	{
-		ScopedTryLock lock(processLock);
+		const int numSamples = tap.pull(channels, bufferSize);
 
-		if (! lock.isLocked() || c.size() >= colors.getSize())
-			return false;
+		if (numSamples == 0)
+			break;
 
-		for (int i=0; i<c.size(); ++i)
-			c.getReference(i) = colors[i];
+		processBlock(bufferL, bufferR, numSamples);
 	}
+}
+
+void RefineAnalysis::processBlock (const float* dataL, const float* dataR, int numSamples)
+{
+	levelHold.processBlock(dataL, dataR, numSamples);
+
+	const float release = 1.f - 1.f / float(sampleRate * 0.001 * 100);
+
+	for (int i=0; i<numSamples; ++i)
+	{
+		float x = 0.5f * (dataL[i] + dataR[i]);
+
+		if (x > -1e-4f && x < 1e-4f)
+			x = 0;
+
+		double r300 = rms300.process(x);	
+
+		if (r300 != 0. && r300 < 1e-8f)
+		{
+			rms300.clear();
+			r300 = 0;
+		}
+
+		double r5 = rms5.process(x);
+
+		if (r5 != 0. && r5 < 1e-8f)
+		{
+			r5 = 0;
+			rms5.clear();
+		}
+
+		const float y = r300 > 0 ? (float) jlimit(0., 1., (r5 / r300 - 1.)) : 0.f;
+
+		trSmooth.processAttack(y*y);
+	
+		const float lHold = levelHold.getValue();			
+		const float r300s = (float) sqrt(jmax(0., r300));
+		level = lHold > 0 ? jlimit(0.f, 1.f, 1.4142f * r300s / lHold) : 0;
+	
+		jassert(level >= 0 && level < 1e8);
+
+		const float newTrans = jmin(1.f, trSmooth.getValue()) * jmin<float>(1.f, sqrt(level) * 20.f);
+		transient = newTrans > transient ? newTrans : transient * release;
+
+		const float newNonTransient = (1 - pow(newTrans, 0.2f)) * jmin<float>(1.f, sqrt(level) * 20.f);
+		nonTransient = newNonTransient > nonTransient ? newNonTransient : nonTransient * release;
+
+		colorProc.add(transient, nonTransient, level);
+
+		if (rms.process(dataL[i], dataR[i]))
+		{
+			colors.push(colorProc.getColor());
+		}
+	}
+}
+
+float RefineAnalysis::getTransient() const
+{
+	return transient;
+}
+
+float RefineAnalysis::getNonTransient() const
+{
+	return nonTransient;
+}
+
+float RefineAnalysis::getLevel() const
+{
+	return level;
+}
+
+
+bool RefineAnalysis::getRmsData (Array<float>& d, Array<uint32>& c) const
+{
+	if (c.size() >= colors.getSize())
+		return false;
+
+	for (int i=0; i<c.size(); ++i)
+		c.getReference(i) = colors[i];
 
 	return rms.getData(d);
 }
@@ -2,6 +2,7 @@
 #define SEPDSP_H_INCLUDED
 
 #include "JuceHeader.h"
+#include "AnalysisTap.h"
 #include "Analyzer.h"
 #include "Buffers.h"
 #include "MiscDsp.h"
@@ -88,6 +89,60 @@ public:
 
 	void processBlock(float* dataL, float* dataR, int numSamples);
 
+	double getSampleRate() const;
+
+	/** The signal the meters and the display are computed from, read by RefineAnalysis. */
+	analysistap::AnalysisTap& getAnalysisTap();
+
+private:
+
+	double sampleRate;
+
+	float gainLow;
+	float gainMid;
+	float gainHigh;
+    bool x2Mode;
+
+	SimpleNoiseGen noise;
+
+	int auxSize;
+	juce::HeapBlock<float> auxLowL;
+	juce::HeapBlock<float> auxHighL;
+	juce::HeapBlock<float> auxLowR;
+	juce::HeapBlock<float> auxHighR;
+
+	StaticBiquad lowL;
+	StaticBiquad lowR;
+	StaticBiquad highL;
+	StaticBiquad highR;
+
+	StaticBiquad levelSlow;
+	StaticBiquad levelMid;
+	StaticBiquad levelFast;
+
+	CircularBuffer<float> delayL;
+	CircularBuffer<float> delayR;
+
+	analysistap::AnalysisTap tap;
+};
+
+
+/**
+	Transient and level detection for the meters and the display.
+
+	Runs on the editor side: the audio thread only publishes its samples to the
+	RefineDsp analysis tap, and update() pulls them and does the work. The tap
+	is active as long as a RefineAnalysis exists.
+*/
+class RefineAnalysis
+{
+public:
+	RefineAnalysis(RefineDsp& dsp);
+	~RefineAnalysis();
+
+	/** Processes everything the audio thread published since the last call. */
+	void update();
+
 	float getTransient() const;
 	float getNonTransient() const;
 	float getLevel() const;
@@ -136,35 +191,23 @@ private:
 		float level;
 	};
 
+	void setSampleRate(double newSampleRate);
+	void clear();
+	void processBlock(const float* dataL, const float* dataR, int numSamples);
+
+	RefineDsp& dsp;
+	analysistap::AnalysisTap& tap;
 
 	double sampleRate;
 
-	float gainLow;
-	float gainMid;
-	float gainHigh;
-    bool x2Mode;
+	int bufferSize;
+	juce::HeapBlock<float> bufferL;
+	juce::HeapBlock<float> bufferR;
 
 	float transient;
 	float nonTransient;
 	float level;
 
-	SimpleNoiseGen noise;
-
-	int auxSize;
-	juce::HeapBlock<float> auxLowL;
-	juce::HeapBlock<float> auxHighL;
-	juce::HeapBlock<float> auxLowR;
-	juce::HeapBlock<float> auxHighR;
-
-	StaticBiquad lowL;
-	StaticBiquad lowR;
-	StaticBiquad highL;
-	StaticBiquad highR;
-
-	StaticBiquad levelSlow;
-	StaticBiquad levelMid;
-	StaticBiquad levelFast;
-	
 	RmsBuffer rms300;
 	RmsBuffer rms5;
 
@@ -176,10 +219,7 @@ private:
 	CircularBuffer<juce::uint32> colors;
 	ColorProc colorProc;
 
-	CircularBuffer<float> delayL;
-	CircularBuffer<float> delayR;
-
-	juce::CriticalSection processLock;
+	JUCE_DECLARE_NON_COPYABLE(RefineAnalysis)
 };
 
 #endif  // SEPDSP_H_INCLUDED
@@ -1,7 +1,7 @@
 #include "Visualisation.h"
 
-Visualisation::Visualisation (const RefineDsp& dsp)
-    : sepDsp (dsp),
+Visualisation::Visualisation (const RefineAnalysis& analysis_)
+    : analysis (analysis_),
       minMag (-30.f),
       maxMag (0.f)
 {
@@ -46,7 +46,7 @@ void Visualisation::resized()
 
 void Visualisation::timerCallback()
 {
-    if (sepDsp.getRmsData(rmsData, colourData))
+    if (analysis.getRmsData(rmsData, colourData))
     {
 
         float newMin = 10;
@@ -7,7 +7,7 @@
 class Visualisation    : public Component, public Timer
 {
 public:
-    Visualisation (const RefineDsp& dsp);
+    Visualisation (const RefineAnalysis& analysis);
     ~Visualisation();
 
     void paint (Graphics& g);
@@ -17,7 +17,7 @@ public:
 
 private:
 
-    const RefineDsp& sepDsp;
+    const RefineAnalysis& analysis;
     Array<float> rmsData;
     Array<uint32> colourData;
 
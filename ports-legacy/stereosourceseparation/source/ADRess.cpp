@@ -31,8 +31,8 @@ ADRess::ADRess(double sampleRate, int blockSize, int beta):sampleRate_(sampleRat
         frequencyMask_[i] = 1.0;
     
     // initialise FFt
-    fwd_= kiss_fftr_alloc(BLOCK_SIZE,0,NULL,NULL);
-    inv_= kiss_fftr_alloc(BLOCK_SIZE,1,NULL,NULL);
+    fft_.init(BLOCK_SIZE);
+    split_.setSize(BLOCK_SIZE/2+1);
     
     leftSpectrum_ = new complex<float>[BLOCK_SIZE];
     rightSpectrum_ = new complex<float>[BLOCK_SIZE];
@@ -272,8 +272,8 @@ void ADRess::process(float *leftData, float *rightData)
     if (currStatus_ != kBypass) {
         
         // do fft
-        kiss_fftr(fwd_, (kiss_fft_scalar*)leftData,  (kiss_fft_cpx*)leftSpectrum_);
-        kiss_fftr(fwd_, (kiss_fft_scalar*)rightData, (kiss_fft_cpx*)rightSpectrum_);
+        forwardFFT(leftData, leftSpectrum_);
+        forwardFFT(rightData, rightSpectrum_);
         
         // convert complex to magnitude-phase representation
         for (int i = 0; i<BLOCK_SIZE/2+1; i++) {
@@ -309,7 +309,7 @@ void ADRess::process(float *leftData, float *rightData)
             for (int i = 0; i<BLOCK_SIZE/2+1; i++)
                 rightSpectrum_[i] = std::polar(resynMagR_[i], rightPhase_[i]);
             
-            kiss_fftri(inv_, (kiss_fft_cpx*)rightSpectrum_, (kiss_fft_scalar*)rightData);
+            inverseFFT(rightSpectrum_, rightData);
             memcpy(leftData, rightData, BLOCK_SIZE*sizeof(float));
             
             if (currStatus_ == kSolo)
@@ -340,7 +340,7 @@ void ADRess::process(float *leftData, float *rightData)
             for (int i = 0; i<BLOCK_SIZE/2+1; i++)
                 leftSpectrum_[i] = std::polar(resynMagL_[i], leftPhase_[i]);
             
-            kiss_fftri(inv_, (kiss_fft_cpx*)leftSpectrum_, (kiss_fft_scalar*)leftData);
+            inverseFFT(leftSpectrum_, leftData);
             memcpy(rightData, leftData, BLOCK_SIZE*sizeof(float));
             
             if (currStatus_ == kSolo)
@@ -386,12 +386,12 @@ void ADRess::process(float *leftData, float *rightData)
             for (int i = 0; i<BLOCK_SIZE/2+1; i++)
                 rightSpectrum_[i] = std::polar(resynMagR_[i], rightPhase_[i]);
             
-            kiss_fftri(inv_, (kiss_fft_cpx*)rightSpectrum_, (kiss_fft_scalar*)rightData);
+            inverseFFT(rightSpectrum_, rightData);
             
             for (int i = 0; i<BLOCK_SIZE/2+1; i++)
                 leftSpectrum_[i] = std::polar(resynMagL_[i], leftPhase_[i]);
             
-            kiss_fftri(inv_, (kiss_fft_cpx*)leftSpectrum_, (kiss_fft_scalar*)leftData);
+            inverseFFT(leftSpectrum_, leftData);
             
         }
         
@@ -521,4 +521,25 @@ void ADRess::updateFrequencyMask()
         default:
             break;
     }
+}
+
+
+
+void ADRess::forwardFFT(const float* data, complex<float>* spectrum)
+{
+    fft_.forward(data, split_.re, split_.im);
+    
+    for (int i = 0; i<BLOCK_SIZE/2+1; i++)
+        spectrum[i] = complex<float>(split_.re[i], split_.im[i]);
+}
+
+void ADRess::inverseFFT(const complex<float>* spectrum, float* data)
+{
+    for (int i = 0; i<BLOCK_SIZE/2+1; i++) {
+        split_.re[i] = spectrum[i].real();
+        split_.im[i] = spectrum[i].imag();
+    }
+    
+    // unscaled like kiss_fftri, the caller divides by BLOCK_SIZE
+    fft_.inverse(split_.re, split_.im, data);
 }
\ No newline at end of file
@@ -10,8 +10,9 @@
 #define __StereoSourceSeparation__ADRess__
 
 #include <iostream>
-#include "kiss_fftr.h"
+#include "SharedFFT.h"
 #include <cmath>
+#include <cstring>
 #include <complex>
 
 using std::complex;
@@ -67,8 +68,8 @@ private:
     
     int LR_;   // 0 for left, 1 for right, 2 for centre
     
-    kiss_fftr_cfg fwd_;
-    kiss_fftr_cfg inv_;
+    sharedfft::RealFFT fft_;
+    sharedfft::SplitComplex split_;
     
     complex<float>* leftSpectrum_;
     complex<float>* rightSpectrum_;
@@ -96,6 +97,9 @@ private:
     float sumUpPeaks(int nthBin, float* nthBinAzm);
     
     void updateFrequencyMask();
+    
+    void forwardFFT(const float* data, complex<float>* spectrum);
+    void inverseFFT(const complex<float>* spectrum, float* data);
 };
 
 #endif /* defined(__StereoSourceSeparation__ADRess__) */
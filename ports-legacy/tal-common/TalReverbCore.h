@@ -0,0 +1,503 @@
+/*
+	==============================================================================
+	This file is part of Tal-Reverb by Patrick Kunz.
+
+	Copyright(c) 2005-2009 Patrick Kunz, TAL
+	Togu Audio Line, Inc.
+	http://kunz.corrupt.ch
+
+	This file may be licensed under the terms of of the
+	GNU General Public License Version 2 (the ``GPL'').
+
+	Software distributed under the License is distributed
+	on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+	express or implied. See the GPL for the specific language
+	governing rights and limitations.
+
+	You should have received a copy of the GPL along with this
+	program. If not, go to http://www.gnu.org/licenses/gpl.html
+	or write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+	==============================================================================
+ */
+
+#if !defined(__TalReverbCore_h)
+#define __TalReverbCore_h
+
+#include "math.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <emmintrin.h>
+#define TAL_USE_SSE2 1
+#endif
+
+// Delay lines, comb and allpass banks shared by TAL-Reverb-2 and TAL-Reverb-3.
+//
+// All delay lines of a reverb live in one TalDelayArena. The banks keep their
+// per line state as arrays (L lines first, then R lines) and run every line
+// of both channels for a sample before moving on, so that the arithmetic can
+// be done in SIMD lanes and only the delay line reads/writes stay scalar.
+
+class TalDelayArena
+{
+private:
+	float* data;
+	int size;
+
+public:
+	TalDelayArena()
+	{
+		this->data = 0;
+		this->size = 0;
+	}
+
+	~TalDelayArena()
+	{
+		delete[] data;
+	}
+
+	// delay times in milliseconds, same rounding as CombFilter and AllPassFilter
+	static int getLineLength(float delayTime, long sampleRate)
+	{
+		int length = (int)(delayTime * sampleRate / 1000.0f);
+		while (!isPrime(length)) length++;
+		return length;
+	}
+
+	static bool isPrime(int value)
+	{
+		if (value == 0) value = 1;
+		for (int i = 2; i <= sqrtf((float)value); i++)
+		{
+			if (value % i == 0)
+				return false;
+		}
+		return true;
+	}
+
+	// returns the offset of the new line, only valid before allocate()
+	int reserve(int length)
+	{
+		int offset = this->size;
+		this->size += (length + 3) & ~3; // keep every line 16 byte aligned
+		return offset;
+	}
+
+	void allocate()
+	{
+		this->data = new float[size];
+		clear();
+	}
+
+	void clear()
+	{
+		for (int i = 0; i < size; i++)
+			data[i] = 0.0f;
+	}
+
+	float* getLine(int offset)
+	{
+		return data + offset;
+	}
+};
+
+// Modulated, damped comb filters (see CombFilter::processInterpolated) with
+// their delay modulation and diffusion noise (NoiseGenerator) folded in.
+// With SSE2 four lanes are processed at once, LINES has to be a multiple of 4.
+template <int LINES>
+class TalCombBank
+{
+public:
+	static const int LANES = LINES * 2;
+
+private:
+	float* buffer[LANES];
+	int offset[LANES];
+
+	alignas(16) int length[LANES];
+	alignas(16) int writePtr[LANES];
+
+	alignas(16) float z1[LANES];
+	alignas(16) float filterStore[LANES];
+	alignas(16) float minDamp[LANES];
+	alignas(16) float outputGain[LANES];
+	alignas(16) float modulationDepth[LANES];
+
+	// NoiseGenerator::tickFilteredNoise() state, modulates the delay time
+	alignas(16) int delaySeed[LANES];
+	alignas(16) float delayValue[LANES];
+	alignas(16) float delayDelta[LANES];
+	alignas(16) float delayFiltered[LANES];
+
+	// NoiseGenerator::tickFilteredNoiseFast() state, modulates the damping
+	alignas(16) unsigned int diffusionSeed[LANES];
+	alignas(16) float diffusionFiltered[LANES];
+
+	// per sample scratch for the delay line reads and writes
+	alignas(16) int readPtr1[LANES];
+	alignas(16) int readPtr2[LANES];
+	alignas(16) float read1[LANES];
+	alignas(16) float read2[LANES];
+	alignas(16) float written[LANES];
+	alignas(16) float outputs[LANES];
+
+	float filterFactor;
+	float filterFactorInversePlusOne;
+	float periodRange;
+	float periodOffset;
+	float fastFilterValue;
+	float dampFactor;
+
+	static float tickNoise(unsigned int& seed)
+	{
+		seed *= 16807;
+		return (float)(seed & 0x7FFFFFFF) * 4.6566129e-010f;
+	}
+
+	void nextRandomPeriod(int lane, float sign)
+	{
+		unsigned int seed = (unsigned int)delaySeed[lane];
+		int randomPeriod = (int)(tickNoise(seed) * periodRange + periodOffset);
+		delaySeed[lane] = (int)seed;
+		delayDelta[lane] = sign / (float)randomPeriod;
+	}
+
+	inline void checkRandomPeriods()
+	{
+		for (int l = 0; l < LANES; l++)
+		{
+			if (delayValue[l] >= 1.0f) nextRandomPeriod(l, -1.0f);
+			if (delayValue[l] <= 0.0f) nextRandomPeriod(l, 1.0f);
+		}
+	}
+
+	inline void readLines()
+	{
+		for (int l = 0; l < LANES; l++)
+		{
+			read1[l] = buffer[l][readPtr1[l]];
+			read2[l] = buffer[l][readPtr2[l]];
+		}
+	}
+
+	inline void writeLines()
+	{
+		for (int l = 0; l < LANES; l++)
+		{
+			buffer[l][writePtr[l]] = written[l];
+			if (++writePtr[l] >= length[l]) writePtr[l] = 0;
+		}
+	}
+
+public:
+	TalCombBank()
+	{
+		for (int l = 0; l < LANES; l++)
+		{
+			buffer[l] = 0;
+			offset[l] = 0;
+			length[l] = 4;
+			writePtr[l] = readPtr1[l] = readPtr2[l] = 0;
+			z1[l] = filterStore[l] = 0.0f;
+			minDamp[l] = outputGain[l] = 1.0f;
+			modulationDepth[l] = 0.0f;
+			delaySeed[l] = 0;
+			delayValue[l] = delayDelta[l] = delayFiltered[l] = 0.0f;
+			diffusionSeed[l] = 0;
+			diffusionFiltered[l] = 0.0f;
+		}
+
+		setNoise(2800.0f, 25000.0f, 1000.0f, 10.0f);
+		this->dampFactor = 1.0f;
+	}
+
+	// values as in NoiseGenerator, already scaled to the sample rate
+	void setNoise(float filterFactor, float periodRange, float periodOffset, float fastFilterValue)
+	{
+		this->filterFactor = filterFactor;
+		this->filterFactorInversePlusOne = 1.0f / (filterFactor + 1.0f);
+		this->periodRange = periodRange;
+		this->periodOffset = periodOffset;
+		this->fastFilterValue = fastFilterValue;
+	}
+
+	void setDampFactor(float dampFactor)
+	{
+		this->dampFactor = dampFactor;
+	}
+
+	// channel 0 = left, 1 = right, delay time in milliseconds
+	void setLine(TalDelayArena& arena, int channel, int line, float delayTime, long sampleRate,
+		float minDamp, float outputGain, float modulationDepth, int delaySeed, int diffusionSeed)
+	{
+		int l = channel * LINES + line;
+
+		this->length[l] = TalDelayArena::getLineLength(delayTime, sampleRate);
+		this->offset[l] = arena.reserve(this->length[l]);
+		this->minDamp[l] = minDamp;
+		this->outputGain[l] = outputGain;
+		this->modulationDepth[l] = modulationDepth;
+		this->delaySeed[l] = delaySeed;
+		this->diffusionSeed[l] = (unsigned int)diffusionSeed;
+
+		nextRandomPeriod(l, 1.0f);
+
+		// NoiseGenerator draws its first period on construction, whatever it is used for
+		tickNoise(this->diffusionSeed[l]);
+	}
+
+	// call once the arena has been allocated
+	void bind(TalDelayArena& arena)
+	{
+		for (int l = 0; l < LANES; l++)
+			buffer[l] = arena.getLine(offset[l]);
+	}
+
+	// delay, feedback and diffusion [0..1], outputs are overwritten
+	inline void processBlock(const float* inL, const float* inR, float* outL, float* outR, int numSamples,
+		float delay, float feedback, float diffusion)
+	{
+#if TAL_USE_SSE2
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 vDelay = _mm_set1_ps(delay);
+		const __m128 vFeedback = _mm_set1_ps(feedback);
+		const __m128 vDiffusion = _mm_set1_ps(diffusion * dampFactor);
+		const __m128 vFilterFactor = _mm_set1_ps(filterFactor);
+		const __m128 vFilterFactorInv = _mm_set1_ps(filterFactorInversePlusOne);
+		const __m128 vFastFilter = _mm_set1_ps(fastFilterValue);
+		const __m128 vFastFilterPlusOne = _mm_set1_ps(fastFilterValue + 1.0f);
+		const __m128 noiseScale = _mm_set1_ps(4.6566129e-010f);
+		const __m128i noiseMask = _mm_set1_epi32(0x7FFFFFFF);
+		const __m128i multiplier = _mm_set1_epi32(16807);
+		const __m128i intOne = _mm_set1_epi32(1);
+		const __m128i intTwo = _mm_set1_epi32(2);
+
+		for (int i = 0; i < numSamples; i++)
+		{
+			// ----------------- Noise --------------------------
+			int newPeriod = 0;
+			for (int l = 0; l < LANES; l += 4)
+			{
+				__m128 value = _mm_load_ps(delayValue + l);
+				newPeriod |= _mm_movemask_ps(_mm_or_ps(_mm_cmpge_ps(value, one), _mm_cmple_ps(value, zero)));
+			}
+
+			if (newPeriod != 0)
+				checkRandomPeriods();
+
+			for (int l = 0; l < LANES; l += 4)
+			{
+				__m128 value = _mm_add_ps(_mm_load_ps(delayValue + l), _mm_load_ps(delayDelta + l));
+				_mm_store_ps(delayValue + l, value);
+				__m128 filtered = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(_mm_load_ps(delayFiltered + l), vFilterFactor), value), vFilterFactorInv);
+				_mm_store_ps(delayFiltered + l, filtered);
+
+				// 32 bit multiply from two 32x32->64 bit ones, SSE2 has no pmulld
+				__m128i seed = _mm_load_si128((const __m128i*)(diffusionSeed + l));
+				__m128i even = _mm_mul_epu32(seed, multiplier);
+				__m128i odd = _mm_mul_epu32(_mm_srli_epi64(seed, 32), multiplier);
+				seed = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+				_mm_store_si128((__m128i*)(diffusionSeed + l), seed);
+
+				__m128 noise = _mm_mul_ps(_mm_cvtepi32_ps(_mm_and_si128(seed, noiseMask)), noiseScale);
+				__m128 diffusionNoise = _mm_div_ps(_mm_add_ps(_mm_mul_ps(_mm_load_ps(diffusionFiltered + l), vFastFilter), noise), vFastFilterPlusOne);
+				_mm_store_ps(diffusionFiltered + l, diffusionNoise);
+
+				// ----------------- Read positions -----------------
+				__m128i len = _mm_load_si128((const __m128i*)(length + l));
+				__m128 position = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(len, intTwo)),
+					_mm_add_ps(vDelay, _mm_mul_ps(_mm_load_ps(modulationDepth + l), filtered))), one);
+				__m128i intPosition = _mm_cvttps_epi32(position);
+
+				__m128i ptr1 = _mm_sub_epi32(_mm_load_si128((const __m128i*)(writePtr + l)), intPosition);
+				ptr1 = _mm_add_epi32(ptr1, _mm_and_si128(len, _mm_srai_epi32(ptr1, 31)));
+				__m128i ptr2 = _mm_sub_epi32(ptr1, intOne);
+				ptr2 = _mm_add_epi32(ptr2, _mm_and_si128(len, _mm_srai_epi32(ptr2, 31)));
+				_mm_store_si128((__m128i*)(readPtr1 + l), ptr1);
+				_mm_store_si128((__m128i*)(readPtr2 + l), ptr2);
+
+				// keep the fractional part in outputs until the reads are done
+				_mm_store_ps(outputs + l, _mm_sub_ps(one, _mm_sub_ps(position, _mm_cvtepi32_ps(intPosition))));
+			}
+
+			// ----------------- Delay line reads ---------------
+			readLines();
+
+			// ----------------- Comb filters -------------------
+			for (int l = 0; l < LANES; l += 4)
+			{
+				__m128 input = _mm_set1_ps(l < LINES ? inL[i] : inR[i]);
+				__m128 invFrac = _mm_load_ps(outputs + l);
+
+				// interpolate, see paper: http://www.stanford.edu/~dattorro/EffectDesignPart2.pdf
+				__m128 output = _mm_sub_ps(_mm_add_ps(_mm_load_ps(read2 + l), _mm_mul_ps(_mm_load_ps(read1 + l), invFrac)),
+					_mm_mul_ps(invFrac, _mm_load_ps(z1 + l)));
+				_mm_store_ps(z1 + l, output);
+
+				__m128 damp = _mm_mul_ps(_mm_load_ps(minDamp + l), _mm_mul_ps(_mm_load_ps(diffusionFiltered + l), vDiffusion));
+				__m128 store = _mm_add_ps(_mm_mul_ps(output, _mm_sub_ps(one, damp)), _mm_mul_ps(_mm_load_ps(filterStore + l), damp));
+				_mm_store_ps(filterStore + l, store);
+				_mm_store_ps(written + l, _mm_add_ps(input, _mm_mul_ps(store, vFeedback)));
+				_mm_store_ps(outputs + l, _mm_mul_ps(_mm_load_ps(outputGain + l), output));
+			}
+#else
+		for (int i = 0; i < numSamples; i++)
+		{
+			// ----------------- Noise --------------------------
+			bool newPeriod = false;
+			for (int l = 0; l < LANES; l++)
+				newPeriod |= (delayValue[l] >= 1.0f) | (delayValue[l] <= 0.0f);
+
+			if (newPeriod)
+				checkRandomPeriods();
+
+			float invFrac[LANES];
+			for (int l = 0; l < LANES; l++)
+			{
+				delayValue[l] += delayDelta[l];
+				delayFiltered[l] = (delayFiltered[l] * filterFactor + delayValue[l]) * filterFactorInversePlusOne;
+				diffusionFiltered[l] = (diffusionFiltered[l] * fastFilterValue + tickNoise(diffusionSeed[l])) / (fastFilterValue + 1.0f);
+
+				// ----------------- Read positions -----------------
+				float position = (length[l] - 2) * (delay + modulationDepth[l] * delayFiltered[l]) + 1.0f;
+				int intPosition = (int)position;
+				readPtr1[l] = writePtr[l] - intPosition;
+				readPtr1[l] += length[l] & (readPtr1[l] >> 31);
+				readPtr2[l] = readPtr1[l] - 1;
+				readPtr2[l] += length[l] & (readPtr2[l] >> 31);
+				invFrac[l] = 1.0f - (position - (float)intPosition);
+			}
+
+			// ----------------- Delay line reads ---------------
+			readLines();
+
+			// ----------------- Comb filters -------------------
+			for (int l = 0; l < LANES; l++)
+			{
+				float input = l < LINES ? inL[i] : inR[i];
+
+				// interpolate, see paper: http://www.stanford.edu/~dattorro/EffectDesignPart2.pdf
+				float output = read2[l] + read1[l] * invFrac[l] - invFrac[l] * z1[l];
+				z1[l] = output;
+
+				float damp = minDamp[l] * (diffusionFiltered[l] * (diffusion * dampFactor));
+				filterStore[l] = output * (1.0f - damp) + filterStore[l] * damp;
+				written[l] = input + filterStore[l] * feedback;
+				outputs[l] = outputGain[l] * output;
+			}
+#endif
+
+			// ----------------- Delay line writes --------------
+			writeLines();
+
+			float sumL = 0.0f;
+			float sumR = 0.0f;
+			for (int l = 0; l < LINES; l++)
+			{
+				sumL += outputs[l];
+				sumR += outputs[LINES + l];
+			}
+
+			outL[i] = sumL;
+			outR[i] = sumR;
+		}
+	}
+};
+
+// Fixed allpass chain (see AllPassFilter::process) for both channels.
+template <int LINES>
+class TalAllPassBank
+{
+public:
+	static const int LANES = LINES * 2;
+
+private:
+	float* buffer[LANES];
+	int offset[LANES];
+	int length[LANES];
+	int ptr[LANES];
+	float gain;
+
+public:
+	TalAllPassBank()
+	{
+		for (int l = 0; l < LANES; l++)
+		{
+			buffer[l] = 0;
+			offset[l] = length[l] = ptr[l] = 0;
+		}
+		this->gain = 0.68f;
+	}
+
+	void setGain(float gain)
+	{
+		this->gain = gain;
+	}
+
+	// channel 0 = left, 1 = right, delay time in milliseconds
+	void setLine(TalDelayArena& arena, int channel, int line, float delayTime, long sampleRate)
+	{
+		int l = channel * LINES + line;
+		this->length[l] = TalDelayArena::getLineLength(delayTime, sampleRate);
+		this->offset[l] = arena.reserve(this->length[l]);
+	}
+
+	void bind(TalDelayArena& arena)
+	{
+		for (int l = 0; l < LANES; l++)
+			buffer[l] = arena.getLine(offset[l]);
+	}
+
+	// one sample through the whole chain, for topologies with feedback around it
+	inline void process(float* sampleL, float* sampleR)
+	{
+		float outL = *sampleL;
+		float outR = *sampleR;
+
+		for (int n = 0; n < LINES; n++)
+		{
+			outL = tick(n, outL);
+			outR = tick(LINES + n, outR);
+		}
+
+		*sampleL = outL;
+		*sampleR = outR;
+	}
+
+	// whole block, one stage after the other
+	inline void processBlock(float* samplesL, float* samplesR, int numSamples)
+	{
+		for (int l = 0; l < LANES; l++)
+		{
+			float* samples = l < LINES ? samplesL : samplesR;
+			float* line = buffer[l];
+			int p = ptr[l];
+
+			for (int i = 0; i < numSamples; i++)
+			{
+				float temp = line[p];
+				line[p] = gain * temp + samples[i];
+				samples[i] = temp - gain * line[p];
+
+				if (++p >= length[l]) p = 0;
+			}
+
+			ptr[l] = p;
+		}
+	}
+
+private:
+	inline float tick(int l, float input)
+	{
+		float* line = buffer[l];
+		float temp = line[ptr[l]];
+		line[ptr[l]] = gain * temp + input;
+		float output = temp - gain * line[ptr[l]];
+
+		if (++ptr[l] >= length[l]) ptr[l] = 0;
+
+		return output;
+	}
+};
+#endif
@@ -97,4 +97,47 @@ class Decimator9
     R1=h9x0;
     return R10;
   }
+  // in: numSamples*2 values at the oversampled rate, out: numSamples values
+  inline void process(const float *in,float *out,int numSamples)
+  {
+    for (int i=0;i<numSamples;i++)
+    {
+      out[i]=Calc(in[2*i],in[2*i+1]);
+    }
+  }
+};
+
+// Polyphase 2x interpolator with the Decimator9 half band kernel. The even
+// phase is the delayed input, the odd phase a 10 tap symmetric FIR, both run
+// over a contiguous history so the loop has no recursion. Latency is 5 samples.
+class Interpolator9
+{
+  public:
+  static const int MAX_BLOCK_SIZE=64;
+
+  private:
+  static const int HISTORY=9;
+  float x[HISTORY+MAX_BLOCK_SIZE];
+  const float h1,h3,h5,h7,h9;
+
+  public:
+  Interpolator9():h1(2*5042/16384.0f),h3(2*-1277/16384.0f),h5(2*429/16384.0f),h7(2*-116/16384.0f),h9(2*18/16384.0f)
+  {
+    for (int i=0;i<HISTORY;i++) x[i]=0.0f;
+  }
+  // in: numSamples values (<= MAX_BLOCK_SIZE), out: numSamples*2 values
+  inline void process(const float *in,float *out,int numSamples)
+  {
+    float *xn=x+HISTORY;
+    for (int i=0;i<numSamples;i++) xn[i]=in[i];
+
+    for (int i=0;i<numSamples;i++)
+    {
+      const float *xi=x+i;
+      out[2*i]=xi[4];
+      out[2*i+1]=h9*(xi[0]+xi[9])+h7*(xi[1]+xi[8])+h5*(xi[2]+xi[7])+h3*(xi[3]+xi[6])+h1*(xi[4]+xi[5]);
+    }
+
+    for (int i=0;i<HISTORY;i++) x[i]=x[numSamples+i];
+  }
 };
\ No newline at end of file
@@ -25,6 +25,7 @@
 #define __Delay_h
 
 #include "math.h"
+#include "string.h"
 #include "AudioUtils.h"
 #include "Filter6dB.h"
 #include "DCBlock.h"
@@ -64,6 +65,29 @@ private:
 	// Delay time in seconds
 	static const int MAX_DELAY_TIME = 4;
 
+public:
+	static const int MAX_BLOCK_SIZE = 64;
+
+private:
+	// copies numSamples values of the delay line starting at index, wraps once at most
+	inline void readSegment(int index, float *dest, int numSamples)
+	{
+		int first = delayLineLength - index;
+		if (first > numSamples) first = numSamples;
+
+		memcpy(dest, delayLineStart + index, first * sizeof(float));
+		memcpy(dest + first, delayLineStart, (numSamples - first) * sizeof(float));
+	}
+
+	inline void writeSegment(int index, const float *source, int numSamples)
+	{
+		int first = delayLineLength - index;
+		if (first > numSamples) first = numSamples;
+
+		memcpy(delayLineStart + index, source, first * sizeof(float));
+		memcpy(delayLineStart, source + first, (numSamples - first) * sizeof(float));
+	}
+
 public:
 	DelayFx(float sampleRate)
 	{
@@ -271,6 +295,99 @@ public:
 		}
 		return 0.0f;
 	}
+
+	// samples: numSamples (<= MAX_BLOCK_SIZE) values, replaced by the delay output
+	// delays: delay [0..1] for every sample
+	void processBlock(float *samples, const float *delays, int numSamples)
+	{
+		if (isClearingBuffer)
+		{
+			memset(samples, 0, numSamples * sizeof(float));
+			return;
+		}
+
+		bool isConstant = !isFadingOut();
+		for (int i = 1; i < numSamples && isConstant; i++)
+		{
+			isConstant = delays[i] == delays[0];
+		}
+
+		int offsetInt = 0;
+		if (isConstant)
+		{
+			setDelay(delays[0]);
+			currentDelay = delay;
+			offsetInt = (int)floorf((float)delayLineLength * currentDelay);
+		}
+
+		// While the delay moves, fades out or is shorter than the block, a sample
+		// may read what was written earlier in the same block.
+		if (!isConstant || offsetInt < numSamples || offsetInt >= delayLineLength)
+		{
+			for (int i = 0; i < numSamples; i++)
+			{
+				setDelay(delays[i]);
+				samples[i] = process(&samples[i]);
+			}
+			return;
+		}
+
+		float frac = (float)delayLineLength * currentDelay - offsetInt;
+		float allpass = 1.0f - frac;
+		float feedback = this->feedback;
+		float highCut = this->highCut;
+
+		// delayed samples of the block, one more for the interpolation
+		float delayedValues[MAX_BLOCK_SIZE + 1];
+
+		int writeIndex = (int)(writePointer - delayLineStart);
+		int readIndex = writeIndex - offsetInt - 1;
+		if (readIndex < 0)
+			readIndex += delayLineLength;
+
+		readSegment(readIndex, delayedValues, numSamples + 1);
+
+		// Local copies keep the filter states in registers for the block. The
+		// recursions stay in one loop so they run next to each other. Only the
+		// filter state goes back, a cutoff set during the block must survive.
+		// DCBlock has no coefficients, its cutoff is passed per sample.
+		DCBlock dc = *dcBlock;
+		Filter6dB filter = *filter6dB;
+		float z = z1;
+		float peakReduction = 0.0f;
+
+		for (int i = 0; i < numSamples; i++)
+		{
+			z = delayedValues[i] + allpass * (delayedValues[i + 1] - z);
+
+			// Filters
+			float valueWithFeedback = samples[i] + z * feedback;
+			dc.tick(&valueWithFeedback, highCut);
+			filter.process(&valueWithFeedback);
+
+			// Stauration
+			float valueWithFeedbackNotShaped = valueWithFeedback;
+			valueWithFeedback = audioUtils.tanhApp(valueWithFeedback);
+
+			float reduction = fabsf(valueWithFeedbackNotShaped - valueWithFeedback);
+			if (reduction > peakReduction) peakReduction = reduction;
+
+			samples[i] = z;
+			delayedValues[i] = valueWithFeedback;
+		}
+
+		z1 = z;
+		*dcBlock = dc;
+		filter6dB->copyStateFrom(filter);
+		setPeakReductionValue(peakReduction);
+
+		writeSegment(writeIndex, delayedValues, numSamples);
+
+		writeIndex += numSamples;
+		if (writeIndex >= delayLineLength)
+			writeIndex -= delayLineLength;
+		writePointer = delayLineStart + writeIndex;
+	}
 };
 
 #endif
\ No newline at end of file
@@ -25,20 +25,24 @@
 #define __DelayHandler_h_
 
 #include "Decimator.h"
-#include "interpolatorlinear.h"
 #include "Delay.h"
 #include "AudioUtils.h"
 #include "TapeSlider.h"
 
 class DelayHandler
 {
+public:
+	// input samples processed at once, the delay runs twice as many
+	static const int BLOCK_SIZE = DelayFx::MAX_BLOCK_SIZE / 2;
+
 private:
 	Decimator9 *decimator;
-	InterpolatorLinear *interpolatorLinear;
+	Interpolator9 *interpolator;
 	TapeSlider* tapeSlider;
 	DelayFx* delay;
 
-	float *upsampledValues;
+	float upsampledValues[BLOCK_SIZE * 2];
+	float delayTimes[BLOCK_SIZE * 2];
 	float delayTime;
 
 	bool liveMode;
@@ -49,8 +53,7 @@ public:
 	DelayHandler(float sampleRate) 
 	{
 		decimator = new Decimator9();
-		interpolatorLinear = new InterpolatorLinear();
-		upsampledValues = new float[2];
+		interpolator = new Interpolator9();
 
 		// twice oversampled
 		delay = new DelayFx(sampleRate * 2);
@@ -62,7 +65,8 @@ public:
 	~DelayHandler()
 	{
 		delete decimator;
-		delete interpolatorLinear;
+		delete interpolator;
+		delete tapeSlider;
 		delete delay;
 	}
 
@@ -110,23 +114,27 @@ public:
 		return delay->getPeakReductionValue();
 	}
 
-	inline void process(float *input) 
+	void processBlock(float *samples, int numSamples)
 	{
-		if (!liveMode)
+		while (numSamples > 0)
 		{
-			delay->setDelay(tapeSlider->tick(this->delayTime));
+			int blockSize = numSamples;
+			if (blockSize > BLOCK_SIZE) blockSize = BLOCK_SIZE;
+
+			for (int i = 0; i < blockSize; i++)
+			{
+				float value = liveMode ? this->delayTime : tapeSlider->tick(this->delayTime);
+				delayTimes[2 * i] = value;
+				delayTimes[2 * i + 1] = value;
+			}
+
+			interpolator->process(samples, upsampledValues, blockSize);
+			delay->processBlock(upsampledValues, delayTimes, blockSize * 2);
+			decimator->process(upsampledValues, samples, blockSize);
+
+			samples += blockSize;
+			numSamples -= blockSize;
 		}
-		else
-		{
-			delay->setDelay(this->delayTime);
-		}
-		interpolatorLinear->process2x(*input, upsampledValues);
-	
-		// limit signal
-		upsampledValues[0] = delay->process(&upsampledValues[0]);
-		upsampledValues[1] = delay->process(&upsampledValues[1]);
-
-		*input = decimator->Calc(upsampledValues[0], upsampledValues[1]);
 	}
 };
 #endif
@@ -215,27 +215,45 @@ public:
 			delete delayHandlerTmpR;
 	}
 
-	void process(float *sampleL, float *sampleR) 
+	// samplesL and samplesR may be the same buffer for mono
+	void processBlock(float *samplesL, float *samplesR, int numSamples) 
 	{
-		float random = (float)rand()/RAND_MAX * 0.00000002f;
-		float inputL = *sampleL + random;
-		float inputR = *sampleR + random;
+		float inputL[DelayHandler::BLOCK_SIZE];
+		float inputR[DelayHandler::BLOCK_SIZE];
 
-		//float cutoff = cutoffParamChange->tick(param[CUTOFF]);
+		while (numSamples > 0)
+		{
+			int blockSize = numSamples;
+			if (blockSize > DelayHandler::BLOCK_SIZE) blockSize = DelayHandler::BLOCK_SIZE;
+
+			for (int i = 0; i < blockSize; i++)
+			{
+				float random = (float)rand()/RAND_MAX * 0.00000002f;
+				inputL[i] = samplesL[i] + random;
+				inputR[i] = samplesR[i] + random;
+
+				samplesL[i] *= inputDrive;
+				samplesR[i] *= inputDrive;
+			}
 
-		*sampleL *= inputDrive;
-		*sampleR *= inputDrive;
+			// process filter
+			delayHandlerL->processBlock(samplesL, blockSize);
+			delayHandlerR->processBlock(samplesR, blockSize);
 
-		// process filter
-		delayHandlerL->process(sampleL);
-		delayHandlerR->process(sampleR);
+			// dry / wet mix
+			for (int i = 0; i < blockSize; i++)
+			{
+				samplesL[i] = samplesL[i] * wet;
+				samplesR[i] = samplesR[i] * wet;
 
-		// dry / wet mix
-		*sampleL = *sampleL * wet;
-		*sampleR = *sampleR * wet;
+				samplesL[i] += inputL[i] * dry;
+				samplesR[i] += inputR[i] * dry;
+			}
 
-		*sampleL += inputL * dry;
-		*sampleR += inputR * dry;
+			samplesL += blockSize;
+			samplesR += blockSize;
+			numSamples -= blockSize;
+		}
 	}
 };
 #endif
@@ -74,6 +74,17 @@ public:
 		k2vg= v2*(1.0f-(1.0f+tmp+tmp*tmp*0.5f+tmp*tmp*tmp*0.16666667f+tmp*tmp*tmp*tmp*0.0416666667f+tmp*tmp*tmp*tmp*tmp*0.00833333333f));
 	}
 
+	// Takes over the filter memory of another instance, the coefficients stay as they are.
+	void copyStateFrom(const Filter6dB &other)
+	{
+		ay1 = other.ay1;
+		ay2 = other.ay2;
+		amf = other.amf;
+		az1 = other.az1;
+		az2 = other.az2;
+		at1 = other.at1;
+	}
+
 	inline void process(float *input) 
 	{
 		// Filter based on the text "Non linear digital implementation of the moog ladder filter" by Antti Houvilainen
@@ -296,7 +296,7 @@ public:
 
         switch(param)
         {
-        case VOICES: numItems = 6; break;
+        case VOICES: numItems = NUMBER_OF_VOICES_MAX; break;
         case PORTAMENTOMODE: numItems = 3; break;
         case LFO1DESTINATION: numItems = 8; break;
         case LFO2DESTINATION: numItems = 8; break;
@@ -24,6 +24,11 @@
 #ifndef Params_H
 #define Params_H
 
+// Steps of the voices parameter, mono up to this many voices. Presets store
+// the parameter normalized over this range, changing it needs a new preset
+// version (see TalCore::setXmlPrograms).
+#define NUMBER_OF_VOICES_MAX 16
+
 enum SYNTHPARAMETERS
 {
 	// Controllable values [0.0..1.0]
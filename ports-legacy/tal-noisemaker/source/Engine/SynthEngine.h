@@ -51,6 +51,7 @@ private:
 	float cutoff;
 
 	VoiceManager* voiceManager;
+	SynthVoice* activeVoices[VoiceManager::MAX_VOICES];
 	ParamChangeUtil *cutoffFiltered;
 	LfoHandler1 *lfoHandler1;
 	LfoHandler2 *lfoHandler2;
@@ -860,7 +861,28 @@ public:
 		} 
     }
 
-	void process(float *sampleL, float *sampleR) 
+	// Renders numSamples without any note or parameter change in between,
+	// so the voices that are idle at the start stay idle for the whole block.
+	void processBlock(float *samplesL, float *samplesR, int numSamples)
+	{
+		int numberOfActiveVoices = 0;
+		SynthVoice** voices = voiceManager->getAllVoices();
+		for (int i = 0; i < voiceManager->MAX_VOICES; i++)
+		{
+			if (!voices[i]->isIdle())
+			{
+				activeVoices[numberOfActiveVoices++] = voices[i];
+			}
+		}
+
+		for (int i = 0; i < numSamples; i++)
+		{
+			process(samplesL + i, samplesR + i, numberOfActiveVoices);
+		}
+	}
+
+private:
+	inline void process(float *sampleL, float *sampleR, int numberOfActiveVoices)
 	{
         float denormalNoise = this->denormalNoise->getNextSample() * 0.00000001f;
 		*sampleL = denormalNoise;
@@ -871,10 +893,9 @@ public:
 
 		// Process voices
 		bool playingNotes = false;
-        SynthVoice** voices = voiceManager->getAllVoices();
-		for (int i = 0; i < voiceManager->MAX_VOICES; i++)
+		for (int i = 0; i < numberOfActiveVoices; i++)
 		{
-			playingNotes |= voices[i]->process(sampleL, sampleR, cutoff);
+			playingNotes |= activeVoices[i]->process(sampleL, sampleR, cutoff);
 		}
 
         highPass->tick(sampleL);
@@ -216,6 +216,13 @@ public:
 		return this->ampAdsr->isNotePlaying(isNoteOn);
 	}
 
+	// No note and the filter is prepared for the next one, process() would
+	// only count. Only a note on can change this.
+	bool isIdle()
+	{
+		return !this->isNotePlaying() && countPostFilter >= 2000;
+	}
+
 	void setNoteOn(int note, bool slide, float velocity)
 	{
 		switch (portamentoMode)
@@ -79,11 +79,8 @@ TalComponent::TalComponent (TalCore* const ownerFilter)
 
     voicesTalComboBox = addTalComboBox(this->synth1AccordeonTab, 595, 130, 60, ownerFilter, VOICES);
 	voicesTalComboBox->addItem("mono",1);
-	voicesTalComboBox->addItem("2",2);
-	voicesTalComboBox->addItem("3",3);
-	voicesTalComboBox->addItem("4",4);
-	voicesTalComboBox->addItem("5",5);
-	voicesTalComboBox->addItem("6",6);
+	for (int i = 2; i <= NUMBER_OF_VOICES_MAX; i++)
+		voicesTalComboBox->addItem(String(i),i);
 
     portamentoModeTalComboBox = addTalComboBox(this->synth1AccordeonTab, 595, 107, 60, ownerFilter, PORTAMENTOMODE);
 	portamentoModeTalComboBox->addItem("Off",1);
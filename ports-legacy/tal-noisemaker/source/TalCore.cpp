@@ -594,15 +594,21 @@ void TalCore::processBlock (AudioSampleBuffer& buffer, MidiBuffer& midiMessages)
         float *samples0 = buffer.getWritePointer(0);
         float *samples1 = buffer.getWritePointer(1);
 
+        // render the samples between two midi events in one go
         int samplePos = 0;
         int numSamples = buffer.getNumSamples();
-        while (numSamples > 0)
+        while (samplePos < numSamples)
         {
             processMidiPerSample(&midiIterator, samplePos);
-            engine->process(samples0++, samples1++);
 
-            numSamples--;
-            samplePos++;
+            int nextEventPos = numSamples;
+            if (hasMidiMessage && midiEventPos < numSamples)
+            {
+                nextEventPos = midiEventPos;
+            }
+
+            engine->processBlock(samples0 + samplePos, samples1 + samplePos, nextEventPos - samplePos);
+            samplePos = nextEventPos;
         }
     }
 }
@@ -663,7 +669,7 @@ void TalCore::getStateInformation (MemoryBlock& destData)
     // header
     XmlElement tal("tal");
     tal.setAttribute ("curprogram", curProgram);
-    tal.setAttribute ("version", 1.7);
+    tal.setAttribute ("version", 1.8);
 
     // programs
     XmlElement *programList = new XmlElement ("programs");
@@ -689,7 +695,7 @@ void TalCore::getCurrentProgramStateInformation (MemoryBlock& destData)
     // header
     XmlElement tal("tal");
     tal.setAttribute ("curprogram", curProgram);
-    tal.setAttribute ("version", 1.7);
+    tal.setAttribute ("version", 1.8);
 
     // programs
     XmlElement *programList = new XmlElement ("programs");
@@ -1042,6 +1048,13 @@ void TalCore::setXmlPrograms(XmlElement* e, int programNumber, float version)
             talPresets[programNumber]->programData[FILTERTYPE] = audioUtils.calcComboBoxValueNormalized(filtertypeOld, FILTERTYPE);
         }
 
+        if (version >= 1.6f && version < 1.8f)
+        {
+            // voices went from 6 to NUMBER_OF_VOICES_MAX steps
+            int voicesOld = (int)floorf(talPresets[programNumber]->programData[VOICES] * (6 - 1.0f) + 1.0f + 0.5f);
+            talPresets[programNumber]->programData[VOICES] = audioUtils.calcComboBoxValueNormalized(voicesOld, VOICES);
+        }
+
         EnvelopePresetUtility utility;
         Array<SplinePoint*> splinePoints = utility.getEnvelopeFromXml(e);
         talPresets[programNumber]->setPoints(splinePoints);
@@ -1059,7 +1072,7 @@ String TalCore::getStateInformationString ()
     // header
     XmlElement tal("tal");
     tal.setAttribute ("curprogram", curProgram);
-    tal.setAttribute ("version", 1.7);
+    tal.setAttribute ("version", 1.8);
 
     // programs
     XmlElement *programList = new XmlElement ("programs");
@@ -63,7 +63,7 @@ class TalPreset
 
         programData[AMPSUSTAIN] = 1.0f;
 
-        programData[VOICES] = 1.0f;
+        programData[VOICES] = (6.0f - 1.0f) / (NUMBER_OF_VOICES_MAX - 1.0f);
         programData[PORTAMENTOMODE] = 1.0f;
 
         programData[LFO1AMOUNT] = 0.5f;
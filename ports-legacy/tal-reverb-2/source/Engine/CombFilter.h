@@ -37,17 +37,19 @@ private:
 	float z1;
 	int bufferLengthDelay;
 	float filterStore;
+	bool ownsBuffer;
 
 	AudioUtils audioUtils;
 
 public:
-	// delay times in milliseconds
-	CombFilter(float delayTime, float minDamp, long samplingRate)
+	// delay times in milliseconds, an external buffer (a TalDelayArena line) is not owned
+	CombFilter(float delayTime, float minDamp, long samplingRate, float* externalBuffer = 0)
 	{
 		//OutputDebugString("start init combfilter");
 		bufferLengthDelay = (int)(delayTime * samplingRate / 1000);
 		bufferLengthDelay = audioUtils.getNextNearPrime(bufferLengthDelay);
-		buffer = new float[bufferLengthDelay];
+		ownsBuffer = externalBuffer == 0;
+		buffer = ownsBuffer ? new float[bufferLengthDelay] : externalBuffer;
 
 		// Print out samples
 		//File *file = new File("d:/delaytimes.txt");
@@ -69,7 +71,7 @@ public:
 
 	~CombFilter()
 	{
-		delete buffer;
+		if (ownsBuffer) delete[] buffer;
 	}
 
 	// delayIntensity [0..1]
@@ -32,9 +32,13 @@
 #include "math.h"
 #include "AudioUtils.h"
 #include "TalEq.h"
+#include "TalReverbCore.h"
 
 class TalReverb
 {
+public:
+	static const int BLOCK_SIZE = 256;
+
 private:
 	static const int DELAY_LINES_COMB = 4;
 	static const int DELAY_LINES_ALLPASS = 5;
@@ -43,20 +47,17 @@ private:
 	float* reflectionGains;
 	float* reflectionDelays;
 
+	// every delay line below lives in here
+	TalDelayArena delayArena;
+
 	CombFilter *combFiltersPreDelayL;
 	CombFilter *combFiltersPreDelayR;
 
-	CombFilter **combFiltersL;
-	CombFilter **combFiltersR;
-	NoiseGenerator **noiseGeneratorAllPassL;
-	NoiseGenerator **noiseGeneratorAllPassR;
-	NoiseGenerator **noiseGeneratorDelayL;
-	NoiseGenerator **noiseGeneratorDelayR;
-	NoiseGenerator **diffusionL;
-	NoiseGenerator **diffusionR;
+	TalCombBank<DELAY_LINES_COMB> combFilters;
+	TalAllPassBank<DELAY_LINES_ALLPASS> allPassFilters;
 
-	AllPassFilter **allPassFiltersL;
-	AllPassFilter **allPassFiltersR;
+	NoiseGenerator *noiseGeneratorAllPassL[2];
+	NoiseGenerator *noiseGeneratorAllPassR[2];
 
 	AllPassFilter *preAllPassFilterL;
 	AllPassFilter *preAllPassFilterR;
@@ -72,8 +73,10 @@ private:
 	bool stereoMode;
 	float modulationIntensity;
 
-	float outL;
-	float outR;
+	float revL[BLOCK_SIZE];
+	float revR[BLOCK_SIZE];
+	float outL[BLOCK_SIZE];
+	float outR[BLOCK_SIZE];
 
 	AudioUtils audioUtils;
 
@@ -82,55 +85,55 @@ public:
 	{
 		createDelaysAndCoefficients(DELAY_LINES_COMB + DELAY_LINES_ALLPASS, 82.0f);
 
-		combFiltersPreDelayL = new CombFilter((float)MAX_PRE_DELAY_MS, 0.0f, sampleRate);
-		combFiltersPreDelayR = new CombFilter((float)MAX_PRE_DELAY_MS, 0.0f, sampleRate);
+		int preDelayL = delayArena.reserve(TalDelayArena::getLineLength((float)MAX_PRE_DELAY_MS, sampleRate));
+		int preDelayR = delayArena.reserve(TalDelayArena::getLineLength((float)MAX_PRE_DELAY_MS, sampleRate));
+		int preAllPassL = delayArena.reserve(TalDelayArena::getLineLength(20.0f, sampleRate));
+		int preAllPassR = delayArena.reserve(TalDelayArena::getLineLength(20.0f, sampleRate));
+		int postAllPassL = delayArena.reserve(TalDelayArena::getLineLength(200.0f, sampleRate));
+		int postAllPassR = delayArena.reserve(TalDelayArena::getLineLength(200.0f, sampleRate));
 
-		combFiltersL = new CombFilter *[DELAY_LINES_COMB];
-		combFiltersR = new CombFilter *[DELAY_LINES_COMB];
-		noiseGeneratorAllPassL = new NoiseGenerator *[DELAY_LINES_COMB];
-		noiseGeneratorAllPassR = new NoiseGenerator *[DELAY_LINES_COMB];
-		noiseGeneratorDelayL = new NoiseGenerator *[DELAY_LINES_COMB];
-		noiseGeneratorDelayR = new NoiseGenerator *[DELAY_LINES_COMB];
-	    diffusionL = new NoiseGenerator *[DELAY_LINES_COMB];
-	    diffusionR = new NoiseGenerator *[DELAY_LINES_COMB];
+		combFilters.setNoise(5000.0f, 22768.0f, 22188.0f, 1000.0f);
 
 		float stereoSpreadValue = 0.008f;
 		float stereoSpreadSign = 1.0f;
+		float sign = 1.0f;
 		for (int i = 0; i < DELAY_LINES_COMB; i++)
 		{
 			float stereoSpreadFactor = 1.0f + stereoSpreadValue;
-			if (stereoSpreadSign > 0.0f)
-			{
-				combFiltersL[i] = new CombFilter(reflectionDelays[i] * stereoSpreadFactor, reflectionGains[i], sampleRate);
-				combFiltersR[i] = new CombFilter(reflectionDelays[i], reflectionGains[i], sampleRate);
-			}
-			else
-			{
-				combFiltersL[i] = new CombFilter(reflectionDelays[i], reflectionGains[i], sampleRate);
-				combFiltersR[i] = new CombFilter(reflectionDelays[i] * stereoSpreadFactor, reflectionGains[i], sampleRate);
-			}
+			float delayL = stereoSpreadSign > 0.0f ? reflectionDelays[i] * stereoSpreadFactor : reflectionDelays[i];
+			float delayR = stereoSpreadSign > 0.0f ? reflectionDelays[i] : reflectionDelays[i] * stereoSpreadFactor;
 			stereoSpreadSign *= -1.0f;
-			noiseGeneratorAllPassL[i] = new NoiseGenerator(sampleRate);
-			noiseGeneratorAllPassR[i] = new NoiseGenerator(sampleRate);
-			noiseGeneratorDelayL[i] = new NoiseGenerator(sampleRate);
-			noiseGeneratorDelayR[i] = new NoiseGenerator(sampleRate);
-			diffusionL[i] = new NoiseGenerator(sampleRate);
-			diffusionR[i] = new NoiseGenerator(sampleRate);
-		}
 
-		preAllPassFilterL = new AllPassFilter(20.0f,  0.68f, sampleRate);
-		preAllPassFilterR = new AllPassFilter(20.0f,  0.68f, sampleRate);
+			combFilters.setLine(delayArena, 0, i, delayL, sampleRate, reflectionGains[i], sign, 0.012f, rand(), rand());
+			combFilters.setLine(delayArena, 1, i, delayR, sampleRate, reflectionGains[i], sign, 0.012f, rand(), rand());
+			sign *= -1.0f;
+		}
 
-		postAllPassFilterL = new AllPassFilter(200.0f,  0.68f, sampleRate);
-		postAllPassFilterR = new AllPassFilter(200.0f,  0.68f, sampleRate);
- 
-		allPassFiltersL = new AllPassFilter *[DELAY_LINES_ALLPASS];
-		allPassFiltersR = new AllPassFilter *[DELAY_LINES_ALLPASS];
 		for (int i = 0; i < DELAY_LINES_ALLPASS; i++)
 		{
-			allPassFiltersL[i] = new AllPassFilter(reflectionDelays[i + DELAY_LINES_COMB - 1] * 0.105f,  0.68f, sampleRate);
-			allPassFiltersR[i] = new AllPassFilter(reflectionDelays[i + DELAY_LINES_COMB - 1] * 0.1f,  0.68f, sampleRate);
-        }
+			allPassFilters.setLine(delayArena, 0, i, reflectionDelays[i + DELAY_LINES_COMB - 1] * 0.105f, sampleRate);
+			allPassFilters.setLine(delayArena, 1, i, reflectionDelays[i + DELAY_LINES_COMB - 1] * 0.1f, sampleRate);
+		}
+		allPassFilters.setGain(0.68f);
+
+		delayArena.allocate();
+		combFilters.bind(delayArena);
+		allPassFilters.bind(delayArena);
+
+		combFiltersPreDelayL = new CombFilter((float)MAX_PRE_DELAY_MS, 0.0f, sampleRate, delayArena.getLine(preDelayL));
+		combFiltersPreDelayR = new CombFilter((float)MAX_PRE_DELAY_MS, 0.0f, sampleRate, delayArena.getLine(preDelayR));
+
+		preAllPassFilterL = new AllPassFilter(20.0f,  0.68f, sampleRate, delayArena.getLine(preAllPassL));
+		preAllPassFilterR = new AllPassFilter(20.0f,  0.68f, sampleRate, delayArena.getLine(preAllPassR));
+
+		postAllPassFilterL = new AllPassFilter(200.0f,  0.68f, sampleRate, delayArena.getLine(postAllPassL));
+		postAllPassFilterR = new AllPassFilter(200.0f,  0.68f, sampleRate, delayArena.getLine(postAllPassR));
+
+		for (int i = 0; i < 2; i++)
+		{
+			noiseGeneratorAllPassL[i] = new NoiseGenerator(sampleRate);
+			noiseGeneratorAllPassR[i] = new NoiseGenerator(sampleRate);
+		}
 
 		talEqL = new TalEq(sampleRate);
 		talEqR = new TalEq(sampleRate);
@@ -139,9 +142,6 @@ public:
 		preDelayTime = 0.0f;
 		modulationIntensity = 0.12f;
 		stereoMode = false;
-
-		outL = 0.0f;
-		outR = 0.0f;
 	}
 
 	~TalReverb()
@@ -152,29 +152,11 @@ public:
 		delete combFiltersPreDelayL;
 		delete combFiltersPreDelayR;
 
-        for (int i = 0; i < DELAY_LINES_COMB; i++) delete combFiltersL[i];
-		delete[] combFiltersL;
-        for (int i = 0; i < DELAY_LINES_COMB; i++) delete combFiltersR[i];
-		delete[] combFiltersR;
-
-        for (int i = 0; i < DELAY_LINES_ALLPASS; i++) delete allPassFiltersL[i];
-		delete[] allPassFiltersL;
-        for (int i = 0; i < DELAY_LINES_ALLPASS; i++) delete allPassFiltersR[i];
-		delete[] allPassFiltersR;
-
-        for (int i = 0; i < DELAY_LINES_COMB; i++) delete noiseGeneratorAllPassL[i];
-		delete[] noiseGeneratorAllPassL;
-        for (int i = 0; i < DELAY_LINES_COMB; i++) delete noiseGeneratorAllPassR[i];
-		delete[] noiseGeneratorAllPassR;
-        for (int i = 0; i < DELAY_LINES_COMB; i++) delete noiseGeneratorDelayL[i];
-		delete[] noiseGeneratorDelayL;
-        for (int i = 0; i < DELAY_LINES_COMB; i++) delete noiseGeneratorDelayR[i];
-		delete[] noiseGeneratorDelayR;
-
-        for (int i = 0; i < DELAY_LINES_COMB; i++) delete diffusionL[i];
-	    delete[] diffusionL;
-        for (int i = 0; i < DELAY_LINES_COMB; i++) delete diffusionR[i];
-	    delete[] diffusionR;
+		for (int i = 0; i < 2; i++)
+		{
+			delete noiseGeneratorAllPassL[i];
+			delete noiseGeneratorAllPassR[i];
+		}
 
 		delete preAllPassFilterL;
 		delete preAllPassFilterR;
@@ -243,58 +225,51 @@ public:
 		talEqR->setPeakGain(peakGain);
 	}
 
-	// All input values [0..1]
-	inline void process(float* sampleL, float* sampleR)
+	// All input values [0..1], numSamples <= BLOCK_SIZE
+	inline void processBlock(float* samplesL, float* samplesR, int numSamples)
 	{
-		float revR;
-		float revL;
-
-		if (!stereoMode)
-		{
-			revL = (*sampleL + *sampleR) * 0.25f; 
-			revL = combFiltersPreDelayL->process(revL, 0.0f, 0.0f, preDelayTime);
-			talEqL->process(&revL);
-			revR = revL;
-		}
-		else
+		for (int i = 0; i < numSamples; i++)
 		{
-			revL = combFiltersPreDelayL->process(*sampleL * 0.5f, 0.0f, 0.0f, preDelayTime);
-			revR = combFiltersPreDelayL->process(*sampleR * 0.5f, 0.0f, 0.0f, preDelayTime);
-			talEqL->process(&revL);
-			talEqR->process(&revR);
+			if (!stereoMode)
+			{
+				revL[i] = (samplesL[i] + samplesR[i]) * 0.25f;
+				revL[i] = combFiltersPreDelayL->process(revL[i], 0.0f, 0.0f, preDelayTime);
+				talEqL->process(&revL[i]);
+				revR[i] = revL[i];
+			}
+			else
+			{
+				revL[i] = combFiltersPreDelayL->process(samplesL[i] * 0.5f, 0.0f, 0.0f, preDelayTime);
+				revR[i] = combFiltersPreDelayL->process(samplesR[i] * 0.5f, 0.0f, 0.0f, preDelayTime);
+				talEqL->process(&revL[i]);
+				talEqR->process(&revR[i]);
+			}
 		}
 
 		// ----------------- Comb Filter --------------------
-		outL = 0.0f;
-		outR = 0.0f;
-
 		float scaledRoomSize = decayTime * 0.998f;
-		float sign = 1.0f;
-		for (int i = 0; i < DELAY_LINES_COMB; i++)
-		{ 
-            outL += sign * combFiltersL[i]->processInterpolated(revL, diffusionL[i]->tickFilteredNoiseFast() * 0.2f, scaledRoomSize, scaledRoomSize + 0.012f * noiseGeneratorDelayL[i]->tickFilteredNoise());
-			outR += sign * combFiltersR[i]->processInterpolated(revR, diffusionR[i]->tickFilteredNoiseFast() * 0.2f, scaledRoomSize, scaledRoomSize + 0.012f * noiseGeneratorDelayR[i]->tickFilteredNoise());
-			sign *= -1.0f;
-		}
+		combFilters.processBlock(revL, revR, outL, outR, numSamples, scaledRoomSize, scaledRoomSize, 0.2f);
 
-		// ----------------- Pre AllPass --------------------
-		outL += 0.5f * preAllPassFilterL->processInterpolated(revR, 0.8f + 0.2f * noiseGeneratorAllPassL[0]->tickFilteredNoise(), 0.69f, true);
-		outR += 0.5f * preAllPassFilterR->processInterpolated(revL, 0.8f + 0.2f * noiseGeneratorAllPassR[0]->tickFilteredNoise(), 0.69f, true);
+		for (int i = 0; i < numSamples; i++)
+		{
+			// ----------------- Pre AllPass --------------------
+			outL[i] += 0.5f * preAllPassFilterL->processInterpolated(revR[i], 0.8f + 0.2f * noiseGeneratorAllPassL[0]->tickFilteredNoise(), 0.69f, true);
+			outR[i] += 0.5f * preAllPassFilterR->processInterpolated(revL[i], 0.8f + 0.2f * noiseGeneratorAllPassR[0]->tickFilteredNoise(), 0.69f, true);
 
-		//// ----------------- Post AllPass --------------------
-		outL += 0.45f * postAllPassFilterL->processInterpolated(revL, 0.8f + 0.2f * noiseGeneratorAllPassL[1]->tickFilteredNoise(), 0.69f, false);
-		outR += 0.45f * postAllPassFilterR->processInterpolated(revR, 0.8f + 0.2f * noiseGeneratorAllPassR[1]->tickFilteredNoise(), 0.69f, false);
+			//// ----------------- Post AllPass --------------------
+			outL[i] += 0.45f * postAllPassFilterL->processInterpolated(revL[i], 0.8f + 0.2f * noiseGeneratorAllPassL[1]->tickFilteredNoise(), 0.69f, false);
+			outR[i] += 0.45f * postAllPassFilterR->processInterpolated(revR[i], 0.8f + 0.2f * noiseGeneratorAllPassR[1]->tickFilteredNoise(), 0.69f, false);
+		}
 
 		// ----------------- AllPass Filter ------------------
-		for (int i = 0; i < DELAY_LINES_ALLPASS; i++)
-		{
-			outL = allPassFiltersL[i]->process(outL);
-			outR = allPassFiltersR[i]->process(outR);
-		}
+		allPassFilters.processBlock(outL, outR, numSamples);
 
 		// ----------------- Write to output / Stereo --------
-		*sampleL = outL;
-		*sampleR = outR;
+		for (int i = 0; i < numSamples; i++)
+		{
+			samplesL[i] = outL[i];
+			samplesR[i] = outR[i];
+		}
 	}
 
 	void createDelaysAndCoefficients(int numlines, float delayLength)
@@ -46,6 +46,11 @@ public:
 	float wet;
 	float stereoWidth;
 
+	float drySamplesL[TalReverb::BLOCK_SIZE];
+	float drySamplesR[TalReverb::BLOCK_SIZE];
+	float wetSamplesL[TalReverb::BLOCK_SIZE];
+	float wetSamplesR[TalReverb::BLOCK_SIZE];
+
 	AudioUtils audioUtils;
 
 	ReverbEngine(float sampleRate)
@@ -158,27 +163,47 @@ public:
 		stereoWidth = 1.0f;
 	}
 
-	void process(float *sampleL, float *sampleR) 
-	{
-		// avoid cpu spikes
-		float noise = noiseGenerator->tickNoise() * 0.000000001f;
-
-		*sampleL += noise;
-		*sampleR += noise;
-
-		float drysampleL = *sampleL;
-		float drysampleR = *sampleR;
-
-		reverb->process(sampleL, sampleR);
-
-		// Process Stereo
-		float actualDryValue = dryParamChange->tick(dry);
-		float wet1 = wet * (stereoWidth * 0.5f + 0.5f);
-		float wet2 = wet * ((1.0f - stereoWidth) * 0.5f);
-		float resultL = *sampleL * wet1 + *sampleR * wet2 + drysampleL * actualDryValue;
-		float resultR = *sampleR * wet1 + *sampleL * wet2 + drysampleR * actualDryValue;
-		*sampleL = resultL;
-		*sampleR = resultR;
+	void processBlock(float *samplesL, float *samplesR, int numSamples)
+	{
+		while (numSamples > 0)
+		{
+			int blockSize = numSamples < TalReverb::BLOCK_SIZE ? numSamples : TalReverb::BLOCK_SIZE;
+
+			for (int i = 0; i < blockSize; i++)
+			{
+				// avoid cpu spikes
+				float noise = noiseGenerator->tickNoise() * 0.000000001f;
+
+				drySamplesL[i] = samplesL[i] + noise;
+				drySamplesR[i] = samplesR[i] + noise;
+				wetSamplesL[i] = drySamplesL[i];
+				wetSamplesR[i] = drySamplesR[i];
+			}
+
+			reverb->processBlock(wetSamplesL, wetSamplesR, blockSize);
+
+			// mono: both channels are the same buffer, the right reverb output used to win
+			if (samplesL == samplesR)
+			{
+				for (int i = 0; i < blockSize; i++) wetSamplesL[i] = wetSamplesR[i];
+			}
+
+			// Process Stereo
+			float wet1 = wet * (stereoWidth * 0.5f + 0.5f);
+			float wet2 = wet * ((1.0f - stereoWidth) * 0.5f);
+			for (int i = 0; i < blockSize; i++)
+			{
+				float actualDryValue = dryParamChange->tick(dry);
+				float resultL = wetSamplesL[i] * wet1 + wetSamplesR[i] * wet2 + drySamplesL[i] * actualDryValue;
+				float resultR = wetSamplesR[i] * wet1 + wetSamplesL[i] * wet2 + drySamplesR[i] * actualDryValue;
+				samplesL[i] = resultL;
+				samplesR[i] = resultR;
+			}
+
+			samplesL += blockSize;
+			samplesR += blockSize;
+			numSamples -= blockSize;
+		}
 	}
 };
 #endif
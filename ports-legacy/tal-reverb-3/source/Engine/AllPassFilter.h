@@ -34,12 +34,13 @@ private:
 	float* buffer;
 	int bufferLength, writePtr, readPtr1, readPtr2;
 	float z1;
+	bool ownsBuffer;
 
 	AudioUtils audioUtils;
 
 public:
-	// delay times in milliseconds
-	AllPassFilter(float delayTime, float feedbackGain, long samplingRate)
+	// delay times in milliseconds, an external buffer (a TalDelayArena line) is not owned
+	AllPassFilter(float delayTime, float feedbackGain, long samplingRate, float* externalBuffer = 0)
 	{
 		//OutputDebugString("start init allPass");
 		gain = feedbackGain;
@@ -47,7 +48,8 @@ public:
 
 		bufferLength = (int)(delay * samplingRate / 1000.0f);
 		bufferLength = audioUtils.getNextNearPrime(bufferLength);
-		buffer = new float[bufferLength];
+		ownsBuffer = externalBuffer == 0;
+		buffer = ownsBuffer ? new float[bufferLength] : externalBuffer;
 
 		//zero out the buffer (create silence)
 		for (int i = 0; i < bufferLength; i++)
@@ -60,7 +62,7 @@ public:
 
 	~AllPassFilter()
 	{
-		delete buffer;
+		if (ownsBuffer) delete[] buffer;
 	}
 
 	// all values [0..1]
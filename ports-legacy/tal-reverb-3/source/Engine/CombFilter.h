@@ -38,16 +38,18 @@ private:
 	float z1;
 	int bufferLengthDelay;
 	float filterStore;
+	bool ownsBuffer;
 
 	AudioUtils audioUtils;
 
 public:
-	// delay times in milliseconds
-	CombFilter(float delayTime, float minDamp, long sampleRate)
+	// delay times in milliseconds, an external buffer (a TalDelayArena line) is not owned
+	CombFilter(float delayTime, float minDamp, long sampleRate, float* externalBuffer = 0)
 	{
 		bufferLengthDelay = (int)(delayTime * sampleRate / 1000);
 		bufferLengthDelay = audioUtils.getNextNearPrime(bufferLengthDelay);
-		buffer = new float[bufferLengthDelay];
+		ownsBuffer = externalBuffer == 0;
+		buffer = ownsBuffer ? new float[bufferLengthDelay] : externalBuffer;
 
 		//zero out the buffer (silence)
 		for (int i = 0; i < bufferLengthDelay; i++)
@@ -69,7 +71,7 @@ public:
 
 	~CombFilter()
 	{
-		delete buffer;
+		if (ownsBuffer) delete[] buffer;
 	}
 
 	// delayIntensity [0..1]
@@ -31,9 +31,13 @@
 #include "math.h"
 #include "AudioUtils.h"
 #include "TalEq.h"
+#include "TalReverbCore.h"
 
 class TalReverb
 {
+public:
+	static const int BLOCK_SIZE = 256;
+
 private:
 	static const int DELAY_LINES_COMB = 4;
 	static const int DELAY_LINES_ALLPASS = 5;
@@ -42,20 +46,17 @@ private:
 	float* reflectionGains;
 	float* reflectionDelays;
 
+	// every delay line below lives in here
+	TalDelayArena delayArena;
+
 	CombFilter *combFiltersPreDelayL;
 	CombFilter *combFiltersPreDelayR;
 
-	CombFilter **combFiltersL;
-	CombFilter **combFiltersR;
-	NoiseGenerator **noiseGeneratorAllPassL;
-	NoiseGenerator **noiseGeneratorAllPassR;
-	NoiseGenerator **noiseGeneratorDelayL;
-	NoiseGenerator **noiseGeneratorDelayR;
-	NoiseGenerator **diffusionL;
-	NoiseGenerator **diffusionR;
+	TalCombBank<DELAY_LINES_COMB> combFilters;
+	TalAllPassBank<DELAY_LINES_ALLPASS> allPassFilters;
 
-	AllPassFilter **allPassFiltersL;
-	AllPassFilter **allPassFiltersR;
+	NoiseGenerator *noiseGeneratorAllPassL;
+	NoiseGenerator *noiseGeneratorAllPassR;
 
 	AllPassFilter *preAllPassFilterL;
 	AllPassFilter *preAllPassFilterR;
@@ -74,8 +75,10 @@ private:
 	bool stereoMode;
 	float modulationIntensity;
 
-	float outL;
-	float outR;
+	float revL[BLOCK_SIZE];
+	float revR[BLOCK_SIZE];
+	float combOutL[BLOCK_SIZE];
+	float combOutR[BLOCK_SIZE];
 
     float feedbackSampleRateFactor;
 
@@ -90,56 +93,56 @@ public:
 
 		this->createDelaysAndCoefficients(DELAY_LINES_ALLPASS, 100.0f);
 
-		this->combFiltersPreDelayL = new CombFilter((float)MAX_PRE_DELAY_MS, 0.0f, sampleRate);
-		this->combFiltersPreDelayR = new CombFilter((float)MAX_PRE_DELAY_MS, 0.0f, sampleRate);
+		int preDelayL = delayArena.reserve(TalDelayArena::getLineLength((float)MAX_PRE_DELAY_MS, sampleRate));
+		int preDelayR = delayArena.reserve(TalDelayArena::getLineLength((float)MAX_PRE_DELAY_MS, sampleRate));
+		int preAllPassL = delayArena.reserve(TalDelayArena::getLineLength(90.0f, sampleRate));
+		int preAllPassR = delayArena.reserve(TalDelayArena::getLineLength(90.0f, sampleRate));
+		int postAllPassL = delayArena.reserve(TalDelayArena::getLineLength(91.0f, sampleRate));
+		int postAllPassR = delayArena.reserve(TalDelayArena::getLineLength(91.0f, sampleRate));
 
-		this->combFiltersL = new CombFilter *[DELAY_LINES_COMB];
-		this->combFiltersR = new CombFilter *[DELAY_LINES_COMB];
-		this->noiseGeneratorAllPassL = new NoiseGenerator *[DELAY_LINES_COMB];
-		this->noiseGeneratorAllPassR = new NoiseGenerator *[DELAY_LINES_COMB];
-		this->noiseGeneratorDelayL = new NoiseGenerator *[DELAY_LINES_COMB];
-		this->noiseGeneratorDelayR = new NoiseGenerator *[DELAY_LINES_COMB];
-	    this->diffusionL = new NoiseGenerator *[DELAY_LINES_COMB];
-	    this->diffusionR = new NoiseGenerator *[DELAY_LINES_COMB];
+		// NoiseGenerator and CombFilter sample rate scaling
+		this->combFilters.setNoise(44100.0f * 2800.0f / sampleRate, 44100.0f * 25000.0f / sampleRate,
+			44100.0f * 1000.0f / sampleRate, 44100.0f * 10.0f / sampleRate);
+
+		float dampSampleRateFactor = 44100.0f / sampleRate;
+		if (dampSampleRateFactor > 1.0f) dampSampleRateFactor = 1.0f;
+		this->combFilters.setDampFactor(dampSampleRateFactor);
 
 		float stereoSpreadValue = 0.008f;
 		float stereoSpreadSign = 1.0f;
 		for (int i = 0; i < DELAY_LINES_COMB; i++)
 		{
 			float stereoSpreadFactor = 1.0f + stereoSpreadValue;
-			if (stereoSpreadSign > 0.0f)
-			{
-				combFiltersL[i] = new CombFilter(reflectionDelays[i] * stereoSpreadFactor, 1.0f, sampleRate);
-				combFiltersR[i] = new CombFilter(reflectionDelays[i], 1.0f, sampleRate);
-			}
-			else
-			{
-				combFiltersL[i] = new CombFilter(reflectionDelays[i], 1.0f, sampleRate);
-				combFiltersR[i] = new CombFilter(reflectionDelays[i] * stereoSpreadFactor, 1.0f, sampleRate);
-			}
+			float delayL = stereoSpreadSign > 0.0f ? reflectionDelays[i] * stereoSpreadFactor : reflectionDelays[i];
+			float delayR = stereoSpreadSign > 0.0f ? reflectionDelays[i] : reflectionDelays[i] * stereoSpreadFactor;
 			stereoSpreadSign *= -1.0f;
 
-			this->noiseGeneratorAllPassL[i] = new NoiseGenerator((float)sampleRate, (float)i);
-			this->noiseGeneratorAllPassR[i] = new NoiseGenerator((float)sampleRate, i + 163.0f);
-			this->noiseGeneratorDelayL[i] = new NoiseGenerator((float)sampleRate, i + 257.0f);
-			this->noiseGeneratorDelayR[i] = new NoiseGenerator((float)sampleRate, i + 353.0f);
-			this->diffusionL[i] = new NoiseGenerator((float)sampleRate, i + 455.0f);
-			this->diffusionR[i] = new NoiseGenerator((float)sampleRate, i + 633.0f);
+			this->combFilters.setLine(delayArena, 0, i, delayL, sampleRate, 1.0f, 1.0f, 0.028f, i + 257, i + 455);
+			this->combFilters.setLine(delayArena, 1, i, delayR, sampleRate, 1.0f, 1.0f, 0.028f, i + 353, i + 633);
 		}
 
-		this->preAllPassFilterL = new AllPassFilter(90.0f,  0.68f, sampleRate);
-		this->preAllPassFilterR = new AllPassFilter(90.0f,  0.68f, sampleRate);
-
-		this->postAllPassFilterL = new AllPassFilter(91.0f,  0.68f, sampleRate);
-		this->postAllPassFilterR = new AllPassFilter(91.0f,  0.68f, sampleRate);
- 
-		this->allPassFiltersL = new AllPassFilter *[DELAY_LINES_ALLPASS];
-		this->allPassFiltersR = new AllPassFilter *[DELAY_LINES_ALLPASS];
 		for (int i = 0; i < DELAY_LINES_ALLPASS; i++)
 		{
-			this->allPassFiltersL[i] = new AllPassFilter(reflectionDelays[i] * 0.2f,  0.68f, sampleRate);
-			this->allPassFiltersR[i] = new AllPassFilter(reflectionDelays[i] * 0.2f,  0.68f, sampleRate);
-        }
+			this->allPassFilters.setLine(delayArena, 0, i, reflectionDelays[i] * 0.2f, sampleRate);
+			this->allPassFilters.setLine(delayArena, 1, i, reflectionDelays[i] * 0.2f, sampleRate);
+		}
+		this->allPassFilters.setGain(0.68f);
+
+		this->delayArena.allocate();
+		this->combFilters.bind(delayArena);
+		this->allPassFilters.bind(delayArena);
+
+		this->combFiltersPreDelayL = new CombFilter((float)MAX_PRE_DELAY_MS, 0.0f, sampleRate, delayArena.getLine(preDelayL));
+		this->combFiltersPreDelayR = new CombFilter((float)MAX_PRE_DELAY_MS, 0.0f, sampleRate, delayArena.getLine(preDelayR));
+
+		this->noiseGeneratorAllPassL = new NoiseGenerator((float)sampleRate, 0.0f);
+		this->noiseGeneratorAllPassR = new NoiseGenerator((float)sampleRate, 163.0f);
+
+		this->preAllPassFilterL = new AllPassFilter(90.0f,  0.68f, sampleRate, delayArena.getLine(preAllPassL));
+		this->preAllPassFilterR = new AllPassFilter(90.0f,  0.68f, sampleRate, delayArena.getLine(preAllPassR));
+
+		this->postAllPassFilterL = new AllPassFilter(91.0f,  0.68f, sampleRate, delayArena.getLine(postAllPassL));
+		this->postAllPassFilterR = new AllPassFilter(91.0f,  0.68f, sampleRate, delayArena.getLine(postAllPassR));
 
 		this->talEqL = new TalEq((float)sampleRate);
 		this->talEqR = new TalEq((float)sampleRate);
@@ -149,9 +152,6 @@ public:
 		this->modulationIntensity = 0.12f;
 		this->stereoMode = false;
 
-		this->outL = 0.0f;
-		this->outR = 0.0f;
-
         this->feedbackValueL = 0.0f;
         this->feedbackValueR = 0.0f;
 	}
@@ -164,29 +164,8 @@ public:
 		delete combFiltersPreDelayL;
 		delete combFiltersPreDelayR;
 
-        for (int i = 0; i < DELAY_LINES_COMB; i++) delete combFiltersL[i];
-		delete[] combFiltersL;
-        for (int i = 0; i < DELAY_LINES_COMB; i++) delete combFiltersR[i];
-		delete[] combFiltersR;
-
-        for (int i = 0; i < DELAY_LINES_ALLPASS; i++) delete allPassFiltersL[i];
-		delete[] allPassFiltersL;
-        for (int i = 0; i < DELAY_LINES_ALLPASS; i++) delete allPassFiltersR[i];
-		delete[] allPassFiltersR;
-
-        for (int i = 0; i < DELAY_LINES_COMB; i++) delete noiseGeneratorAllPassL[i];
-		delete[] noiseGeneratorAllPassL;
-        for (int i = 0; i < DELAY_LINES_COMB; i++) delete noiseGeneratorAllPassR[i];
-		delete[] noiseGeneratorAllPassR;
-        for (int i = 0; i < DELAY_LINES_COMB; i++) delete noiseGeneratorDelayL[i];
-		delete[] noiseGeneratorDelayL;
-        for (int i = 0; i < DELAY_LINES_COMB; i++) delete noiseGeneratorDelayR[i];
-		delete[] noiseGeneratorDelayR;
-
-        for (int i = 0; i < DELAY_LINES_COMB; i++) delete diffusionL[i];
-	    delete[] diffusionL;
-        for (int i = 0; i < DELAY_LINES_COMB; i++) delete diffusionR[i];
-	    delete[] diffusionR;
+		delete noiseGeneratorAllPassL;
+		delete noiseGeneratorAllPassR;
 
 		delete preAllPassFilterL;
 		delete preAllPassFilterR;
@@ -237,67 +216,61 @@ public:
 		talEqR->setHighShelfFrequency(highShelfFrequency);
 	}
 
-	// All input values [0..1]
-	inline void process(float* sampleL, float* sampleR)
+	// All input values [0..1], numSamples <= BLOCK_SIZE
+	inline void processBlock(float* samplesL, float* samplesR, int numSamples)
 	{
-		float revL = 0.0f;
-		float revR = 0.0f;
-
-		if (!stereoMode)
+		for (int i = 0; i < numSamples; i++)
 		{
-			revL += (*sampleL + *sampleR) * 0.125f; 
-			revL += combFiltersPreDelayL->process(revL, 0.0f, 0.0f, preDelayTime);
-			talEqL->process(&revL);
-			revR = revL;
-		}
-		else
-		{
-			revL += combFiltersPreDelayL->process(*sampleL * 0.5f, 0.0f, 0.0f, preDelayTime);
-			revR += combFiltersPreDelayR->process(*sampleR * 0.5f, 0.0f, 0.0f, preDelayTime);
-			talEqL->process(&revL);
-			talEqR->process(&revR);
+			revL[i] = 0.0f;
+			revR[i] = 0.0f;
+
+			if (!stereoMode)
+			{
+				revL[i] += (samplesL[i] + samplesR[i]) * 0.125f;
+				revL[i] += combFiltersPreDelayL->process(revL[i], 0.0f, 0.0f, preDelayTime);
+				talEqL->process(&revL[i]);
+				revR[i] = revL[i];
+			}
+			else
+			{
+				revL[i] += combFiltersPreDelayL->process(samplesL[i] * 0.5f, 0.0f, 0.0f, preDelayTime);
+				revR[i] += combFiltersPreDelayR->process(samplesR[i] * 0.5f, 0.0f, 0.0f, preDelayTime);
+				talEqL->process(&revL[i]);
+				talEqR->process(&revR[i]);
+			}
 		}
 
 		// ----------------- Comb Filter --------------------
-        float feedbackFactor = 0.15f;
-		outL = feedbackValueL * feedbackFactor;
-		outR = feedbackValueR * feedbackFactor;
-
 		float scaledRoomSizeDelay = this->decayTime * 0.972f;
 		float scaledRoomSizeDamp = this->decayTime * 0.99f;
         float invDecayTime = 0.9f * (1.0f - this->decayTime);
-		for (int i = 0; i < DELAY_LINES_COMB; i++)
-		{ 
-            outL += combFiltersL[i]->processInterpolated(revL, diffusionL[i]->tickFilteredNoiseFast() * invDecayTime, scaledRoomSizeDamp, scaledRoomSizeDelay + 0.028f * noiseGeneratorDelayL[i]->tickFilteredNoise());
-			outR += combFiltersR[i]->processInterpolated(revR, diffusionR[i]->tickFilteredNoiseFast() * invDecayTime, scaledRoomSizeDamp, scaledRoomSizeDelay + 0.028f * noiseGeneratorDelayR[i]->tickFilteredNoise());
-		}
+		this->combFilters.processBlock(revL, revR, combOutL, combOutR, numSamples, scaledRoomSizeDelay, scaledRoomSizeDamp, invDecayTime);
 
-		// ----------------- Pre AllPass --------------------
-		float modL = preAllPassFilterL->processInterpolated(revL, 0.995f + 0.005f * noiseGeneratorAllPassL[0]->tickFilteredNoise(), 0.68f, true);
-		float modR = preAllPassFilterR->processInterpolated(revR, 0.995f + 0.005f * noiseGeneratorAllPassR[0]->tickFilteredNoise(), 0.68f, true);
+		// the output feeds back into itself, so the rest runs sample by sample
+        float feedbackFactor = 0.15f;
+		for (int i = 0; i < numSamples; i++)
+		{
+			float outL = feedbackValueL * feedbackFactor + combOutL[i];
+			float outR = feedbackValueR * feedbackFactor + combOutR[i];
 
-		// ----------------- Post AllPass --------------------
-	    outL += 0.4f * postAllPassFilterL->processInterpolated(modL, decayTime, 0.68f, false);
-		outR += 0.4f * postAllPassFilterR->processInterpolated(modR, decayTime, 0.68f, false);
+			// ----------------- Pre AllPass --------------------
+			float modL = preAllPassFilterL->processInterpolated(revL[i], 0.995f + 0.005f * noiseGeneratorAllPassL->tickFilteredNoise(), 0.68f, true);
+			float modR = preAllPassFilterR->processInterpolated(revR[i], 0.995f + 0.005f * noiseGeneratorAllPassR->tickFilteredNoise(), 0.68f, true);
 
-		// ----------------- AllPass Filter ------------------
-		for (int i = 0; i < DELAY_LINES_ALLPASS; i++)
-		{
-			outL = allPassFiltersL[i]->process(outL);
-			outR = allPassFiltersR[i]->process(outR);
-		}
+			// ----------------- Post AllPass --------------------
+			outL += 0.4f * postAllPassFilterL->processInterpolated(modL, decayTime, 0.68f, false);
+			outR += 0.4f * postAllPassFilterR->processInterpolated(modR, decayTime, 0.68f, false);
 
-		// ----------------- Write to output / Stereo --------
-        //if (outL > 2.0f)  outL = 2.0f;
-        //if (outR > 2.0f)  outR = 2.0f;
-        //if (outL < -2.0f)  outL = -2.0f;
-        //if (outR < -2.0f)  outR = -2.0f;
+			// ----------------- AllPass Filter ------------------
+			this->allPassFilters.process(&outL, &outR);
 
-		*sampleL = outL;
-		*sampleR = outR;
+			// ----------------- Write to output / Stereo --------
+			samplesL[i] = outL;
+			samplesR[i] = outR;
 
-        feedbackValueL = outL;
-        feedbackValueR = outR;
+			feedbackValueL = outL;
+			feedbackValueR = outR;
+		}
 	}
 
 	void createDelaysAndCoefficients(int numlines, float delayLength)
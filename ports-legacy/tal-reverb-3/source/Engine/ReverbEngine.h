@@ -46,6 +46,11 @@ public:
 	float stereoWidth;
 	float power;
 
+	float drySamplesL[TalReverb::BLOCK_SIZE];
+	float drySamplesR[TalReverb::BLOCK_SIZE];
+	float wetSamplesL[TalReverb::BLOCK_SIZE];
+	float wetSamplesR[TalReverb::BLOCK_SIZE];
+
     float* stereoVolumeWet;
     float* stereoVolumeWetReturnValue;
 
@@ -171,40 +176,59 @@ public:
 		power = 1.0f;
 	}
 
-	void process(float *sampleL, float *sampleR) 
+	void processBlock(float *samplesL, float *samplesR, int numSamples)
 	{
-        if (power > 0)
-        {
-		    // avoid cpu spikes
-		    float noise = noiseGenerator->tickNoise() * 0.000000001f;
-
-		    *sampleL += noise;
-		    *sampleR += noise;
-
-		    float drysampleL = *sampleL;
-		    float drysampleR = *sampleR;
-
-		    reverb->process(sampleL, sampleR);
-
-		    // Process Stereo
-		    float actualDryValue = dryParamChange->tick(dry);
-		    float wet1 = wet * (stereoWidth * 0.5f + 0.5f);
-		    float wet2 = wet * ((1.0f - stereoWidth) * 0.5f);
-
-            float wetSignalL = *sampleL * wet1 + *sampleR * wet2;
-            float wetSignalR = *sampleR * wet1 + *sampleL * wet2;
-            
-            this->setMeterValue(wetSignalL, wetSignalR);
-
-		    float resultL = wetSignalL + drysampleL * actualDryValue;
-		    float resultR = wetSignalR + drysampleR * actualDryValue;
-		    *sampleL = resultL;
-		    *sampleR = resultR;
-        }
-        else
+        if (power <= 0)
         {
             this->setMeterValue(0.0f, 0.0f);
+            return;
         }
+
+		while (numSamples > 0)
+		{
+			int blockSize = numSamples < TalReverb::BLOCK_SIZE ? numSamples : TalReverb::BLOCK_SIZE;
+
+			for (int i = 0; i < blockSize; i++)
+			{
+				// avoid cpu spikes
+				float noise = noiseGenerator->tickNoise() * 0.000000001f;
+
+				drySamplesL[i] = samplesL[i] + noise;
+				drySamplesR[i] = samplesR[i] + noise;
+				wetSamplesL[i] = drySamplesL[i];
+				wetSamplesR[i] = drySamplesR[i];
+			}
+
+			reverb->processBlock(wetSamplesL, wetSamplesR, blockSize);
+
+			// mono: both channels are the same buffer, the right reverb output used to win
+			if (samplesL == samplesR)
+			{
+				for (int i = 0; i < blockSize; i++) wetSamplesL[i] = wetSamplesR[i];
+			}
+
+			// Process Stereo
+			float wet1 = wet * (stereoWidth * 0.5f + 0.5f);
+			float wet2 = wet * ((1.0f - stereoWidth) * 0.5f);
+			for (int i = 0; i < blockSize; i++)
+			{
+				float actualDryValue = dryParamChange->tick(dry);
+
+				float wetSignalL = wetSamplesL[i] * wet1 + wetSamplesR[i] * wet2;
+				float wetSignalR = wetSamplesR[i] * wet1 + wetSamplesL[i] * wet2;
+
+				this->setMeterValue(wetSignalL, wetSignalR);
+
+				float resultL = wetSignalL + drySamplesL[i] * actualDryValue;
+				float resultR = wetSignalR + drySamplesR[i] * actualDryValue;
+				samplesL[i] = resultL;
+				samplesR[i] = resultR;
+			}
+
+			samplesL += blockSize;
+			samplesR += blockSize;
+			numSamples -= blockSize;
+		}
 	}
 
     void setMeterValue(float valueL, float valueR)
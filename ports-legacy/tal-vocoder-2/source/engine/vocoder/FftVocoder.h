@@ -29,7 +29,7 @@
 #include <string.h>
 #include <memory.h>
 #include <math.h>
-#include "Fft.h"
+#include "SharedFFT.h"
 #include "EnvelopeManager.h"
 
 #define M_PI 3.14159265358979323846
@@ -44,9 +44,8 @@ public:
 	float sampleRate;
 	int oversampling;
 
-	Fft *smsFft;
+	sharedfft::RealFFT fft;
 
-	int powerOfTwo;
 	int fftFrameSize;
 	int fftFrameSize2;
 	int stepSize;
@@ -58,6 +57,10 @@ public:
 	float gInFIFOCarrier[MAX_FRAME_LENGTH];
 	float gOutFIFO[MAX_FRAME_LENGTH];
 
+	float gFftWindowedInput[MAX_FRAME_LENGTH];
+	float gFftWindowedCarrier[MAX_FRAME_LENGTH];
+	float gFftResult[MAX_FRAME_LENGTH];
+
 	float gFftInputRe[2*MAX_FRAME_LENGTH];
 	float gFftInputIm[2*MAX_FRAME_LENGTH];
 
@@ -81,10 +84,7 @@ public:
 		this->oversampling	= oversampling;
 		this->sampleRate	= sampleRate;
 
-		smsFft = new Fft();
-
-		// calculate power for FFT
-		powerOfTwo = (int)(logf((float)bufferSize)/logf(2.0) + 0.5f);
+		fft.init(bufferSize);
 
 		// set up some handy variables
 		fftFrameSize	= bufferSize;
@@ -145,21 +145,27 @@ public:
 		{
 			gRover = inFifoLatency;
 
-			// Do windowing and re,im interleave
+			// Do windowing
 			for (int k = 0; k < fftFrameSize; k++) 
 			{
-				gFftInputRe[k] = gInFIFOInput[k] * windowTable[k];
-				gFftInputIm[k] = 0.0f;
-
-				gFftCarrierRe[k] = gInFIFOCarrier[k] * windowTable[k];
-				gFftCarrierIm[k] = 0.0f;
+				gFftWindowedInput[k] = gInFIFOInput[k] * windowTable[k];
+				gFftWindowedCarrier[k] = gInFIFOCarrier[k] * windowTable[k];
 			}
 
 			// Analyse 
 			//*******************************************************************/
-			// Do FFT transform
-			smsFft->FFT2(1, powerOfTwo, gFftInputRe, gFftInputIm);
-			smsFft->FFT2(1, powerOfTwo, gFftCarrierRe, gFftCarrierIm);
+			// Do FFT transform, bins 0..fftFrameSize2 only as the input is real
+			fft.forward(gFftWindowedInput, gFftInputRe, gFftInputIm);
+			fft.forward(gFftWindowedCarrier, gFftCarrierRe, gFftCarrierIm);
+
+			const float scale = 1.0f / (float)fftFrameSize;
+			for (int k = 0; k <= fftFrameSize2; k++)
+			{
+				gFftInputRe[k] *= scale;
+				gFftInputIm[k] *= scale;
+				gFftCarrierRe[k] *= scale;
+				gFftCarrierIm[k] *= scale;
+			}
 
 			/* Convolution */
 			envelopeManager->process(gFftInputRe, gFftInputIm, gFftCarrierRe, gFftCarrierIm, gFftResultRe, gFftResultIm);
@@ -174,20 +180,16 @@ public:
 			//	gFftResultIm[k] =  gFftCarrierIm[k];
 			//}
 
-			/* zero negative frequencies */
-			for (int k = fftFrameSize2+1; k < fftFrameSize; k++)
-			{
-				gFftResultRe[k] = 0.0f;
-				gFftResultIm[k] = 0.0f;
-			}
-
-			/* Do inverse transform */
-			smsFft->FFT2(-1, powerOfTwo, gFftResultRe, gFftResultIm);
+			/* Do inverse transform. With zeroed negative frequencies the real part of
+			   the complex transform is half the real one, except for DC and nyquist */
+			gFftResultRe[0] *= 2.0f;
+			gFftResultRe[fftFrameSize2] *= 2.0f;
+			fft.inverse(gFftResultRe, gFftResultIm, gFftResult);
 
 			/* Do windowing and add to output accumulator */
 			for(int k = 0; k < fftFrameSize; k++) 
 			{
-				gOutputAccum[k] += 2.0f*windowTable[k]*gFftResultRe[k]/(fftFrameSize2*oversampling);
+				gOutputAccum[k] += windowTable[k]*gFftResult[k]/(fftFrameSize2*oversampling);
 			}
 			for (int k = 0; k < stepSize; k++)
 			{
@@ -17,8 +17,8 @@ TemperAudioProcessorEditor::TemperAudioProcessorEditor (TemperAudioProcessor& p,
     : AudioProcessorEditor (&p), processor (p), m_vts(vts)
 {
     addAndMakeVisible(m_main = new MainComponent(m_vts));
-    addAndMakeVisible(m_vizPre = new SpectroscopeComponent());
-    addAndMakeVisible(m_vizPost = new SpectroscopeComponent());
+    addAndMakeVisible(m_vizPre = new SpectroscopeComponent(p.getPreTap()));
+    addAndMakeVisible(m_vizPost = new SpectroscopeComponent(p.getPostTap()));
 
     m_main->setAlwaysOnTop(true);
     m_vizPre->setColours(Colour::fromRGBA(255, 51, 34, 255),
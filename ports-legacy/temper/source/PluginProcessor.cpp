@@ -36,6 +36,10 @@ m_params (*this, nullptr)
     m_lastKnownSampleRate = 0.0;
     m_currentProgram = -1;
 
+    // Enough for the spectroscope timers at the highest sample rates
+    m_tapPre.setSize(1, 32768);
+    m_tapPost.setSize(1, 32768);
+
     // Initialize the dsp units
     for (int i = 0; i < getTotalNumInputChannels(); ++i)
     {
@@ -201,10 +205,6 @@ void TemperAudioProcessor::processBlock (AudioSampleBuffer& buffer, MidiBuffer&
     const int totalNumInputChannels  = getTotalNumInputChannels();
     const int totalNumOutputChannels = getTotalNumOutputChannels();
 
-#if ! JUCE_AUDIOPROCESSOR_NO_GUI
-    TemperAudioProcessorEditor* editor = static_cast<TemperAudioProcessorEditor*>(getActiveEditor());
-#endif
-
     // In case we have more outputs than inputs, this code clears any output
     // channels that didn't contain input data, (because these aren't
     // guaranteed to be empty - they may contain garbage).
@@ -215,9 +215,9 @@ void TemperAudioProcessor::processBlock (AudioSampleBuffer& buffer, MidiBuffer&
         buffer.clear (i, 0, buffer.getNumSamples());
 
 #if ! JUCE_AUDIOPROCESSOR_NO_GUI
-    // Push input buffer into the Pre spectroscope component.
-    if (editor)
-        editor->m_vizPre->pushBuffer(buffer);
+    // Publish the input for the Pre spectroscope, a no-op while the editor is closed.
+    if (buffer.getNumChannels() > 0)
+        m_tapPre.push(buffer.getReadPointer(0), buffer.getNumSamples());
 #endif
 
     // Now the guts of the processing; oversampling and applying the Faust dsp module.
@@ -244,9 +244,9 @@ void TemperAudioProcessor::processBlock (AudioSampleBuffer& buffer, MidiBuffer&
     m_oversampler->processSamplesDown(block);
 
 #if ! JUCE_AUDIOPROCESSOR_NO_GUI
-    // Push resulting buffer into the Post spectroscope component.
-    if (editor)
-        editor->m_vizPost->pushBuffer(buffer);
+    // Publish the resulting buffer for the Post spectroscope.
+    if (buffer.getNumChannels() > 0)
+        m_tapPost.push(buffer.getReadPointer(0), buffer.getNumSamples());
 #endif
 }
 
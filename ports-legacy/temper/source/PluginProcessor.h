@@ -14,6 +14,7 @@
 #include "JuceHeader.h"
 #include "FaustUIBridge.h"
 #include "RestrictionProcessor.h"
+#include "AnalysisTap.h"
 
 #include "faust/dsp/dsp.h"
 
@@ -42,6 +43,10 @@ public:
     //==============================================================================
     AudioProcessorEditor* createEditor() override;
     bool hasEditor() const override;
+
+    // The input and output signals for the spectroscopes, published by processBlock
+    analysistap::AnalysisTap& getPreTap() { return m_tapPre; }
+    analysistap::AnalysisTap& getPostTap() { return m_tapPost; }
 #endif
 
     //==============================================================================
@@ -73,6 +78,9 @@ private:
     double m_lastKnownSampleRate;
     int m_currentProgram;
 
+    analysistap::AnalysisTap m_tapPre;
+    analysistap::AnalysisTap m_tapPost;
+
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (TemperAudioProcessor)
 };
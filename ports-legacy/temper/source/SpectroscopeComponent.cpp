@@ -12,8 +12,9 @@
 #include "SpectroscopeComponent.h"
 
 //==============================================================================
-SpectroscopeComponent::SpectroscopeComponent()
-:   m_fifoIndex(0),
+SpectroscopeComponent::SpectroscopeComponent(analysistap::AnalysisTap& tap)
+:   m_tap(tap),
+    m_fifoIndex(0),
     m_fftBlockReady(false),
     m_forwardFFT(kFFTOrder),
     m_window(kFFTSize, juce::dsp::WindowingFunction<float>::hann),
@@ -23,12 +24,15 @@ SpectroscopeComponent::SpectroscopeComponent()
 {
     zeromem(m_outputData, sizeof(m_outputData));
     setSize(700, 200);
+
+    m_tap.setActive(true);
     startTimerHz(30);
 }
 
 SpectroscopeComponent::~SpectroscopeComponent()
 {
     stopTimer();
+    m_tap.setActive(false);
 }
 
 void SpectroscopeComponent::paint (Graphics& g)
@@ -69,6 +73,14 @@ void SpectroscopeComponent::resized()
 
 void SpectroscopeComponent::timerCallback()
 {
+    // Collect what the audio thread published since the last tick
+    int numSamples;
+    while ((numSamples = m_tap.pull(m_pullBuffer, kFFTSize)) > 0)
+    {
+        for (int i = 0; i < numSamples; ++i)
+            pushSample(m_pullBuffer[i]);
+    }
+
     if (m_fftBlockReady)
     {
         // Compute the frequency transform
@@ -92,18 +104,6 @@ void SpectroscopeComponent::timerCallback()
     repaint();
 }
 
-void SpectroscopeComponent::pushBuffer(AudioSampleBuffer &buffer)
-{
-    if (buffer.getNumChannels() > 0)
-    {
-        const int numSamples = buffer.getNumSamples();
-        const float* channelData = buffer.getReadPointer(0);
-
-        for (int i = 0; i < numSamples; ++i)
-            pushSample(channelData[i]);
-    }
-}
-
 inline void SpectroscopeComponent::pushSample(float sample)
 {
     // When we wrap around the fifo table, we copy the data into the
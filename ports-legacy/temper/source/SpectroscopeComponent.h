@@ -12,24 +12,25 @@
 #define SPECTROSCOPECOMPONENT_H_INCLUDED
 
 #include "JuceHeader.h"
+#include "AnalysisTap.h"
 
 //==============================================================================
 /*
+    Draws the spectrum of the signal published to an analysis tap. The samples
+    are pulled and transformed on the message thread, the tap is active while
+    the component exists.
 */
 class SpectroscopeComponent    : public Component,
                                  private Timer
 {
 public:
-    SpectroscopeComponent();
+    SpectroscopeComponent (analysistap::AnalysisTap& tap);
     ~SpectroscopeComponent();
 
     void paint (Graphics&) override;
     void resized() override;
     void timerCallback() override;
 
-    void pushBuffer (AudioSampleBuffer& buffer);
-    inline void pushSample (float sample);
-
     void setColours (Colour strokeColour, Colour fillStartColour, Colour fillStopColour);
 
     enum {
@@ -39,6 +40,10 @@ public:
     };
 
 private:
+    inline void pushSample (float sample);
+
+    analysistap::AnalysisTap& m_tap;
+    float m_pullBuffer [kFFTSize];
     float m_fifo [kFFTSize];
     float m_fftData [2 * kFFTSize];
     float m_outputData [kOutputSize];
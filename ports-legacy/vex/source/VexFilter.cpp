@@ -396,6 +396,7 @@ void VexFilter::prepareToPlay (double sampleRate, int bufferSize)
 
     fSynth.setBufferSize(bufferSize);
     fSynth.setSampleRate(sampleRate);
+    fSynth.setParallelParts(VEX_PARALLEL_PARTS != 0);
 
     // some params depend on sample rate
     for (unsigned int i = 0; i < kParamCount; ++i)
@@ -404,6 +405,7 @@ void VexFilter::prepareToPlay (double sampleRate, int bufferSize)
 
 void VexFilter::releaseResources()
 {
+    fSynth.setParallelParts(false);
 }
 
 void VexFilter::processBlock(AudioSampleBuffer& output, MidiBuffer& midiInBuffer)
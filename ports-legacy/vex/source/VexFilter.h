@@ -45,6 +45,13 @@
 
 #include "VexEditorComponent.h"
 
+/** Set this to 1 to render the 3 synth parts on parallel worker threads
+    before they get mixed into the shared delay, chorus and reverb.
+*/
+#ifndef VEX_PARALLEL_PARTS
+ #define VEX_PARALLEL_PARTS 0
+#endif
+
 class VexFilter : public AudioProcessor,
                   public VexEditorComponent::Callback
 {
@@ -55,6 +55,8 @@ public:
           part2(false),
           part3(false)
     {
+        partRendered[0] = partRendered[1] = partRendered[2] = false;
+
         for (int i = 0; i < kNumVoices; ++i)
         {
             vo1[i] = new VexVoice(p,  0, wr1, sampleRate);
@@ -65,6 +67,8 @@ public:
 
     ~VexSyntModule()
     {
+        setParallelParts(false);
+
         for (int i = 0; i < kNumVoices; ++i)
         {
             delete vo1[i];
@@ -77,84 +81,134 @@ public:
     {
         const int numSamples = obf.getNumSamples();
 
-        if (tmpBuf.getNumSamples() != numSamples)
-            tmpBuf.setSize(2, numSamples, false, false, true);
-
-        tmpBuf.clear();
-
-        float* const outPtrL = tmpBuf.getWritePointer(0);
-        float* const outPtrR = tmpBuf.getWritePointer(1);
-
-        if (part1)
+        for (int i = 0; i < kNumParts; ++i)
         {
-            const float right = parameters[86] * parameters[83];
-            const float left  = parameters[86] * (1.0f - parameters[83]);
-
-            for (int i = 0; i < kNumVoices; ++i)
+            if (tmpBuf[i].getNumSamples() != numSamples)
             {
-                if (vo1[i]->getIsOn())
-                {
-                    vo1[i]->doProcess(outPtrL, outPtrR, numSamples);
-                    obf.addFrom(0, 0,  tmpBuf, 0, 0, numSamples, left);
-                    obf.addFrom(1, 0,  tmpBuf, 1, 0, numSamples, right);
-                    ebf1.addFrom(0, 0, tmpBuf, 0, 0, numSamples, parameters[22] * left);
-                    ebf1.addFrom(1, 0, tmpBuf, 1, 0, numSamples, parameters[22] * right);
-                    ebf2.addFrom(0, 0, tmpBuf, 0, 0, numSamples, parameters[23] * left);
-                    ebf2.addFrom(1, 0, tmpBuf, 1, 0, numSamples, parameters[23] * right);
-                    ebf3.addFrom(0, 0, tmpBuf, 0, 0, numSamples, parameters[24] * left);
-                    ebf3.addFrom(1, 0, tmpBuf, 1, 0, numSamples, parameters[24] * right);
-                }
+                tmpBuf[i].setSize(2, numSamples, false, false, true);
+                partBuf[i].setSize(8, numSamples, false, false, true);
             }
         }
 
-        if (part2)
+        // parts only share read-only parameters, so they can be rendered at the same time
+        if (worker2 != nullptr && worker3 != nullptr)
         {
-            const float right = parameters[87] * parameters[84];
-            const float left  = parameters[87] * (1.0f - parameters[84]);
+            worker2->render(numSamples);
+            worker3->render(numSamples);
+            renderPart(1, numSamples);
+            worker2->waitForRender();
+            worker3->waitForRender();
+        }
+        else
+        {
+            renderPart(1, numSamples);
+            renderPart(2, numSamples);
+            renderPart(3, numSamples);
+        }
 
-            for (int i = 0; i < kNumVoices; ++i)
-            {
-                if (vo2[i]->getIsOn())
-                {
-                    vo2[i]->doProcess(outPtrL, outPtrR, numSamples);
-                    obf.addFrom(0, 0,  tmpBuf, 0, 0, numSamples, left);
-                    obf.addFrom(1, 0,  tmpBuf, 1, 0, numSamples, right);
-                    ebf1.addFrom(0, 0, tmpBuf, 0, 0, numSamples, parameters[22 + 24] * left);
-                    ebf1.addFrom(1, 0, tmpBuf, 1, 0, numSamples, parameters[22 + 24] * right);
-                    ebf2.addFrom(0, 0, tmpBuf, 0, 0, numSamples, parameters[23 + 24] * left);
-                    ebf2.addFrom(1, 0, tmpBuf, 1, 0, numSamples, parameters[23 + 24] * right);
-                    ebf3.addFrom(0, 0, tmpBuf, 0, 0, numSamples, parameters[24 + 24] * left);
-                    ebf3.addFrom(1, 0, tmpBuf, 1, 0, numSamples, parameters[24 + 24] * right);
-                }
-            }
+        for (int i = 0; i < kNumParts; ++i)
+        {
+            if (! partRendered[i])
+                continue;
+
+            obf.addFrom(0, 0,  partBuf[i], 0, 0, numSamples);
+            obf.addFrom(1, 0,  partBuf[i], 1, 0, numSamples);
+            ebf1.addFrom(0, 0, partBuf[i], 2, 0, numSamples);
+            ebf1.addFrom(1, 0, partBuf[i], 3, 0, numSamples);
+            ebf2.addFrom(0, 0, partBuf[i], 4, 0, numSamples);
+            ebf2.addFrom(1, 0, partBuf[i], 5, 0, numSamples);
+            ebf3.addFrom(0, 0, partBuf[i], 6, 0, numSamples);
+            ebf3.addFrom(1, 0, partBuf[i], 7, 0, numSamples);
         }
+    }
+
+    // Renders all voices of a part into its own output/fx-send buffer
+    void renderPart(const int part, const int numSamples)
+    {
+        const int index = part - 1;
+        const int poff  = index * 24;
 
-        if (part3)
+        VexVoice** v = nullptr;
+        bool enabled = false;
+
+        switch (part)
         {
-            const float right = parameters[88] * parameters[85];
-            const float left  = parameters[88] * (1.0f - parameters[85]);
+        case 1:
+            v = vo1;
+            enabled = part1;
+            break;
+        case 2:
+            v = vo2;
+            enabled = part2;
+            break;
+        case 3:
+            v = vo3;
+            enabled = part3;
+            break;
+        }
 
-            for (int i = 0; i < kNumVoices; ++i)
+        partRendered[index] = false;
+
+        if (v == nullptr || ! enabled)
+            return;
+
+        AudioSampleBuffer& tmp(tmpBuf[index]);
+        AudioSampleBuffer& out(partBuf[index]);
+
+        float* const outPtrL = tmp.getWritePointer(0);
+        float* const outPtrR = tmp.getWritePointer(1);
+
+        const float right = parameters[86 + index] * parameters[83 + index];
+        const float left  = parameters[86 + index] * (1.0f - parameters[83 + index]);
+
+        tmp.clear();
+        out.clear();
+
+        for (int i = 0; i < kNumVoices; ++i)
+        {
+            if (v[i]->getIsOn())
             {
-                if (vo3[i]->getIsOn())
-                {
-                    vo3[i]->doProcess(outPtrL, outPtrR, numSamples);
-                    obf.addFrom(0, 0,  tmpBuf, 0, 0, numSamples, left);
-                    obf.addFrom(1, 0,  tmpBuf, 1, 0, numSamples, right);
-                    ebf1.addFrom(0, 0, tmpBuf, 0, 0, numSamples, parameters[22 + 48] * left);
-                    ebf1.addFrom(1, 0, tmpBuf, 1, 0, numSamples, parameters[22 + 48] * right);
-                    ebf2.addFrom(0, 0, tmpBuf, 0, 0, numSamples, parameters[23 + 48] * left);
-                    ebf2.addFrom(1, 0, tmpBuf, 1, 0, numSamples, parameters[23 + 48] * right);
-                    ebf3.addFrom(0, 0, tmpBuf, 0, 0, numSamples, parameters[24 + 48] * left);
-                    ebf3.addFrom(1, 0, tmpBuf, 1, 0, numSamples, parameters[24 + 48] * right);
-                }
+                v[i]->doProcess(outPtrL, outPtrR, numSamples);
+                out.addFrom(0, 0, tmp, 0, 0, numSamples, left);
+                out.addFrom(1, 0, tmp, 1, 0, numSamples, right);
+                out.addFrom(2, 0, tmp, 0, 0, numSamples, parameters[22 + poff] * left);
+                out.addFrom(3, 0, tmp, 1, 0, numSamples, parameters[22 + poff] * right);
+                out.addFrom(4, 0, tmp, 0, 0, numSamples, parameters[23 + poff] * left);
+                out.addFrom(5, 0, tmp, 1, 0, numSamples, parameters[23 + poff] * right);
+                out.addFrom(6, 0, tmp, 0, 0, numSamples, parameters[24 + poff] * left);
+                out.addFrom(7, 0, tmp, 1, 0, numSamples, parameters[24 + poff] * right);
             }
         }
+
+        partRendered[index] = true;
+    }
+
+    // Parts 2 and 3 get rendered on their own threads while part 1 runs on the caller's.
+    // Must not be called while processing.
+    void setParallelParts(const bool parallel)
+    {
+        if (parallel == (worker2 != nullptr))
+            return;
+
+        if (parallel)
+        {
+            worker2 = new PartWorker(*this, 2);
+            worker3 = new PartWorker(*this, 3);
+        }
+        else
+        {
+            worker2 = nullptr;
+            worker3 = nullptr;
+        }
     }
 
     void setBufferSize(const int size)
     {
-        tmpBuf.setSize(2, size);
+        for (int i = 0; i < kNumParts; ++i)
+        {
+            tmpBuf[i].setSize(2, size);
+            partBuf[i].setSize(8, size);
+        }
     }
 
     void setSampleRate(const double s)
@@ -402,14 +456,72 @@ public:
     }
 
 private:
+    class PartWorker : public Thread
+    {
+    public:
+        PartWorker(VexSyntModule& m, const int p)
+            : Thread("Vex part " + String(p)),
+              module(m),
+              part(p),
+              numSamples(0)
+        {
+            startThread(8);
+        }
+
+        ~PartWorker()
+        {
+            signalThreadShouldExit();
+            startEvent.signal();
+            stopThread(2000);
+        }
+
+        void render(const int n)
+        {
+            numSamples = n;
+            startEvent.signal();
+        }
+
+        void waitForRender()
+        {
+            doneEvent.wait();
+        }
+
+        void run() override
+        {
+            for (;;)
+            {
+                startEvent.wait();
+
+                if (threadShouldExit())
+                    return;
+
+                module.renderPart(part, numSamples);
+                doneEvent.signal();
+            }
+        }
+
+    private:
+        VexSyntModule& module;
+        const int part;
+        int numSamples;
+        WaitableEvent startEvent, doneEvent;
+    };
+
     static const int kNumVoices = 8;
+    static const int kNumParts = 3;
 
     const float* parameters;
 
     double sampleRate;
     int benchwarmer;
 
-    AudioSampleBuffer tmpBuf;
+    // per part: 2 voice scratch channels, and output L/R + 3 fx sends L/R
+    AudioSampleBuffer tmpBuf[kNumParts];
+    AudioSampleBuffer partBuf[kNumParts];
+    bool partRendered[kNumParts];
+
+    ScopedPointer<PartWorker> worker2;
+    ScopedPointer<PartWorker> worker3;
 
     VexVoice* vo1[kNumVoices];
     VexVoice* vo2[kNumVoices];
@@ -50,6 +50,7 @@ struct OscSet {
     float phaseIncOffset;
     float cut;
     float buf[4];
+    int level; // mipmap level picked from phaseInc
 };
 
 struct WaveTableNames {
@@ -67,6 +68,11 @@ public:
           sWave("sine"),
           loadWave(true)
     {
+        // level 0 holds the full table, every other level half the previous one
+        mipData.allocate(kMaxTableSize * 2, true);
+
+        for (int i = 0; i < kNumLevels; ++i)
+            mipTables[i] = mipData.getData();
     }
 
     ~WaveRenderer()
@@ -213,6 +219,8 @@ public:
             tableSize = Wavetables::voice_2_size / 2;
         }
 
+        buildMipmaps();
+
         loadWave = false;
 
 #if 0
@@ -265,6 +273,7 @@ public:
         o.cut = float(2.0 * double_Pi * 9000.0 / s);
         o.phase = o.phaseOffset * tableSize * 0.5f;
         o.phaseInc = float(cycle / (s/f));
+        o.level = getLevelForIncrement(o.phaseInc);
         o.buf[0] = 0.0f;
         o.buf[1] = 0.0f;
         o.buf[2] = 0.0f;
@@ -276,6 +285,7 @@ public:
         s = s * 2.0;
         f = f * 2.0f;
         o.phaseInc = float((float)cycle / (s/f));
+        o.level = getLevelForIncrement(o.phaseInc);
     }
 
     void fillBuffer(float* const buffer, const int bufferSize, OscSet& o)
@@ -283,17 +293,24 @@ public:
         if (buffer == nullptr || bufferSize == 0)
             return;
 
+        // o.phase always runs in level 0 units, the mipmap level only
+        // changes which table is read and how the phase maps onto it
+        const float* const table = mipTables[o.level];
+        const int   mask  = (tableSize >> o.level) - 1;
+        const float scale = 1.0f / float(1 << o.level);
+        const float size  = (float)tableSize;
+
         float tmp;
 
         for (int i = 0; i < bufferSize; ++i)
         {
             buffer[i] = 0.0f;
 
-            int index = roundFloatToInt(o.phase - 0.5f);
-            float alpha = o.phase - (float)index;
-            const float conv = 1.0f / 65535.0f;
-            float sIndex = daTable[index] * conv - 0.5f;
-            float sIndexp1 = daTable[(index + 1) % tableSize] * conv - 0.5f;
+            float pos = o.phase * scale;
+            int index = (int)pos;
+            float alpha = pos - (float)index;
+            float sIndex = table[index & mask];
+            float sIndexp1 = table[(index + 1) & mask];
 
             tmp = sIndex + alpha * (sIndexp1 - sIndex);
             o.buf[1] = ((tmp - o.buf[1]) * o.cut) + o.buf[1];
@@ -304,13 +321,13 @@ public:
             tmp = o.buf[0];
             buffer[i] += tmp;
             o.phase += o.phaseInc;
-            if (o.phase > (float)tableSize)
-                o.phase -= (float)tableSize;
+            o.phase -= size * (float)(o.phase >= size);
 
-            index = roundFloatToInt(o.phase - 0.5f);
-            alpha = o.phase - (float)index;
-            sIndex = daTable[index] * conv - 0.5f;
-            sIndexp1 = daTable[(index + 1) % tableSize] * conv - 0.5f;
+            pos = o.phase * scale;
+            index = (int)pos;
+            alpha = pos - (float)index;
+            sIndex = table[index & mask];
+            sIndexp1 = table[(index + 1) & mask];
 
             tmp = sIndex + alpha * (sIndexp1 - sIndex);
             o.buf[1] = ((tmp - o.buf[1]) * o.cut) + o.buf[1];
@@ -321,8 +338,7 @@ public:
             tmp = o.buf[0];
             buffer[i] += tmp;
             o.phase += o.phaseInc;
-            if (o.phase > (float)tableSize)
-                o.phase -= (float)tableSize;
+            o.phase -= size * (float)(o.phase >= size);
         }
     }
 
@@ -333,8 +349,78 @@ private:
     static const int kWaveTableSize = 41;
     static WaveTableNames waveTableNames[kWaveTableSize];
 
+    // all embedded tables are powers of two, the biggest being 65536 samples
+    static const int kMaxTableSize = 65536;
+
+    // one level per octave, the last one keeps 2 harmonics (4 samples per cycle)
+    static const int kNumLevels = 7;
+
+    static int getLevelForIncrement(float inc) noexcept
+    {
+        // level n is bandlimited so that its highest harmonic stays below
+        // nyquist as long as the read step is no bigger than 2^n samples
+        int level = 0;
+
+        while (inc > 1.0f && level < kNumLevels - 1)
+        {
+            inc *= 0.5f;
+            ++level;
+        }
+
+        return level;
+    }
+
+    void buildMipmaps()
+    {
+        jassert (tableSize > 0 && tableSize <= kMaxTableSize);
+        jassert (isPowerOfTwo (tableSize));
+
+        const float conv = 1.0f / 65535.0f;
+        float* level0 = mipData.getData();
+
+        for (int i = 0; i < tableSize; ++i)
+            level0[i] = daTable[i] * conv - 0.5f;
+
+        mipTables[0] = level0;
+
+        // halfband lowpass + decimate by 2, wrapping around since tables are periodic
+        static const int kHalfTaps = 15;
+        float coeffs[kHalfTaps * 2 + 1];
+
+        for (int n = -kHalfTaps; n <= kHalfTaps; ++n)
+        {
+            const double x = double_Pi * n * 0.5;
+            const double sinc = (n == 0) ? 1.0 : std::sin(x) / x;
+            const double window = 0.42 + 0.5 * std::cos(double_Pi * n / (kHalfTaps + 1))
+                                       + 0.08 * std::cos(2.0 * double_Pi * n / (kHalfTaps + 1));
+            coeffs[n + kHalfTaps] = float(0.5 * sinc * window);
+        }
+
+        for (int level = 1; level < kNumLevels; ++level)
+        {
+            const float* const src = mipTables[level - 1];
+            const int srcMask = (tableSize >> (level - 1)) - 1;
+            const int dstSize = tableSize >> level;
+            float* const dst  = mipTables[level - 1] + (srcMask + 1);
+
+            for (int i = 0; i < dstSize; ++i)
+            {
+                float sum = 0.0f;
+
+                for (int n = -kHalfTaps; n <= kHalfTaps; ++n)
+                    sum += coeffs[n + kHalfTaps] * src[(i * 2 - n) & srcMask];
+
+                dst[i] = sum;
+            }
+
+            mipTables[level] = dst;
+        }
+    }
+
     int cycle, tableSize;
     uint16* daTable;
+    HeapBlock<float> mipData;
+    float* mipTables[kNumLevels];
     //MemoryBlock M;
     String sWave;
     bool loadWave;
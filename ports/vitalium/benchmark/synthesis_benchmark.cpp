@@ -0,0 +1,261 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Times the synthesis engine without the interface. Every scenario switches on one building block
+// (an oscillator setting, a filter model, an effect or an oversampling amount), plays held notes
+// through the whole engine and reads the time of each module from the engine profiler, so the
+// processors run with the inputs, modulation and voice handling they get in the plugin.
+//
+// Usage: vitalium-benchmark [--quick] [--json results.json]
+
+#include "JuceHeader.h"
+#include "json/json.h"
+#include "sound_engine.h"
+#include "synth_constants.h"
+#include "synth_parameters.h"
+#include "synth_strings.h"
+#include "wave_frame.h"
+#include "wavetable.h"
+
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+
+#if !VITAL_PROFILE
+  #error "The benchmark reads the engine profiler, build it with VITAL_PROFILE=1."
+#endif
+
+namespace {
+  constexpr double kWarmUpSeconds = 0.25;
+  constexpr double kMeasureSeconds = 1.0;
+  constexpr double kQuickMeasureSeconds = 0.2;
+  constexpr int kLowestNote = 36;
+  constexpr int kNoteSpacing = 2;
+  constexpr float kVelocity = 0.8f;
+  constexpr float kBpm = 120.0f;
+
+  const int kSampleRates[] = { 44100, 96000 };
+  const int kBlockSizes[] = { 32, 128 };
+  const int kVoiceCounts[] = { 1, 8, 32 };
+
+  struct Scenario {
+    std::string name;
+    std::string module;
+    std::vector<std::pair<std::string, float>> settings;
+    bool polyphonic;
+  };
+
+  struct BenchmarkResult {
+    std::string scenario;
+    std::string module;
+    int sample_rate;
+    int block_size;
+    int voices;
+    double engine_ns_per_sample;
+    double voices_per_core;
+    std::map<std::string, double> module_ns_per_sample;
+  };
+
+  std::string toLower(std::string text) {
+    for (char& character : text)
+      character = std::tolower(character);
+    return text;
+  }
+
+  std::vector<Scenario> createScenarios() {
+    std::vector<Scenario> scenarios;
+    scenarios.push_back({ "oscillator", "osc_1", { }, true });
+    scenarios.push_back({ "oscillator_unison", "osc_1", { { "osc_1_unison_voices", 8.0f } }, true });
+
+    for (int i = 0; i < vital::constants::kNumFilterModels; ++i) {
+      std::string name = "filter_" + toLower(strings::kFilterModelNames[i]);
+      std::vector<std::pair<std::string, float>> settings = { { "filter_1_on", 1.0f },
+                                                              { "filter_1_model", static_cast<float>(i) } };
+      scenarios.push_back({ name, "filter_1", settings, true });
+    }
+
+    const std::string effects[] = {
+      "chorus", "compressor", "delay", "distortion", "eq", "flanger", "phaser", "reverb"
+    };
+    for (const std::string& effect : effects)
+      scenarios.push_back({ effect, effect, { { effect + "_on", 1.0f } }, false });
+
+    scenarios.push_back({ "oversampling_1x", "decimator", { { "oversampling", 0.0f } }, true });
+    scenarios.push_back({ "oversampling_4x", "decimator", { { "oversampling", 2.0f } }, true });
+    return scenarios;
+  }
+
+  void loadSawWavetables(vital::SoundEngine* engine) {
+    float saw[vital::WaveFrame::kWaveformSize];
+    for (int i = 0; i < vital::WaveFrame::kWaveformSize; ++i)
+      saw[i] = 1.0f - 2.0f * i / vital::WaveFrame::kWaveformSize;
+
+    vital::WaveFrame frame;
+    frame.loadTimeDomain(saw);
+    for (int i = 0; i < vital::kNumOscillators; ++i) {
+      engine->getWavetable(i)->setNumFrames(1);
+      engine->getWavetable(i)->loadWaveFrame(&frame);
+    }
+  }
+
+  void processSeconds(vital::SoundEngine* engine, double seconds, int sample_rate, int block_size) {
+    int blocks = seconds * sample_rate / block_size;
+    for (int i = 0; i < blocks; ++i)
+      engine->process(block_size);
+  }
+
+  BenchmarkResult run(const Scenario& scenario, int sample_rate, int block_size, int voices, double measure_seconds) {
+    vital::SoundEngine engine;
+    loadSawWavetables(&engine);
+
+    vital::control_map controls = engine.getControls();
+    for (auto& control : controls)
+      control.second->set(vital::Parameters::getDetails(control.first).default_value);
+    for (auto& setting : scenario.settings)
+      controls[setting.first]->set(setting.second);
+    controls["polyphony"]->set(voices);
+
+    engine.setSampleRate(sample_rate);
+    engine.checkOversampling();
+    engine.setBpm(kBpm);
+    engine.updateAllModulationSwitches();
+
+    for (int i = 0; i < voices; ++i)
+      engine.noteOn(kLowestNote + i * kNoteSpacing, kVelocity, 0, 0);
+    processSeconds(&engine, kWarmUpSeconds, sample_rate, block_size);
+
+    std::vector<vital::Processor*> processors;
+    engine.getProfiledProcessors(processors);
+    for (vital::Processor* processor : processors)
+      processor->resetProfile();
+
+    vital::profiler::setEnabled(true);
+    auto start = std::chrono::steady_clock::now();
+    processSeconds(&engine, measure_seconds, sample_rate, block_size);
+    double elapsed_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    vital::profiler::setEnabled(false);
+
+    std::map<std::string, vital::ProfileEntry> totals;
+    for (vital::Processor* processor : processors) {
+      vital::ProfileEntry entry = processor->getProfile();
+      vital::ProfileEntry& total = totals[entry.name];
+      total.cycles += entry.cycles;
+      total.calls += entry.calls;
+      total.polyphonic = total.polyphonic || entry.polyphonic;
+    }
+
+    // The profiler counts in its own unit, the engine total converts it to wall clock time.
+    double engine_cycles = std::max<double>(1.0, totals["engine"].cycles);
+    double ns_per_cycle = elapsed_ns / engine_cycles;
+    double samples = static_cast<int>(measure_seconds * sample_rate / block_size) * block_size;
+
+    BenchmarkResult result;
+    result.scenario = scenario.name;
+    result.module = scenario.module;
+    result.sample_rate = sample_rate;
+    result.block_size = block_size;
+    result.voices = voices;
+    result.engine_ns_per_sample = elapsed_ns / samples;
+
+    double mono_ns = 0.0;
+    double module_ns = 0.0;
+    for (auto& total : totals) {
+      if (total.first == "engine" || total.second.calls == 0)
+        continue;
+
+      double ns = total.second.cycles * ns_per_cycle / samples;
+      result.module_ns_per_sample[total.first] = ns;
+      module_ns += ns;
+      if (!total.second.polyphonic)
+        mono_ns += ns;
+    }
+    result.module_ns_per_sample["other"] = std::max(0.0, result.engine_ns_per_sample - module_ns);
+
+    // Everything that is not a mono module grows with the voices, what fits in one sample period is the
+    // number of voices a core can play in real time.
+    double voice_ns = (result.engine_ns_per_sample - mono_ns) / voices;
+    result.voices_per_core = voice_ns > 0.0 ? (1e9 / sample_rate) / voice_ns : 0.0;
+    return result;
+  }
+
+  json toJson(const BenchmarkResult& result) {
+    json modules;
+    for (auto& module : result.module_ns_per_sample)
+      modules[module.first] = module.second;
+
+    return {
+      { "scenario", result.scenario },
+      { "module", result.module },
+      { "sample_rate", result.sample_rate },
+      { "block_size", result.block_size },
+      { "voices", result.voices },
+      { "engine_ns_per_sample", result.engine_ns_per_sample },
+      { "voices_per_core", result.voices_per_core },
+      { "modules_ns_per_sample", modules }
+    };
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  double measure_seconds = kMeasureSeconds;
+  std::string json_path;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--quick") == 0)
+      measure_seconds = kQuickMeasureSeconds;
+    else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+      json_path = argv[++i];
+    else {
+      fprintf(stderr, "Usage: %s [--quick] [--json results.json]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  printf("Engine and module times are nanoseconds per output sample.\n\n");
+  printf("%-20s %-11s %6s %5s %6s %12s %12s %11s\n", "scenario", "module", "rate", "block", "voices",
+         "engine", "module", "voices/core");
+
+  json results = json::array();
+  for (const Scenario& scenario : createScenarios()) {
+    for (int sample_rate : kSampleRates) {
+      for (int block_size : kBlockSizes) {
+        for (int voices : kVoiceCounts) {
+          if (!scenario.polyphonic && voices != kVoiceCounts[0])
+            continue;
+
+          BenchmarkResult result = run(scenario, sample_rate, block_size, voices, measure_seconds);
+          printf("%-20s %-11s %6d %5d %6d %12.1f %12.1f %11.1f\n", result.scenario.c_str(), result.module.c_str(),
+                 result.sample_rate, result.block_size, result.voices, result.engine_ns_per_sample,
+                 result.module_ns_per_sample[result.module], result.voices_per_core);
+          fflush(stdout);
+          results.push_back(toJson(result));
+        }
+      }
+    }
+  }
+
+  if (!json_path.empty()) {
+    std::ofstream stream(json_path);
+    stream << results.dump(2) << std::endl;
+  }
+  return 0;
+}
@@ -0,0 +1,290 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "binary_state.h"
+
+namespace {
+  constexpr char kMagic[] = { 'V', 'I', 'T', 'B' };
+  constexpr int kMagicSize = 4;
+  constexpr int kHeaderSize = kMagicSize + 2 * sizeof(int32_t);
+  constexpr int kChunkIdSize = 4;
+  constexpr char kParametersChunk[] = "PRMS";
+  constexpr char kBlobsChunk[] = "BLOB";
+  constexpr char kTreeChunk[] = "TREE";
+  constexpr int kCorruptedError = 110;
+  // An empty name's terminator and the value, or an empty path's terminator and the size.
+  constexpr int kMinParameterSize = 1 + sizeof(float);
+  constexpr int kMinBlobSize = 1 + sizeof(int32_t);
+  constexpr char kRawBlobKey[] = "raw_blob";
+
+  thread_local int raw_blob_scopes = 0;
+
+  struct Blob {
+    std::string path;
+    std::string data;
+  };
+
+  bool isRawBlob(const json& value) {
+    if (!value.is_object() || value.size() != 1)
+      return false;
+
+    auto raw = value.find(kRawBlobKey);
+    return raw != value.end() && raw->is_string();
+  }
+
+  json::parse_error corrupted(size_t position) {
+    return json::parse_error::create(kCorruptedError, position, "binary state is corrupted");
+  }
+
+  std::string escapePointerToken(const std::string& token) {
+    std::string escaped;
+    for (char character : token) {
+      if (character == '~')
+        escaped += "~0";
+      else if (character == '/')
+        escaped += "~1";
+      else
+        escaped += character;
+    }
+    return escaped;
+  }
+
+  void extractBlobs(json& data, const std::string& path, std::vector<Blob>& blobs) {
+    if (data.is_array()) {
+      for (int i = 0; i < data.size(); ++i)
+        extractBlobs(data[i], path + "/" + std::to_string(i), blobs);
+      return;
+    }
+
+    if (!data.is_object())
+      return;
+
+    for (auto it = data.begin(); it != data.end();) {
+      std::string child_path = path + "/" + escapePointerToken(it.key());
+
+      if (isRawBlob(it.value())) {
+        std::string& bytes = it.value()[kRawBlobKey].get_ref<std::string&>();
+        blobs.push_back({ child_path, std::move(bytes) });
+        it = data.erase(it);
+        continue;
+      }
+
+      extractBlobs(it.value(), child_path, blobs);
+      ++it;
+    }
+  }
+
+  void writeChunk(OutputStream& stream, const char* id, const void* data, size_t size) {
+    stream.write(id, kChunkIdSize);
+    stream.writeInt(static_cast<int>(size));
+    stream.write(data, size);
+  }
+
+  void readParameters(MemoryInputStream& stream, json& settings) {
+    int num_parameters = stream.readInt();
+    if (num_parameters < 0 || num_parameters > stream.getNumBytesRemaining() / kMinParameterSize)
+      throw corrupted(stream.getPosition());
+
+    for (int i = 0; i < num_parameters; ++i) {
+      std::string name = stream.readString().toStdString();
+      if (stream.getNumBytesRemaining() < sizeof(float))
+        throw corrupted(stream.getPosition());
+      settings[name] = stream.readFloat();
+    }
+  }
+
+  void readBlobs(MemoryInputStream& stream, std::vector<Blob>& blobs) {
+    int num_blobs = stream.readInt();
+    if (num_blobs < 0 || num_blobs > stream.getNumBytesRemaining() / kMinBlobSize)
+      throw corrupted(stream.getPosition());
+
+    for (int i = 0; i < num_blobs; ++i) {
+      Blob blob;
+      blob.path = stream.readString().toStdString();
+      if (stream.getNumBytesRemaining() < sizeof(int32_t))
+        throw corrupted(stream.getPosition());
+      int size = stream.readInt();
+      if (size < 0 || size > stream.getNumBytesRemaining())
+        throw corrupted(stream.getPosition());
+
+      blob.data.resize(size);
+      if (size)
+        stream.read(&blob.data[0], size);
+      blobs.push_back(std::move(blob));
+    }
+  }
+} // namespace
+
+BinaryState::RawBlobs::RawBlobs(bool enabled) : enabled_(enabled) {
+  if (enabled_)
+    raw_blob_scopes++;
+}
+
+BinaryState::RawBlobs::~RawBlobs() {
+  if (enabled_)
+    raw_blob_scopes--;
+}
+
+json BinaryState::encodeBlob(const void* data, size_t size) {
+  if (raw_blob_scopes == 0)
+    return Base64::toBase64(data, size).toStdString();
+
+  json blob;
+  blob[kRawBlobKey] = size ? std::string(static_cast<const char*>(data), size) : std::string();
+  return blob;
+}
+
+MemoryBlock BinaryState::decodeBlob(const json& value) {
+  if (isRawBlob(value)) {
+    const std::string& bytes = value[kRawBlobKey].get_ref<const std::string&>();
+    return MemoryBlock(bytes.data(), bytes.size());
+  }
+
+  MemoryOutputStream decoded;
+  if (value.is_string())
+    Base64::convertFromBase64(decoded, value.get<std::string>());
+  return decoded.getMemoryBlock();
+}
+
+bool BinaryState::isBinaryState(const void* data, size_t size) {
+  return size >= kHeaderSize && memcmp(data, kMagic, kMagicSize) == 0;
+}
+
+void BinaryState::jsonToBinary(json state, MemoryBlock& destination, bool compress) {
+  json& tree = state;
+
+  MemoryOutputStream parameters;
+  if (tree.count("settings") && tree["settings"].is_object()) {
+    json& settings = tree["settings"];
+    std::vector<std::pair<std::string, float>> values;
+    for (auto it = settings.begin(); it != settings.end();) {
+      if (it.value().is_number_float()) {
+        double value = it.value();
+        if (static_cast<double>(static_cast<float>(value)) == value) {
+          values.push_back({ it.key(), static_cast<float>(value) });
+          it = settings.erase(it);
+          continue;
+        }
+      }
+      ++it;
+    }
+
+    parameters.writeInt(static_cast<int>(values.size()));
+    for (auto& value : values) {
+      parameters.writeString(value.first);
+      parameters.writeFloat(value.second);
+    }
+  }
+
+  std::vector<Blob> blobs;
+  extractBlobs(tree, "", blobs);
+  MemoryOutputStream blob_data;
+  blob_data.writeInt(static_cast<int>(blobs.size()));
+  for (Blob& blob : blobs) {
+    blob_data.writeString(blob.path);
+    blob_data.writeInt(static_cast<int>(blob.data.size()));
+    blob_data.write(blob.data.data(), blob.data.size());
+  }
+
+  std::vector<uint8_t> tree_data = json::to_cbor(tree);
+
+  MemoryOutputStream chunks;
+  if (parameters.getDataSize())
+    writeChunk(chunks, kParametersChunk, parameters.getData(), parameters.getDataSize());
+  writeChunk(chunks, kBlobsChunk, blob_data.getData(), blob_data.getDataSize());
+  writeChunk(chunks, kTreeChunk, tree_data.data(), tree_data.size());
+
+  MemoryOutputStream output(destination, false);
+  output.write(kMagic, kMagicSize);
+  output.writeInt(kVersion);
+  output.writeInt(compress ? kCompressed : 0);
+
+  if (compress) {
+    GZIPCompressorOutputStream compressed(output);
+    compressed.write(chunks.getData(), chunks.getDataSize());
+  }
+  else
+    output.write(chunks.getData(), chunks.getDataSize());
+}
+
+json BinaryState::binaryToJson(const void* data, size_t size) {
+  if (!isBinaryState(data, size))
+    throw corrupted(0);
+
+  MemoryInputStream header(data, size, false);
+  header.skipNextBytes(kMagicSize);
+  int version = header.readInt();
+  int flags = header.readInt();
+  if (version > kVersion)
+    throw json::parse_error::create(kCorruptedError, 0, "binary state was written by a newer version");
+
+  MemoryBlock chunks;
+  if (flags & kCompressed) {
+    MemoryInputStream compressed(static_cast<const char*>(data) + kHeaderSize, size - kHeaderSize, false);
+    GZIPDecompressorInputStream decompressed(compressed);
+    decompressed.readIntoMemoryBlock(chunks);
+  }
+  else
+    chunks.append(static_cast<const char*>(data) + kHeaderSize, size - kHeaderSize);
+
+  json state;
+  json parameters = json::object();
+  std::vector<Blob> blobs;
+  bool has_tree = false;
+
+  MemoryInputStream stream(chunks, false);
+  while (stream.getNumBytesRemaining() > 0) {
+    char id[kChunkIdSize];
+    if (stream.read(id, kChunkIdSize) != kChunkIdSize || stream.getNumBytesRemaining() < sizeof(int32_t))
+      throw corrupted(stream.getPosition());
+
+    int chunk_size = stream.readInt();
+    if (chunk_size < 0 || chunk_size > stream.getNumBytesRemaining())
+      throw corrupted(stream.getPosition());
+
+    int64 chunk_end = stream.getPosition() + chunk_size;
+    MemoryInputStream chunk(static_cast<const char*>(chunks.getData()) + stream.getPosition(), chunk_size, false);
+
+    if (memcmp(id, kTreeChunk, kChunkIdSize) == 0) {
+      const uint8_t* tree_data = static_cast<const uint8_t*>(chunks.getData()) + stream.getPosition();
+      state = json::from_cbor(tree_data, tree_data + chunk_size);
+      has_tree = true;
+    }
+    else if (memcmp(id, kParametersChunk, kChunkIdSize) == 0)
+      readParameters(chunk, parameters);
+    else if (memcmp(id, kBlobsChunk, kChunkIdSize) == 0)
+      readBlobs(chunk, blobs);
+
+    stream.setPosition(chunk_end);
+  }
+
+  if (!has_tree)
+    throw corrupted(stream.getPosition());
+
+  if (!parameters.empty()) {
+    json& settings = state["settings"];
+    for (auto it = parameters.begin(); it != parameters.end(); ++it)
+      settings[it.key()] = it.value();
+  }
+
+  for (Blob& blob : blobs) {
+    json raw;
+    raw[kRawBlobKey] = std::move(blob.data);
+    state[json::json_pointer(blob.path)] = std::move(raw);
+  }
+
+  return state;
+}
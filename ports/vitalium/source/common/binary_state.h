@@ -0,0 +1,60 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "json/json.h"
+
+using json = nlohmann::json;
+
+// Chunked binary encoding of the json state LoadSave works with.
+//
+// Header: "VITB", version, flags. The chunks that follow are gzipped when kCompressed is set.
+// Chunks: four character id, byte size, payload.
+//   PRMS  settings that are plain float values, as name and 32 bit float pairs.
+//   BLOB  raw blob fields (samples, wave data, audio files) as json pointer and bytes.
+//   TREE  everything else as CBOR.
+//
+// Blob fields are written with encodeBlob and read with decodeBlob. They are base64 text, as the
+// text format stores them, unless a RawBlobs scope is open on the thread that builds the json. Then
+// they hold the bytes as they are, which only jsonToBinary can store, and binaryToJson gives them
+// back the same way. Neither side runs base64.
+class BinaryState {
+  public:
+    static constexpr int kVersion = 1;
+
+    enum Flags {
+      kCompressed = 1
+    };
+
+    // Open while building json that goes to jsonToBinary.
+    class RawBlobs {
+      public:
+        explicit RawBlobs(bool enabled = true);
+        ~RawBlobs();
+
+      private:
+        bool enabled_;
+    };
+
+    static json encodeBlob(const void* data, size_t size);
+    static MemoryBlock decodeBlob(const json& value);
+
+    static bool isBinaryState(const void* data, size_t size);
+    static void jsonToBinary(json state, MemoryBlock& destination, bool compress);
+    static json binaryToJson(const void* data, size_t size);
+};
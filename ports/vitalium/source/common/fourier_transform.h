@@ -174,7 +174,7 @@ namespace vital {
   class FFT {
     public:
       static FourierTransform* transform() {
-        static FFT<bits> instance;
+        static thread_local FFT<bits> instance;
         return &instance.fourier_transform_;
       }
 
@@ -15,6 +15,7 @@
  */
 
 #include "load_save.h"
+#include "binary_state.h"
 #include "modulation_connection_processor.h"
 #include "sound_engine.h"
 #include "midi_manager.h"
@@ -57,14 +58,16 @@ const std::string LoadSave::kLfoFolderName = "LFOs";
 const std::string LoadSave::kAdditionalWavetableFoldersName = "wavetable_folders";
 const std::string LoadSave::kAdditionalSampleFoldersName = "sample_folders";
 
+LoadSave::PreparedState::PreparedState() { }
+
+LoadSave::PreparedState::~PreparedState() { }
+
 void LoadSave::convertBufferToPcm(json& data, const std::string& field) {
   if (data.count(field) == 0)
     return;
 
-  MemoryOutputStream decoded;
-  std::string wave_data = data[field];
-  Base64::convertFromBase64(decoded, wave_data);
-  int size = static_cast<int>(decoded.getDataSize()) / sizeof(float);
+  MemoryBlock decoded = BinaryState::decodeBlob(data[field]);
+  int size = static_cast<int>(decoded.getSize()) / sizeof(float);
   std::unique_ptr<float[]> float_data = std::make_unique<float[]>(size);
   memcpy(float_data.get(), decoded.getData(), size * sizeof(float));
   std::unique_ptr<int16_t[]> pcm_data = std::make_unique<int16_t[]>(size);
@@ -78,10 +81,8 @@ void LoadSave::convertPcmToFloatBuffer(json& data, const std::string& field) {
   if (data.count(field) == 0)
     return;
 
-  MemoryOutputStream decoded;
-  std::string wave_data = data[field];
-  Base64::convertFromBase64(decoded, wave_data);
-  int size = static_cast<int>(decoded.getDataSize()) / sizeof(int16_t);
+  MemoryBlock decoded = BinaryState::decodeBlob(data[field]);
+  int size = static_cast<int>(decoded.getSize()) / sizeof(int16_t);
   std::unique_ptr<int16_t[]> pcm_data = std::make_unique<int16_t[]>(size);
   memcpy(pcm_data.get(), decoded.getData(), size * sizeof(int16_t));
   std::unique_ptr<float[]> float_data = std::make_unique<float[]>(size);
@@ -197,8 +198,8 @@ void LoadSave::loadModulations(SynthBase* synth, const json& modulations) {
 
 void LoadSave::loadSample(SynthBase* synth, const json& json_sample) {
   vital::Sample* sample = synth->getSample();
-  if (sample)
-    sample->jsonToState(json_sample);
+  if (sample && !sample->jsonToState(json_sample))
+    writeErrorLog("Couldn't open sample file: " + String(json_sample["file"].get<std::string>()));
 }
 
 void LoadSave::loadWavetables(SynthBase* synth, const json& wavetables) {
@@ -1025,31 +1026,88 @@ json LoadSave::updateFromOldVersion(json state) {
 }
 
 bool LoadSave::jsonToState(SynthBase* synth, std::map<std::string, String>& save_info, json data) {
+  std::unique_ptr<PreparedState> state = prepareState(synth, std::move(data));
+  if (state == nullptr)
+    return false;
+
+  swapInState(synth, save_info, state.get());
+  return true;
+}
+
+std::unique_ptr<LoadSave::PreparedState> LoadSave::prepareState(SynthBase* synth, json data) {
   std::string version = data["synth_version"];
   
   int compare_feature_versions = compareFeatureVersionStrings(version, ProjectInfo::versionString);
   if (compare_feature_versions > 0)
-    return false;
+    return nullptr;
   
   int compare_versions = compareVersionStrings(version, ProjectInfo::versionString);
   if (compare_versions < 0 || data["settings"].count("sub_octave"))
     data = updateFromOldVersion(data);
-  
-  json settings = data["settings"];
-  json modulations = settings["modulations"];
-  json sample = settings["sample"];
-  json wavetables = settings["wavetables"];
-  json lfos = settings["lfos"];
-
-  loadControls(synth, settings);
-  loadModulations(synth, modulations);
-  loadSample(synth, sample);
-  loadWavetables(synth, wavetables);
-  loadLfos(synth, lfos);
-  loadSaveState(save_info, data);
+
+  std::unique_ptr<PreparedState> state = std::make_unique<PreparedState>();
+  json& settings = data["settings"];
+
+  for (auto& control : synth->getControls()) {
+    std::string name = control.first;
+    vital::mono_float value = vital::Parameters::getDetails(name).default_value;
+    if (settings.count(name))
+      value = settings[name];
+    state->controls.emplace_back(control.second, value);
+  }
+
+  if (synth->getSample()) {
+    state->sample = std::make_unique<vital::Sample>();
+    if (!state->sample->jsonToState(settings["sample"]))
+      writeErrorLog("Couldn't open sample file: " + String(settings["sample"]["file"].get<std::string>()));
+  }
+
+  if (synth->getWavetableCreator(0)) {
+    for (const json& wavetable_data : settings["wavetables"]) {
+      if (state->wavetables.size() >= vital::kNumOscillators)
+        break;
+
+      std::unique_ptr<vital::Wavetable> wavetable = std::make_unique<vital::Wavetable>(vital::kNumOscillatorWaveFrames);
+      std::unique_ptr<WavetableCreator> wavetable_creator = std::make_unique<WavetableCreator>(wavetable.get());
+      wavetable_creator->jsonToState(wavetable_data);
+      wavetable_creator->render();
+      state->wavetables.push_back(std::move(wavetable));
+      state->wavetable_creators.push_back(std::move(wavetable_creator));
+    }
+  }
+
+  state->data = std::move(data);
+  return state;
+}
+
+void LoadSave::swapInState(SynthBase* synth, std::map<std::string, String>& save_info, PreparedState* state) {
+  json& settings = state->data["settings"];
+
+  for (auto& control : state->controls)
+    control.first->set(control.second);
+  synth->modWheelGuiChanged(synth->getControls()["mod_wheel"]->value());
+
+  loadModulations(synth, settings["modulations"]);
+
+  if (state->sample)
+    synth->getSample()->swapState(state->sample.get());
+
+  for (int i = 0; i < state->wavetable_creators.size(); ++i)
+    synth->getWavetableCreator(i)->swapState(state->wavetable_creators[i].get());
+
+  loadLfos(synth, settings["lfos"]);
+  loadSaveState(save_info, state->data);
   synth->checkOversampling();
-  
-  return true;
+}
+
+json LoadSave::parseStateFile(const File& file) {
+  MemoryBlock data;
+  file.loadFileAsData(data);
+  if (BinaryState::isBinaryState(data.getData(), data.getSize()))
+    return BinaryState::binaryToJson(data.getData(), data.getSize());
+
+  MemoryInputStream stream(data, false);
+  return json::parse(stream.readEntireStreamAsString().toStdString(), nullptr);
 }
 
 String LoadSave::getAuthorFromFile(const File& file) {
@@ -1070,7 +1128,7 @@ String LoadSave::getAuthorFromFile(const File& file) {
   char begin_quote = file_stream.readByte();
   if (author_memory_block.toString() != "author" || end_quote != '"' || colon != ':' || begin_quote != '"') {
     try {
-      json parsed_json_state = json::parse(file.loadFileAsString().toStdString(), nullptr, false);
+      json parsed_json_state = parseStateFile(file);
       return getAuthor(parsed_json_state);
     }
     catch (const json::exception& e) {
@@ -1101,6 +1159,17 @@ String LoadSave::getStyleFromFile(const File& file) {
   MemoryBlock style_memory_block;
   file_stream.readIntoMemoryBlock(style_memory_block, kMinSize);
 
+  if (BinaryState::isBinaryState(style_memory_block.getData(), style_memory_block.getSize())) {
+    try {
+      json parsed_json_state = parseStateFile(file);
+      if (parsed_json_state.count("preset_style"))
+        return String(parsed_json_state["preset_style"].get<std::string>());
+    }
+    catch (const json::exception& e) {
+    }
+    return "";
+  }
+
   StringArray tokens;
   tokens.addTokens(style_memory_block.toString(), "\"", "");
   bool found_style = false;
@@ -1181,6 +1250,25 @@ File LoadSave::getFavoritesFile() {
 #endif
 }
 
+File LoadSave::getPresetIndexFile() {
+#if defined(JUCE_DATA_STRUCTURES_H_INCLUDED)
+  PropertiesFile::Options config_options;
+  config_options.applicationName = "Vitalium";
+  config_options.osxLibrarySubFolder = "Application Support";
+  config_options.filenameSuffix = "preset_index";
+
+#ifdef LINUX
+  config_options.folderName = "." + String(ProjectInfo::projectName).toLowerCase();
+#else
+  config_options.folderName = String(ProjectInfo::projectName).toLowerCase();
+#endif
+
+  return config_options.getDefaultFile();
+#else
+  return File();
+#endif
+}
+
 File LoadSave::getDefaultSkin() {
 #if defined(JUCE_DATA_STRUCTURES_H_INCLUDED)
   PropertiesFile::Options config_options;
@@ -1576,6 +1664,24 @@ bool LoadSave::displayHzFrequency() {
   return data["hz_frequency"];
 }
 
+bool LoadSave::shouldSaveBinaryState() {
+  json data = getConfigJson();
+
+  if (!data.count("binary_state"))
+    return false;
+
+  return data["binary_state"];
+}
+
+bool LoadSave::shouldSaveBinaryPresets() {
+  json data = getConfigJson();
+
+  if (!data.count("binary_presets"))
+    return false;
+
+  return data["binary_presets"];
+}
+
 int LoadSave::getOversamplingAmount() {
   json data = getConfigJson();
 
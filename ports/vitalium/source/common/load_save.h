@@ -26,11 +26,15 @@
 using json = nlohmann::json;
 
 namespace vital {
+  class Sample;
   class StringLayout;
+  class Value;
+  class Wavetable;
 }
 
 class MidiManager;
 class SynthBase;
+class WavetableCreator;
 
 class LoadSave {
   public:
@@ -59,6 +63,19 @@ class LoadSave {
       kNumPresetStyles
     };
 
+    // A preset decoded, with its sample and wavetables rendered, off the audio thread.
+    // swapInState hands it to the synth and leaves the old sample and wavetables behind in it.
+    struct PreparedState {
+      PreparedState();
+      ~PreparedState();
+
+      json data;
+      std::vector<std::pair<vital::Value*, float>> controls;
+      std::unique_ptr<vital::Sample> sample;
+      std::vector<std::unique_ptr<vital::Wavetable>> wavetables;
+      std::vector<std::unique_ptr<WavetableCreator>> wavetable_creators;
+    };
+
     static const int kMaxCommentLength = 500;
     static const std::string kUserDirectoryName;
     static const std::string kPresetFolderName;
@@ -83,6 +100,9 @@ class LoadSave {
     static void initSaveInfo(std::map<std::string, String>& save_info);
     static json updateFromOldVersion(json state);
     static bool jsonToState(SynthBase* synth, std::map<std::string, String>& save_info, json state);
+    static std::unique_ptr<PreparedState> prepareState(SynthBase* synth, json state);
+    static void swapInState(SynthBase* synth, std::map<std::string, String>& save_info, PreparedState* state);
+    static json parseStateFile(const File& file);
 
     static String getAuthorFromFile(const File& file);
     static String getStyleFromFile(const File& file);
@@ -94,6 +114,7 @@ class LoadSave {
     static void writeErrorLog(String error_log);
     static json getConfigJson();
     static File getFavoritesFile();
+    static File getPresetIndexFile();
     static File getDefaultSkin();
     static json getFavoritesJson();
     static void addFavorite(const File& new_favorite);
@@ -116,6 +137,8 @@ class LoadSave {
     static std::string getLoadedSkin();
     static bool shouldAnimateWidgets();
     static bool displayHzFrequency();
+    static bool shouldSaveBinaryState();
+    static bool shouldSaveBinaryPresets();
     static bool authenticated();
     static int getOversamplingAmount();
     static float loadWindowSize();
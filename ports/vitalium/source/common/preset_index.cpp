@@ -0,0 +1,494 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "preset_index.h"
+
+#include "load_save.h"
+#include "synth_constants.h"
+
+#include <algorithm>
+
+namespace {
+  constexpr char kIndexMagic[] = { 'V', 'P', 'I', 'X' };
+  constexpr int kIndexMagicSize = 4;
+
+  inline uint32_t trigramAt(const std::string& text, size_t index) {
+    return (static_cast<uint8_t>(text[index]) << 16) | (static_cast<uint8_t>(text[index + 1]) << 8) |
+           static_cast<uint8_t>(text[index + 2]);
+  }
+
+  bool isInside(const std::string& path, const std::string& directory) {
+    return path.size() > directory.size() && path.compare(0, directory.size(), directory) == 0 &&
+           path[directory.size()] == File::getSeparatorChar();
+  }
+
+  std::string searchText(const std::string& name, const std::string& author) {
+    return (String(name).toLowerCase() + "\n" + String(author).toLowerCase()).toStdString();
+  }
+} // namespace
+
+std::shared_ptr<PresetIndex> PresetIndex::getShared() {
+  static std::weak_ptr<PresetIndex> shared;
+
+  std::shared_ptr<PresetIndex> index = shared.lock();
+  if (index == nullptr) {
+    index = std::shared_ptr<PresetIndex>(new PresetIndex());
+    shared = index;
+  }
+  return index;
+}
+
+PresetIndex::PresetIndex() : Thread("Preset Index"), trigrams_dirty_(true), unsaved_(false),
+                             loaded_(false), scan_requested_(false) { }
+
+PresetIndex::~PresetIndex() {
+  signalThreadShouldExit();
+  notify();
+  stopThread(kStopTimeout);
+  cancelPendingUpdate();
+}
+
+void PresetIndex::removeListener(Listener* listener) {
+  listeners_.erase(std::remove(listeners_.begin(), listeners_.end(), listener), listeners_.end());
+}
+
+void PresetIndex::rescan() {
+  {
+    ScopedLock lock(request_lock_);
+    scan_requested_ = true;
+  }
+
+  wakeScanner();
+}
+
+void PresetIndex::getPresets(Array<File>& presets, const std::vector<File>& directories) {
+  std::vector<std::string> roots;
+  for (const File& root : LoadSave::getPresetDirectories())
+    roots.push_back(root.getFullPathName().toStdString());
+
+  for (const File& directory : directories) {
+    if (!directory.isDirectory())
+      continue;
+
+    std::string directory_path = directory.getFullPathName().toStdString();
+    bool indexed = false;
+    for (const std::string& root : roots)
+      indexed = indexed || directory_path == root || isInside(directory_path, root);
+
+    if (!indexed) {
+      directory.findChildFiles(presets, File::findFiles, true, String("*.") + vital::kPresetExtension);
+      continue;
+    }
+
+    ScopedLock lock(lock_);
+    for (const Entry& entry : entries_) {
+      if (!entry.removed && isInside(entry.path, directory_path))
+        presets.add(File(entry.path));
+    }
+  }
+}
+
+int PresetIndex::getId(const File& preset) {
+  std::string path = preset.getFullPathName().toStdString();
+  int id = 0;
+  {
+    ScopedLock lock(lock_);
+    auto found = ids_.find(path);
+    if (found != ids_.end() && !entries_[found->second].removed)
+      return found->second;
+
+    id = addEntry(path, 0, 0, 0);
+    entries_[id].on_demand = true;
+  }
+
+  {
+    ScopedLock lock(request_lock_);
+    pending_reads_.push_back(id);
+  }
+
+  wakeScanner();
+  return id;
+}
+
+std::string PresetIndex::getAuthor(const File& preset) {
+  int id = getId(preset);
+  ScopedLock lock(lock_);
+  return entries_[id].author;
+}
+
+std::string PresetIndex::getStyle(const File& preset) {
+  int id = getId(preset);
+  ScopedLock lock(lock_);
+  return entries_[id].style;
+}
+
+int64 PresetIndex::getCreated(const File& preset) {
+  int id = getId(preset);
+  ScopedLock lock(lock_);
+  return entries_[id].created;
+}
+
+std::vector<bool> PresetIndex::search(const StringArray& tokens, const std::set<std::string>& styles) {
+  std::vector<std::string> search_tokens;
+  for (const String& token : tokens) {
+    if (token.isNotEmpty())
+      search_tokens.push_back(token.toStdString());
+  }
+
+  ScopedLock lock(lock_);
+  if (trigrams_dirty_)
+    buildTrigrams();
+
+  std::vector<bool> matches(entries_.size(), false);
+
+  // Narrow down to the entries holding the rarest trigram of each token, then check them in full.
+  bool use_candidates = false;
+  std::vector<int> candidates;
+  for (const std::string& token : search_tokens) {
+    const std::vector<int>* rarest = nullptr;
+    for (size_t i = 0; i + 2 < token.size(); ++i) {
+      auto found = trigrams_.find(trigramAt(token, i));
+      if (found == trigrams_.end())
+        return matches;
+
+      if (rarest == nullptr || found->second.size() < rarest->size())
+        rarest = &found->second;
+    }
+
+    if (rarest == nullptr)
+      continue;
+
+    if (use_candidates) {
+      std::vector<int> both;
+      std::set_intersection(candidates.begin(), candidates.end(), rarest->begin(), rarest->end(),
+                            std::back_inserter(both));
+      candidates.swap(both);
+    }
+    else
+      candidates = *rarest;
+    use_candidates = true;
+  }
+
+  auto check = [&](int id) {
+    const Entry& entry = entries_[id];
+    if (entry.removed || (!styles.empty() && styles.count(entry.style) == 0))
+      return;
+
+    for (const std::string& token : search_tokens) {
+      if (entry.text.find(token) == std::string::npos)
+        return;
+    }
+    matches[id] = true;
+  };
+
+  if (use_candidates) {
+    for (int id : candidates)
+      check(id);
+  }
+  else {
+    for (int id = 0; id < entries_.size(); ++id)
+      check(id);
+  }
+
+  return matches;
+}
+
+void PresetIndex::run() {
+  while (!threadShouldExit()) {
+    bool requested = false;
+    std::vector<int> reads;
+    {
+      ScopedLock lock(request_lock_);
+      requested = scan_requested_;
+      scan_requested_ = false;
+      reads.swap(pending_reads_);
+    }
+
+    if (requested)
+      scan();
+    if (!reads.empty())
+      readEntries(reads);
+    if (!requested && reads.empty())
+      wait(-1);
+  }
+}
+
+void PresetIndex::load() {
+  MemoryBlock data;
+  File file = LoadSave::getPresetIndexFile();
+  if (!file.existsAsFile() || !file.loadFileAsData(data))
+    return;
+
+  MemoryInputStream stream(data, false);
+  char magic[kIndexMagicSize];
+  if (stream.read(magic, kIndexMagicSize) != kIndexMagicSize || memcmp(magic, kIndexMagic, kIndexMagicSize) ||
+      stream.readInt() != kVersion) {
+    return;
+  }
+
+  int num_entries = stream.readInt();
+  ScopedLock lock(lock_);
+  for (int i = 0; i < num_entries && !stream.isExhausted(); ++i) {
+    std::string path = stream.readString().toStdString();
+    String name = stream.readString();
+    String author = stream.readString();
+    String style = stream.readString();
+    int64 size = stream.readInt64();
+    int64 modified = stream.readInt64();
+    int64 created = stream.readInt64();
+
+    if (ids_.count(path) == 0)
+      setDetails(addEntry(path, size, modified, created), name, author, style);
+  }
+  unsaved_ = false;
+}
+
+void PresetIndex::save() {
+  MemoryOutputStream entries;
+  int num_entries = 0;
+  {
+    ScopedLock lock(lock_);
+    for (const Entry& entry : entries_) {
+      if (entry.removed || !entry.read || entry.on_demand)
+        continue;
+
+      entries.writeString(entry.path);
+      entries.writeString(entry.name);
+      entries.writeString(entry.author);
+      entries.writeString(entry.style);
+      entries.writeInt64(entry.size);
+      entries.writeInt64(entry.modified);
+      entries.writeInt64(entry.created);
+      num_entries++;
+    }
+  }
+
+  MemoryOutputStream stream;
+  stream.write(kIndexMagic, kIndexMagicSize);
+  stream.writeInt(kVersion);
+  stream.writeInt(num_entries);
+  stream << entries.getMemoryBlock();
+
+  File file = LoadSave::getPresetIndexFile();
+  file.getParentDirectory().createDirectory();
+  file.replaceWithData(stream.getData(), stream.getDataSize());
+}
+
+void PresetIndex::scan() {
+  if (!loaded_) {
+    load();
+    loaded_ = true;
+    notifyChanged();
+  }
+
+  std::vector<File> directories = LoadSave::getPresetDirectories();
+  std::vector<std::string> roots;
+  std::vector<int> changed;
+  std::vector<bool> seen;
+
+  for (const File& directory : directories) {
+    if (!directory.isDirectory())
+      continue;
+
+    roots.push_back(directory.getFullPathName().toStdString());
+    for (const DirectoryEntry& file : RangedDirectoryIterator(directory, true, String("*.") + vital::kPresetExtension,
+                                                              File::findFiles)) {
+      if (threadShouldExit())
+        return;
+
+      std::string path = file.getFile().getFullPathName().toStdString();
+      int64 size = file.getFileSize();
+      int64 modified = file.getModificationTime().toMilliseconds();
+      int64 created = file.getCreationTime().toMilliseconds();
+
+      ScopedLock lock(lock_);
+      auto found = ids_.find(path);
+      int id = 0;
+      if (found != ids_.end() && entries_[found->second].read && !entries_[found->second].removed &&
+          entries_[found->second].size == size && entries_[found->second].modified == modified) {
+        id = found->second;
+        entries_[id].created = created;
+        entries_[id].on_demand = false;
+      }
+      else {
+        id = addEntry(path, size, modified, created);
+        changed.push_back(id);
+      }
+
+      if (seen.size() <= id)
+        seen.resize(id + 1, false);
+      seen[id] = true;
+    }
+  }
+
+  // Entries outside the preset folders only stay while a browser shows some other folder. The rest,
+  // e.g. from a preset folder that has since moved, are dropped with the files that have gone.
+  bool removed = false;
+  {
+    ScopedLock lock(lock_);
+    for (int id = 0; id < entries_.size(); ++id) {
+      Entry& entry = entries_[id];
+      if (entry.removed || (id < seen.size() && seen[id]))
+        continue;
+
+      bool inside = false;
+      for (const std::string& root : roots)
+        inside = inside || isInside(entry.path, root);
+
+      if (inside || !entry.on_demand) {
+        entry.removed = true;
+        removed = true;
+      }
+    }
+
+    if (removed) {
+      trigrams_dirty_ = true;
+      unsaved_ = true;
+    }
+  }
+
+  if (removed || !changed.empty())
+    notifyChanged();
+
+  for (int i = 0; i < changed.size(); ++i) {
+    if (threadShouldExit())
+      return;
+
+    File preset;
+    {
+      ScopedLock lock(lock_);
+      preset = File(entries_[changed[i]].path);
+    }
+
+    String author = LoadSave::getAuthorFromFile(preset);
+    String style = LoadSave::getStyleFromFile(preset);
+    setDetails(changed[i], preset.getFileNameWithoutExtension(), author, style);
+
+    if ((i + 1) % kNotifyInterval == 0)
+      notifyChanged();
+  }
+
+  if (!changed.empty())
+    notifyChanged();
+
+  bool unsaved = false;
+  {
+    ScopedLock lock(lock_);
+    unsaved = unsaved_;
+    unsaved_ = false;
+  }
+  if (unsaved)
+    save();
+}
+
+void PresetIndex::readEntries(const std::vector<int>& ids) {
+  for (int id : ids) {
+    if (threadShouldExit())
+      return;
+
+    File preset;
+    {
+      ScopedLock lock(lock_);
+      if (entries_[id].read || entries_[id].removed)
+        continue;
+      preset = File(entries_[id].path);
+    }
+
+    String author = LoadSave::getAuthorFromFile(preset);
+    String style = LoadSave::getStyleFromFile(preset);
+    {
+      ScopedLock lock(lock_);
+      entries_[id].size = preset.getSize();
+      entries_[id].modified = preset.getLastModificationTime().toMilliseconds();
+      entries_[id].created = preset.getCreationTime().toMilliseconds();
+    }
+    setDetails(id, preset.getFileNameWithoutExtension(), author, style);
+  }
+
+  notifyChanged();
+}
+
+void PresetIndex::wakeScanner() {
+  if (!isThreadRunning())
+    startThread();
+  notify();
+}
+
+void PresetIndex::notifyChanged() {
+  triggerAsyncUpdate();
+}
+
+void PresetIndex::handleAsyncUpdate() {
+  std::vector<Listener*> listeners = listeners_;
+  for (Listener* listener : listeners)
+    listener->presetIndexChanged();
+}
+
+int PresetIndex::addEntry(const std::string& path, int64 size, int64 modified, int64 created) {
+  ScopedLock lock(lock_);
+  int id = 0;
+  auto found = ids_.find(path);
+  if (found == ids_.end()) {
+    id = static_cast<int>(entries_.size());
+    entries_.emplace_back();
+    entries_[id].path = path;
+    ids_[path] = id;
+  }
+  else
+    id = found->second;
+
+  // Searchable by name straight away, the author and style follow when the file is read.
+  Entry& entry = entries_[id];
+  entry.name = File(path).getFileNameWithoutExtension().toStdString();
+  entry.text = searchText(entry.name, entry.author);
+  entry.size = size;
+  entry.modified = modified;
+  entry.created = created;
+  entry.read = false;
+  entry.removed = false;
+  entry.on_demand = false;
+  trigrams_dirty_ = true;
+  unsaved_ = true;
+  return id;
+}
+
+void PresetIndex::setDetails(int id, const String& name, const String& author, const String& style) {
+  ScopedLock lock(lock_);
+  Entry& entry = entries_[id];
+  entry.name = name.toStdString();
+  entry.author = author.toStdString();
+  entry.style = style.toLowerCase().toStdString();
+  entry.text = searchText(entry.name, entry.author);
+  entry.read = true;
+  trigrams_dirty_ = true;
+  unsaved_ = true;
+}
+
+void PresetIndex::buildTrigrams() {
+  trigrams_.clear();
+  for (int id = 0; id < entries_.size(); ++id) {
+    const Entry& entry = entries_[id];
+    if (entry.removed)
+      continue;
+
+    for (size_t i = 0; i + 2 < entry.text.size(); ++i) {
+      std::vector<int>& ids = trigrams_[trigramAt(entry.text, i)];
+      if (ids.empty() || ids.back() != id)
+        ids.push_back(id);
+    }
+  }
+  trigrams_dirty_ = false;
+}
@@ -0,0 +1,109 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Name, author and style of every preset in the preset folders, saved between sessions so the
+// browser doesn't open each file. A scanner thread checks the index against the folders by size and
+// modification time and only reads presets that are new or changed. Text searches go through a
+// trigram index over the lowercase name and author, so they keep the substring matching of the
+// browser without visiting every entry. The browsers share one index, which goes away with the last
+// of them.
+class PresetIndex : public Thread, private AsyncUpdater {
+  public:
+    static constexpr int kVersion = 2;
+    static constexpr int kStopTimeout = 4000;
+    static constexpr int kNotifyInterval = 500;
+
+    class Listener {
+      public:
+        virtual ~Listener() { }
+        virtual void presetIndexChanged() = 0;
+    };
+
+    static std::shared_ptr<PresetIndex> getShared();
+
+    virtual ~PresetIndex();
+
+    void addListener(Listener* listener) { listeners_.push_back(listener); }
+    void removeListener(Listener* listener);
+    void rescan();
+
+    void getPresets(Array<File>& presets, const std::vector<File>& directories);
+    // Presets the index doesn't know yet are listed by name and read on the scanner thread.
+    int getId(const File& preset);
+    std::string getAuthor(const File& preset);
+    std::string getStyle(const File& preset);
+    int64 getCreated(const File& preset);
+
+    // Which ids have a name or author containing every token and, unless styles is empty, one of those
+    // styles. Tokens and styles are lowercase.
+    std::vector<bool> search(const StringArray& tokens, const std::set<std::string>& styles);
+
+    void run() override;
+
+  private:
+    struct Entry {
+      std::string path;
+      std::string name;
+      std::string author;
+      std::string style;
+      std::string text;
+      int64 size = 0;
+      int64 modified = 0;
+      int64 created = 0;
+      bool read = false;
+      bool removed = false;
+      bool on_demand = false;
+    };
+
+    PresetIndex();
+
+    void load();
+    void save();
+    void scan();
+    void readEntries(const std::vector<int>& ids);
+    void wakeScanner();
+    void notifyChanged();
+    void handleAsyncUpdate() override;
+    int addEntry(const std::string& path, int64 size, int64 modified, int64 created);
+    void setDetails(int id, const String& name, const String& author, const String& style);
+    void buildTrigrams();
+
+    CriticalSection lock_;
+    std::vector<Entry> entries_;
+    std::unordered_map<std::string, int> ids_;
+    std::unordered_map<uint32_t, std::vector<int>> trigrams_;
+    bool trigrams_dirty_;
+    bool unsaved_;
+    bool loaded_;
+
+    CriticalSection request_lock_;
+    bool scan_requested_;
+    std::vector<int> pending_reads_;
+
+    std::vector<Listener*> listeners_;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetIndex)
+};
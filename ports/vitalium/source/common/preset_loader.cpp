@@ -0,0 +1,116 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "preset_loader.h"
+
+#include "synth_base.h"
+
+std::unique_ptr<LoadSave::PreparedState> PresetLoader::prepare(SynthBase* synth, const File& preset,
+                                                               std::string& error) {
+  try {
+    std::unique_ptr<LoadSave::PreparedState> state = LoadSave::prepareState(synth, LoadSave::parseStateFile(preset));
+    if (state == nullptr)
+      error = "Preset was created with a newer version.";
+    return state;
+  }
+  catch (const json::exception& e) {
+    error = "Preset file is corrupted.";
+    return nullptr;
+  }
+}
+
+PresetLoader::PresetLoader(SynthBase* synth, std::weak_ptr<SynthBase*> synth_reference) :
+    Thread("Preset Loader"), synth_(synth), synth_reference_(std::move(synth_reference)),
+    has_pending_(false), latest_request_(0) { }
+
+PresetLoader::~PresetLoader() {
+  signalThreadShouldExit();
+  notify();
+  stopThread(kStopTimeout);
+}
+
+void PresetLoader::load(const File& preset, Callback callback) {
+  {
+    ScopedLock lock(request_lock_);
+    pending_preset_ = preset;
+    pending_callback_ = std::move(callback);
+    has_pending_ = true;
+    latest_request_++;
+  }
+
+  if (!isThreadRunning())
+    startThread();
+  notify();
+}
+
+void PresetLoader::run() {
+  while (!threadShouldExit()) {
+    File preset;
+    Callback callback;
+    int request = 0;
+    {
+      ScopedLock lock(request_lock_);
+      if (has_pending_) {
+        preset = pending_preset_;
+        callback = std::move(pending_callback_);
+        request = latest_request_;
+        has_pending_ = false;
+      }
+    }
+
+    if (request == 0) {
+      wait(-1);
+      continue;
+    }
+
+    std::string error;
+    std::unique_ptr<LoadSave::PreparedState> state = prepare(synth_, preset, error);
+    if (!isLatest(request) || threadShouldExit())
+      continue;
+
+    PreparedCallback* prepared = new PreparedCallback();
+    prepared->synth_reference = synth_reference_;
+    prepared->request = request;
+    prepared->preset = preset;
+    prepared->state = std::move(state);
+    prepared->error = error;
+    prepared->callback = std::move(callback);
+    prepared->post();
+  }
+}
+
+void PresetLoader::PreparedCallback::messageCallback() {
+  std::shared_ptr<SynthBase*> synth_reference_lock = synth_reference.lock();
+  if (synth_reference_lock == nullptr)
+    return;
+
+  SynthBase* synth = *synth_reference_lock;
+  if (!synth->getPresetLoader()->isLatest(request))
+    return;
+
+  if (state) {
+    try {
+      synth->loadPreparedPreset(preset, state.get());
+    }
+    catch (const json::exception& e) {
+      error = "Preset file is corrupted.";
+      state = nullptr;
+    }
+  }
+
+  if (callback)
+    callback(state != nullptr, error);
+}
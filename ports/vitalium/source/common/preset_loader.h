@@ -0,0 +1,69 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "JuceHeader.h"
+#include "load_save.h"
+
+#include <atomic>
+#include <functional>
+
+class SynthBase;
+
+// Reads and renders presets on its own thread so browsing never stalls the message or audio thread.
+// Only the newest request is kept. Its result is posted to the message thread, where the synth
+// swaps it in.
+class PresetLoader : public Thread {
+  public:
+    static constexpr int kStopTimeout = 4000;
+
+    typedef std::function<void(bool, const std::string&)> Callback;
+
+    static std::unique_ptr<LoadSave::PreparedState> prepare(SynthBase* synth, const File& preset,
+                                                            std::string& error);
+
+    PresetLoader(SynthBase* synth, std::weak_ptr<SynthBase*> synth_reference);
+    ~PresetLoader();
+
+    void load(const File& preset, Callback callback);
+    bool isLatest(int request) const { return request == latest_request_; }
+
+    void run() override;
+
+  private:
+    struct PreparedCallback : public CallbackMessage {
+      void messageCallback() override;
+
+      std::weak_ptr<SynthBase*> synth_reference;
+      int request;
+      File preset;
+      std::unique_ptr<LoadSave::PreparedState> state;
+      std::string error;
+      Callback callback;
+    };
+
+    SynthBase* synth_;
+    std::weak_ptr<SynthBase*> synth_reference_;
+
+    CriticalSection request_lock_;
+    File pending_preset_;
+    Callback pending_callback_;
+    bool has_pending_;
+    std::atomic<int> latest_request_;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PresetLoader)
+};
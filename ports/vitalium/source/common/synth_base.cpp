@@ -19,17 +19,21 @@
 #include "sample_source.h"
 #include "sound_engine.h"
 #include "load_save.h"
+#include "binary_state.h"
 #include "memory.h"
 #include "modulation_connection_processor.h"
+#include "preset_loader.h"
 #include "startup.h"
 #include "synth_gui_interface.h"
 #include "synth_parameters.h"
 #include "utils.h"
 
-SynthBase::SynthBase() : expired_(false) {
+SynthBase::SynthBase() : expired_(false), load_gain_(1.0f), load_fade_out_(false),
+                         load_faded_(false), last_block_time_(0), audio_thread_(nullptr) {
   expired_ = LoadSave::isExpired();
   self_reference_ = std::make_shared<SynthBase*>();
   *self_reference_ = this;
+  preset_loader_ = std::make_unique<PresetLoader>(this, self_reference_);
 
   engine_ = std::make_unique<vital::SoundEngine>();
   engine_->setTuning(&tuning_);
@@ -61,7 +65,10 @@ SynthBase::SynthBase() : expired_(false) {
   Startup::doStartupChecks(midi_manager_.get());
 }
 
-SynthBase::~SynthBase() { }
+SynthBase::~SynthBase() {
+  // The loader's thread reads the controls and engine, so it's stopped before any of them go.
+  preset_loader_ = nullptr;
+}
 
 void SynthBase::valueChanged(const std::string& name, vital::mono_float value) {
   controls_[name]->set(value);
@@ -338,37 +345,74 @@ void SynthBase::loadInitPreset() {
 }
 
 bool SynthBase::loadFromJson(const json& data) {
-  pauseProcessing(true);
-  engine_->allSoundsOff();
+  std::unique_ptr<LoadSave::PreparedState> state = LoadSave::prepareState(this, data);
+  if (state == nullptr)
+    return false;
+
+  swapInState(state.get());
+  return true;
+}
+
+void SynthBase::swapInState(LoadSave::PreparedState* state) {
+  fadeOutForLoad();
   try {
-    bool result = LoadSave::jsonToState(this, save_info_, data);
-    pauseProcessing(false);
-    return result;
+    ScopedLock lock(getCriticalSection());
+    engine_->allSoundsOff();
+    LoadSave::swapInState(this, save_info_, state);
   }
   catch (const json::exception& e) {
-    pauseProcessing(false);
+    load_fade_out_ = false;
     throw e;
   }
+  load_fade_out_ = false;
+}
+
+bool SynthBase::isProcessing() const {
+  return Time::getMillisecondCounter() - last_block_time_.load() < kAudioIdleMs;
+}
+
+void SynthBase::fadeOutForLoad() {
+  // Nothing to fade when no audio is coming through, e.g. the host is stopped, and the audio thread
+  // can't wait on its own blocks.
+  if (Thread::getCurrentThreadId() == audio_thread_.load() || !isProcessing())
+    return;
+
+  load_faded_ = false;
+  load_fade_out_ = true;
+
+  double start = Time::getMillisecondCounterHiRes();
+  while (!load_faded_ && isProcessing()) {
+    if (Time::getMillisecondCounterHiRes() - start > kLoadFadeTimeoutMs)
+      return;
+    Thread::sleep(1);
+  }
 }
 
 bool SynthBase::loadFromFile(File preset, std::string& error) {
   if (!preset.exists())
     return false;
-  
-  try {
-    json parsed_json_state = json::parse(preset.loadFileAsString().toStdString(), nullptr);
-    if (!loadFromJson(parsed_json_state)) {
-      error = "Preset was created with a newer version.";
-      return false;
-    }
 
-    active_file_ = preset;
+  std::unique_ptr<LoadSave::PreparedState> state = PresetLoader::prepare(this, preset, error);
+  if (state == nullptr)
+    return false;
+
+  try {
+    loadPreparedPreset(preset, state.get());
   }
   catch (const json::exception& e) {
     error = "Preset file is corrupted.";
     return false;
   }
-  
+  return true;
+}
+
+void SynthBase::loadFromFileInBackground(File preset, std::function<void(bool, const std::string&)> callback) {
+  preset_loader_->load(preset, std::move(callback));
+}
+
+void SynthBase::loadPreparedPreset(File preset, LoadSave::PreparedState* state) {
+  swapInState(state);
+  active_file_ = preset;
   setPresetName(preset.getFileNameWithoutExtension());
 
   SynthGuiInterface* gui_interface = getGuiInterface();
@@ -376,8 +420,6 @@ bool SynthBase::loadFromFile(File preset, std::string& error) {
     gui_interface->updateFullGui();
     gui_interface->notifyFresh();
   }
-
-  return true;
 }
 
 void SynthBase::renderAudioToFile(File file, float seconds, float bpm, std::vector<int> notes, bool render_images) {
@@ -559,7 +601,22 @@ bool SynthBase::saveToFile(File preset) {
   if (gui_interface)
     gui_interface->notifyFresh();
 
-  if (preset.replaceWithText(saveToJson().dump())) {
+  bool saved = false;
+  if (LoadSave::shouldSaveBinaryPresets()) {
+    json state;
+    {
+      BinaryState::RawBlobs raw_blobs;
+      state = saveToJson();
+    }
+
+    MemoryBlock data;
+    BinaryState::jsonToBinary(std::move(state), data, true);
+    saved = preset.replaceWithData(data.getData(), data.getSize());
+  }
+  else
+    saved = preset.replaceWithText(saveToJson().dump());
+
+  if (saved) {
     active_file_ = preset;
     return true;
   }
@@ -605,7 +662,33 @@ void SynthBase::writeAudio(AudioSampleBuffer* buffer, int channels, int samples,
     }
   }
 
+  if (load_fade_out_ || load_gain_ < 1.0f)
+    applyLoadFade(buffer, channels, samples, offset);
+
   updateMemoryOutput(samples, engine_->output(0)->buffer);
+  last_block_time_ = Time::getMillisecondCounter();
+  audio_thread_ = Thread::getCurrentThreadId();
+}
+
+void SynthBase::applyLoadFade(AudioSampleBuffer* buffer, int channels, int samples, int offset) {
+  bool fade_out = load_fade_out_;
+  vital::mono_float delta = 1.0f / (kLoadFadeSeconds * getSampleRate());
+  if (fade_out)
+    delta = -delta;
+
+  vital::mono_float gain = load_gain_;
+  for (int channel = 0; channel < channels; ++channel) {
+    float* channel_data = buffer->getWritePointer(channel, offset);
+    gain = load_gain_;
+    for (int i = 0; i < samples; ++i) {
+      gain = vital::utils::clamp(gain + delta, 0.0f, 1.0f);
+      channel_data[i] *= gain;
+    }
+  }
+
+  load_gain_ = gain;
+  if (fade_out && gain == 0.0f)
+    load_faded_ = true;
 }
 
 void SynthBase::processMidi(MidiBuffer& midi_messages, int start_sample, int end_sample) {
@@ -758,6 +841,99 @@ void SynthBase::checkOversampling() {
   return engine_->checkOversampling();
 }
 
+void SynthBase::setProfiling(bool profiling) {
+  if (profiling && !isProfiling()) {
+    ScopedLock lock(getCriticalSection());
+    std::vector<vital::Processor*> processors;
+    engine_->getProfiledProcessors(processors);
+    for (vital::Processor* processor : processors)
+      processor->resetProfile();
+  }
+
+  vital::profiler::setEnabled(profiling);
+}
+
+std::vector<vital::ProfileEntry> SynthBase::getProfile() {
+  std::vector<vital::ProfileEntry> profile;
+  std::map<std::string, int> indices;
+
+  ScopedLock lock(getCriticalSection());
+  std::vector<vital::Processor*> processors;
+  engine_->getProfiledProcessors(processors);
+  for (vital::Processor* processor : processors) {
+    vital::ProfileEntry entry = processor->getProfile();
+    if (indices.count(entry.name) == 0) {
+      indices[entry.name] = static_cast<int>(profile.size());
+      profile.push_back(entry);
+      continue;
+    }
+
+    vital::ProfileEntry& total = profile[indices[entry.name]];
+    total.cycles += entry.cycles;
+    total.calls += entry.calls;
+    total.polyphonic = total.polyphonic || entry.polyphonic;
+  }
+
+  std::sort(profile.begin(), profile.end(), [](const vital::ProfileEntry& a, const vital::ProfileEntry& b) {
+    return a.cycles > b.cycles;
+  });
+  return profile;
+}
+
+String SynthBase::getProfileReport() {
+  static constexpr int kNameWidth = 24;
+  static constexpr int kColumnWidth = 14;
+
+  if (!vital::profiler::kAvailable)
+    return "Profiling needs a build with VITAL_PROFILE=1.";
+
+  std::vector<vital::ProfileEntry> profile = getProfile();
+  uint64_t engine_cycles = 0;
+  uint64_t blocks = 0;
+  uint64_t module_cycles = 0;
+  for (const vital::ProfileEntry& entry : profile) {
+    if (entry.name == "engine") {
+      engine_cycles = entry.cycles;
+      blocks = entry.calls;
+    }
+    else
+      module_cycles += entry.cycles;
+  }
+
+  if (blocks == 0)
+    return "No audio was processed while profiling.";
+
+  // Modules never nest, so whatever the engine spends outside of them is the voice and mixing overhead.
+  vital::ProfileEntry other;
+  other.name = "other";
+  other.cycles = engine_cycles > module_cycles ? engine_cycles - module_cycles : 0;
+  other.calls = blocks;
+  profile.push_back(other);
+
+  String unit = vital::profiler::kUnit;
+  String report = String(static_cast<int64>(blocks)) + " blocks, " +
+                  String(static_cast<int64>(engine_cycles / blocks)) + " " + unit + " per block\n\n";
+  report += String("module").paddedRight(' ', kNameWidth) + String("share").paddedLeft(' ', kColumnWidth) +
+            String(unit + " / block").paddedLeft(' ', kColumnWidth) +
+            String(unit + " / call").paddedLeft(' ', kColumnWidth) +
+            String("calls").paddedLeft(' ', kColumnWidth) + "\n";
+
+  for (const vital::ProfileEntry& entry : profile) {
+    if (entry.name == "engine" || entry.calls == 0)
+      continue;
+
+    double share = engine_cycles ? (100.0 * entry.cycles) / engine_cycles : 0.0;
+    String name = entry.name + (entry.polyphonic ? " (voice)" : "");
+    report += name.paddedRight(' ', kNameWidth) +
+              (String(share, 1) + "%").paddedLeft(' ', kColumnWidth) +
+              String(static_cast<int64>(entry.cycles / blocks)).paddedLeft(' ', kColumnWidth) +
+              String(static_cast<int64>(entry.cycles / entry.calls)).paddedLeft(' ', kColumnWidth) +
+              String(static_cast<int64>(entry.calls)).paddedLeft(' ', kColumnWidth) + "\n";
+  }
+
+  return report;
+}
+
 void SynthBase::ValueChangedCallback::messageCallback() {
   if (auto synth_base = listener.lock()) {
     SynthGuiInterface* gui_interface = (*synth_base)->getGuiInterface();
@@ -19,12 +19,16 @@
 #include "JuceHeader.h"
 #include "concurrentqueue/concurrentqueue.h"
 #include "line_generator.h"
+#include "load_save.h"
 #include "synth_constants.h"
 #include "synth_types.h"
 #include "midi_manager.h"
+#include "profiler.h"
 #include "tuning.h"
 #include "wavetable_creator.h"
 
+#include <atomic>
+#include <functional>
 #include <set>
 #include <string>
 
@@ -38,12 +42,16 @@ namespace vital {
   class Wavetable;
 }
 
+class PresetLoader;
 class SynthGuiInterface;
 
 class SynthBase : public MidiManager::Listener {
   public:
     static constexpr float kOutputWindowMinNote = 16.0f;
     static constexpr float kOutputWindowMaxNote = 128.0f;
+    static constexpr float kLoadFadeSeconds = 0.01f;
+    static constexpr double kLoadFadeTimeoutMs = 500.0;
+    static constexpr double kAudioIdleMs = 100.0;
 
     SynthBase();
     virtual ~SynthBase();
@@ -83,6 +91,9 @@ class SynthBase : public MidiManager::Listener {
     void loadTuningFile(const File& file);
     void loadInitPreset();
     bool loadFromFile(File preset, std::string& error);
+    void loadFromFileInBackground(File preset, std::function<void(bool, const std::string&)> callback);
+    void loadPreparedPreset(File preset, LoadSave::PreparedState* state);
+    PresetLoader* getPresetLoader() { return preset_loader_.get(); }
     void renderAudioToFile(File file, float seconds, float bpm, std::vector<int> notes, bool render_images);
     void renderAudioForResynthesis(float* data, int samples, int note);
     bool saveToFile(File preset);
@@ -120,6 +131,13 @@ class SynthBase : public MidiManager::Listener {
     vital::ModulationConnectionBank& getModulationBank();
     void notifyOversamplingChanged();
     void checkOversampling();
+
+    // Time spent in each named module of the engine. Needs a build with VITAL_PROFILE=1.
+    void setProfiling(bool profiling);
+    bool isProfiling() { return vital::profiler::enabled(); }
+    std::vector<vital::ProfileEntry> getProfile();
+    String getProfileReport();
+
     virtual const CriticalSection& getCriticalSection() = 0;
     virtual void pauseProcessing(bool pause) = 0;
     Tuning* getTuning() { return &tuning_; }
@@ -141,6 +159,9 @@ class SynthBase : public MidiManager::Listener {
     virtual SynthGuiInterface* getGuiInterface() = 0;
     json saveToJson();
     bool loadFromJson(const json& state);
+    void swapInState(LoadSave::PreparedState* state);
+    bool isProcessing() const;
+    void fadeOutForLoad();
     vital::ModulationConnection* getConnection(const std::string& source, const std::string& destination);
 
     inline bool getNextModulationChange(vital::modulation_change& change) {
@@ -157,6 +178,7 @@ class SynthBase : public MidiManager::Listener {
     void processAudioWithInput(AudioSampleBuffer* buffer, const vital::poly_float* input_buffer,
                                int channels, int samples, int offset);
     void writeAudio(AudioSampleBuffer* buffer, int channels, int samples, int offset);
+    void applyLoadFade(AudioSampleBuffer* buffer, int channels, int samples, int offset);
     void processMidi(MidiBuffer& buffer, int start_sample = 0, int end_sample = 0);
     void processKeyboardEvents(MidiBuffer& buffer, int num_samples);
     void processModulationChanges();
@@ -168,6 +190,7 @@ class SynthBase : public MidiManager::Listener {
 
     std::unique_ptr<WavetableCreator> wavetable_creators_[vital::kNumOscillators];
     std::shared_ptr<SynthBase*> self_reference_;
+    std::unique_ptr<PresetLoader> preset_loader_;
 
     File active_file_;
     vital::poly_float oscilloscope_memory_[2 * vital::kOscilloscopeMemoryResolution];
@@ -180,6 +203,12 @@ class SynthBase : public MidiManager::Listener {
     int memory_index_;
     bool expired_;
 
+    vital::mono_float load_gain_;
+    std::atomic<bool> load_fade_out_;
+    std::atomic<bool> load_faded_;
+    std::atomic<uint32> last_block_time_;
+    std::atomic<Thread::ThreadID> audio_thread_;
+
     std::map<std::string, String> save_info_;
     vital::control_map controls_;
     vital::CircularQueue<vital::ModulationConnection*> mod_connections_;
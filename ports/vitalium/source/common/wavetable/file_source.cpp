@@ -15,6 +15,7 @@
  */
 
 #include "file_source.h"
+#include "binary_state.h"
 
 FileSource::FileSourceKeyframe::FileSourceKeyframe(SampleBuffer* sample_buffer) {
   sample_buffer_ = sample_buffer;
@@ -275,13 +276,12 @@ json FileSource::stateToJson() {
 
   int save_samples = max_position + 2 * window_size_ + kExtraSaveSamples;
   int num_samples = std::min(sample_buffer_.size, save_samples);
-  String encoded = "";
+  data["audio_file"] = "";
   if (getDataBuffer()) {
     std::unique_ptr<int16_t[]> pcm_data = std::make_unique<int16_t[]>(num_samples);
     vital::utils::floatToPcmData(pcm_data.get(), getDataBuffer(), num_samples);
-    encoded = Base64::toBase64(pcm_data.get(), num_samples * sizeof(int16_t));
+    data["audio_file"] = BinaryState::encodeBlob(pcm_data.get(), num_samples * sizeof(int16_t));
   }
-  data["audio_file"] = encoded.toStdString();
   return data;
 }
 
@@ -311,11 +311,9 @@ void FileSource::jsonToState(json data) {
   if (data.count("audio_sample_rate"))
     sample_rate = data["audio_sample_rate"];
 
-  MemoryOutputStream decoded;
-  std::string audio_data = data["audio_file"];
-  Base64::convertFromBase64(decoded, audio_data);
+  MemoryBlock decoded = BinaryState::decodeBlob(data["audio_file"]);
 
-  int size = static_cast<int>(decoded.getDataSize()) / sizeof(int16_t);
+  int size = static_cast<int>(decoded.getSize()) / sizeof(int16_t);
   std::unique_ptr<float[]> float_data = std::make_unique<float[]>(size);
   vital::utils::pcmToFloatData(float_data.get(), (int16_t*)decoded.getData(), size);
   loadBuffer(float_data.get(), size, sample_rate);
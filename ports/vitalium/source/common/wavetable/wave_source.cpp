@@ -15,6 +15,7 @@
  */
 
 #include "wave_source.h"
+#include "binary_state.h"
 #include "wave_frame.h"
 #include "wavetable_component_factory.h"
 
@@ -191,18 +192,17 @@ void WaveSourceKeyframe::smoothInterpolate(const WavetableKeyframe* prev_keyfram
 }
 
 json WaveSourceKeyframe::stateToJson() {
-  String encoded = Base64::toBase64(wave_frame_->time_domain, sizeof(float) * vital::WaveFrame::kWaveformSize);
   json data = WavetableKeyframe::stateToJson();
-  data["wave_data"] = encoded.toStdString();
+  data["wave_data"] = BinaryState::encodeBlob(wave_frame_->time_domain,
+                                              sizeof(float) * vital::WaveFrame::kWaveformSize);
   return data;
 }
 
 void WaveSourceKeyframe::jsonToState(json data) {
   WavetableKeyframe::jsonToState(data);
 
-  MemoryOutputStream decoded(sizeof(float) * vital::WaveFrame::kWaveformSize);
-  std::string wave_data = data["wave_data"];
-  Base64::convertFromBase64(decoded, wave_data);
+  MemoryBlock decoded = BinaryState::decodeBlob(data["wave_data"]);
+  decoded.ensureSize(sizeof(float) * vital::WaveFrame::kWaveformSize, true);
   memcpy(wave_frame_->time_domain, decoded.getData(), sizeof(float) * vital::WaveFrame::kWaveformSize);
   wave_frame_->toFrequencyDomain();
 }
\ No newline at end of file
@@ -168,6 +168,13 @@ void WavetableCreator::loadDefaultCreator() {
   addGroup(new_group);
 }
 
+void WavetableCreator::swapState(WavetableCreator* other) {
+  groups_.swap(other->groups_);
+  std::swap(remove_all_dc_, other->remove_all_dc_);
+  std::swap(full_normalize_, other->full_normalize_);
+  wavetable_->swapState(other->wavetable_);
+}
+
 void WavetableCreator::initPredefinedWaves() {
   clear();
 
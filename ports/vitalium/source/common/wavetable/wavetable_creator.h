@@ -56,6 +56,7 @@ class WavetableCreator {
     void init();
     void clear();
     void loadDefaultCreator();
+    void swapState(WavetableCreator* other);
 
     void initPredefinedWaves();
     void initFromAudioFile(const float* audio_buffer, int num_samples, int sample_rate,
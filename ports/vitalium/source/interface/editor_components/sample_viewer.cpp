@@ -56,8 +56,8 @@ void SampleViewer::setLinePositions() {
   if (sample_ == nullptr)
     return;
 
-  double sample_length = sample_->originalLength();
-  const vital::mono_float* buffer = sample_->buffer();
+  double sample_length = sample_->overviewLength();
+  const vital::mono_float* buffer = sample_->overview();
   float center = getHeight() / 2.0f;
   for (int i = 0; i < kResolution; ++i) {
     int start_index = std::min<int>(sample_length * i / kResolution, sample_length);
@@ -54,6 +54,10 @@ namespace {
       preset_selector->loadSkin();
     else if (result == SynthPresetSelector::kClearSkin)
       preset_selector->clearSkin();
+    else if (result == SynthPresetSelector::kToggleProfiling)
+      preset_selector->toggleProfiling();
+    else if (result == SynthPresetSelector::kCopyProfile)
+      preset_selector->copyProfile();
   }
 
   String redactEmail(const String& email) {
@@ -129,9 +133,15 @@ void SynthPresetSelector::buttonClicked(Button* clicked_button) {
 void SynthPresetSelector::newPresetSelected(File preset) {
   browser_->clearExternalPreset();
   SynthGuiInterface* parent = findParentComponentOfClass<SynthGuiInterface>();
-  std::string error;
-  bool result = parent->getSynth()->loadFromFile(preset, error);
-  if (result)
+  Component::SafePointer<SynthPresetSelector> selector(this);
+  parent->getSynth()->loadFromFileInBackground(preset, [=](bool loaded, const std::string& error) {
+    if (selector)
+      selector->presetLoaded(loaded, error);
+  });
+}
+
+void SynthPresetSelector::presetLoaded(bool loaded, std::string error) {
+  if (loaded)
     resetText();
   else {
     error = "There was an error open the preset. " + error;
@@ -219,6 +229,15 @@ void SynthPresetSelector::showAlternatePopupMenu(Component* anchor) {
   if (LoadSave::getDefaultSkin().exists())
     options.addItem(kClearSkin, "Load Default Skin");
 
+  if (vital::profiler::kAvailable) {
+    SynthGuiInterface* parent = findParentComponentOfClass<SynthGuiInterface>();
+    bool profiling = parent && parent->getSynth()->isProfiling();
+    options.addItem(-1, "");
+    options.addItem(kToggleProfiling, profiling ? "Stop Profiling" : "Start Profiling");
+    if (profiling)
+      options.addItem(kCopyProfile, "Copy Profile");
+  }
+
   showPopupSelector(this, Point<int>(anchor->getX(), anchor->getBottom()), options,
                     [=](int selection) { menuCallback(selection, this); });
 }
@@ -393,6 +412,21 @@ void SynthPresetSelector::clearSkin() {
   repaintWithSkin();
 }
 
+void SynthPresetSelector::toggleProfiling() {
+  SynthGuiInterface* parent = findParentComponentOfClass<SynthGuiInterface>();
+  SynthBase* synth = parent->getSynth();
+  if (synth->isProfiling())
+    copyProfile();
+  synth->setProfiling(!synth->isProfiling());
+}
+
+void SynthPresetSelector::copyProfile() {
+  SynthGuiInterface* parent = findParentComponentOfClass<SynthGuiInterface>();
+  String report = parent->getSynth()->getProfileReport();
+  Logger::writeToLog(report);
+  SystemClipboard::copyTextToClipboard(report);
+}
+
 void SynthPresetSelector::repaintWithSkin() {
   FullInterface* full_interface = findParentComponentOfClass<FullInterface>();
   full_interface->reloadSkin(*full_skin_);
@@ -50,6 +50,8 @@ class SynthPresetSelector : public SynthSection,
       kOpenSkinDesigner,
       kLoadSkin,
       kClearSkin,
+      kToggleProfiling,
+      kCopyProfile,
       kNumMenuItems
     };
 
@@ -60,6 +62,7 @@ class SynthPresetSelector : public SynthSection,
     void paintBackground(Graphics& g) override { selector_ ->paintBackground(g); }
     void buttonClicked(Button* buttonThatWasClicked) override;
     void newPresetSelected(File preset) override;
+    void presetLoaded(bool loaded, std::string error);
     void deleteRequested(File preset) override;
     void hidePresetBrowser() override;
     void hideBankExporter() override;
@@ -103,6 +106,8 @@ class SynthPresetSelector : public SynthSection,
     void openSkinDesigner();
     void loadSkin();
     void clearSkin();
+    void toggleProfiling();
+    void copyProfile();
     void repaintWithSkin();
     void browsePresets();
 
@@ -315,7 +315,7 @@ void EqualizerSection::parentHierarchyChanged() {
 
 void EqualizerSection::renderOpenGlComponents(OpenGlWrapper& open_gl, bool animate) {
   if (parent_) {
-    int oversampling_amount = parent_->getSynth()->getEngine()->getOversamplingAmount();
+    int oversampling_amount = parent_->getSynth()->getEngine()->getEqualizerOversamplingAmount();
     if (oversampling_amount >= 1)
       spectrogram_->setOversampleAmount(oversampling_amount);
   }
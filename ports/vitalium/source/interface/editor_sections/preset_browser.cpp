@@ -81,6 +81,11 @@ PresetList::PresetList() : SynthSection("Preset List"),
   hover_.setAdditive(true);
 
   favorites_ = LoadSave::getFavorites();
+  preset_info_cache_.getIndex()->addListener(this);
+}
+
+PresetList::~PresetList() {
+  preset_info_cache_.getIndex()->removeListener(this);
 }
 
 void PresetList::paintBackground(Graphics& g) {
@@ -162,9 +167,14 @@ void PresetList::sort() {
   else if (sort_column_ == kStyle && !sort_ascending_)
     sortFileArrayWithCache<StyleDescendingComparator>(presets_, &preset_info_cache_);
   else if (sort_column_ == kDate && sort_ascending_)
-    sortFileArray<FileDateAscendingComparator>(presets_);
+    sortFileArrayWithCache<FileDateAscendingComparator>(presets_, &preset_info_cache_);
   else if (sort_column_ == kDate && !sort_ascending_)
-    sortFileArray<FileDateDescendingComparator>(presets_);
+    sortFileArrayWithCache<FileDateDescendingComparator>(presets_, &preset_info_cache_);
+
+  PresetIndex* index = preset_info_cache_.getIndex();
+  preset_ids_.clear();
+  for (const File& preset : presets_)
+    preset_ids_.push_back(index->getId(preset));
 
   filter(filter_string_, filter_styles_);
 }
@@ -355,11 +365,24 @@ void PresetList::finishRename() {
 }
 
 void PresetList::reloadPresets() {
-  presets_.clear();
+  preset_info_cache_.getIndex()->rescan();
+  loadIndexedPresets();
+}
+
+void PresetList::presetIndexChanged() {
+  preset_info_cache_.clear();
+  loadIndexedPresets();
+}
+
+void PresetList::loadIndexedPresets() {
+  std::vector<File> directories;
   if (current_folder_.exists() && current_folder_.isDirectory())
-    current_folder_.findChildFiles(presets_, File::findFiles, true, "*." + vital::kPresetExtension);
+    directories.push_back(current_folder_);
   else
-    LoadSave::getAllPresets(presets_);
+    directories = LoadSave::getPresetDirectories();
+
+  presets_.clear();
+  preset_info_cache_.getIndex()->getPresets(presets_, directories);
   sort();
   redoCache();
 }
@@ -391,25 +414,11 @@ void PresetList::filter(String filter_string, const std::set<std::string>& style
   tokens.addTokens(filter_string_, " ", "");
   filtered_presets_.clear();
 
-  for (const File& preset : presets_) {
-    bool match = true;
-    std::string path = preset.getFullPathName().toStdString();
-    if (!styles.empty()) {
-      std::string style = preset_info_cache_.getStyle(preset);
-      if (styles.count(style) == 0)
-        match = false;
-    }
-    if (match && tokens.size()) {
-      String name = preset.getFileNameWithoutExtension().toLowerCase();
-      String author = String(preset_info_cache_.getAuthor(preset)).toLowerCase();
-
-      for (const String& token : tokens) {
-        if (!name.contains(token) && !author.contains(token))
-          match = false;
-      }
-    }
-    if (match)
-      filtered_presets_.push_back(preset);
+  std::vector<bool> matches = preset_info_cache_.getIndex()->search(tokens, styles);
+  for (int i = 0; i < presets_.size(); ++i) {
+    int id = preset_ids_[i];
+    if (id < matches.size() && matches[id])
+      filtered_presets_.push_back(presets_[i]);
   }
   num_view_presets_ = static_cast<int>(filtered_presets_.size());
 
@@ -960,28 +969,35 @@ void PresetBrowser::externalPresetLoaded(File file) {
   setPresetInfo(file);
 }
 
-bool PresetBrowser::loadFromFile(File& preset) {
+void PresetBrowser::loadFromFile(File& preset) {
+  SynthGuiInterface* parent = findParentComponentOfClass<SynthGuiInterface>();
+  if (parent == nullptr)
+    return;
+
+  Component::SafePointer<PresetBrowser> browser(this);
+  parent->getSynth()->loadFromFileInBackground(preset, [=](bool loaded, const std::string& error) {
+    if (browser && loaded)
+      browser->presetLoaded(preset);
+  });
+}
+
+void PresetBrowser::presetLoaded(File preset) {
   SynthGuiInterface* parent = findParentComponentOfClass<SynthGuiInterface>();
   if (parent == nullptr)
-    return false;
+    return;
 
   SynthBase* synth = parent->getSynth();
-  std::string error;
-  if (synth->loadFromFile(preset, error)) {
-    setPresetInfo(preset);
-    synth->setPresetName(preset.getFileNameWithoutExtension());
-    synth->setAuthor(author_);
-
-    String comments = parent->getSynth()->getComments();
-    int comments_font_size = kCommentsFontHeight * size_ratio_;
-    if (comments_) {
-      comments_->setText(comments);
-      comments_->setFont(Fonts::instance()->proportional_light().withPointHeight(comments_font_size));
-      comments_->redoImage();
-    }
-    return true;
+  setPresetInfo(preset);
+  synth->setPresetName(preset.getFileNameWithoutExtension());
+  synth->setAuthor(author_);
+
+  String comments = synth->getComments();
+  int comments_font_size = kCommentsFontHeight * size_ratio_;
+  if (comments_) {
+    comments_->setText(comments);
+    comments_->setFont(Fonts::instance()->proportional_light().withPointHeight(comments_font_size));
+    comments_->redoImage();
   }
-  return false;
 }
 
 void PresetBrowser::loadPresetInfo() {
@@ -1026,7 +1042,7 @@ void PresetBrowser::loadPresetInfo() {
 void PresetBrowser::setPresetInfo(File& preset) {
   if (preset.exists()) {
     try {
-      json parsed_json_state = json::parse(preset.loadFileAsString().toStdString(), nullptr, false);
+      json parsed_json_state = LoadSave::parseStateFile(preset);
       author_ = LoadSave::getAuthorFromFile(preset);
       license_ = LoadSave::getLicense(parsed_json_state);
     }
@@ -25,15 +25,20 @@
 #include "open_gl_multi_quad.h"
 #include "overlay.h"
 #include "popup_browser.h"
+#include "preset_index.h"
 #include "save_section.h"
 #include "synth_section.h"
 
 class PresetInfoCache {
   public:
+    PresetInfoCache() : index_(PresetIndex::getShared()) { }
+
+    PresetIndex* getIndex() { return index_.get(); }
+
     std::string getAuthor(const File& preset) {
       std::string path = preset.getFullPathName().toStdString();
       if (author_cache_.count(path) == 0)
-        author_cache_[path] = LoadSave::getAuthorFromFile(preset).toStdString();
+        author_cache_[path] = index_->getAuthor(preset);
 
       return author_cache_[path];
     }
@@ -41,17 +46,33 @@ class PresetInfoCache {
     std::string getStyle(const File& preset) {
       std::string path = preset.getFullPathName().toStdString();
       if (style_cache_.count(path) == 0)
-        style_cache_[path] = LoadSave::getStyleFromFile(preset).toLowerCase().toStdString();
+        style_cache_[path] = index_->getStyle(preset);
 
       return style_cache_[path];
     }
 
+    int64 getCreated(const File& preset) {
+      std::string path = preset.getFullPathName().toStdString();
+      if (created_cache_.count(path) == 0)
+        created_cache_[path] = index_->getCreated(preset);
+
+      return created_cache_[path];
+    }
+
+    void clear() {
+      author_cache_.clear();
+      style_cache_.clear();
+      created_cache_.clear();
+    }
+
   private:
+    std::shared_ptr<PresetIndex> index_;
     std::map<std::string, std::string> author_cache_;
     std::map<std::string, std::string> style_cache_;
+    std::map<std::string, int64> created_cache_;
 };
 
-class PresetList : public SynthSection, public TextEditor::Listener, ScrollBar::Listener {
+class PresetList : public SynthSection, public TextEditor::Listener, ScrollBar::Listener, PresetIndex::Listener {
   public:
     class Listener {
       public:
@@ -162,18 +183,28 @@ class PresetList : public SynthSection, public TextEditor::Listener, ScrollBar::
 
     class FileDateAscendingComparator {
       public:
-        static int compareElements(File first, File second) {
-          RelativeTime relative_time = first.getCreationTime() - second.getCreationTime();
-          double days = relative_time.inDays();
-          return days < 0.0 ? 1 : (days > 0.0f ? -1 : 0);
+        FileDateAscendingComparator(PresetInfoCache* preset_cache) : cache_(preset_cache) { }
+
+        int compareElements(File first, File second) {
+          int64 first_created = cache_->getCreated(first);
+          int64 second_created = cache_->getCreated(second);
+          return first_created < second_created ? 1 : (first_created > second_created ? -1 : 0);
         }
+
+      private:
+        PresetInfoCache* cache_;
     };
 
     class FileDateDescendingComparator {
       public:
-        static int compareElements(File first, File second) {
-          return FileDateAscendingComparator::compareElements(second, first);
+        FileDateDescendingComparator(PresetInfoCache* preset_cache) : ascending_(preset_cache) { }
+
+        int compareElements(File first, File second) {
+          return ascending_.compareElements(second, first);
         }
+
+      private:
+        FileDateAscendingComparator ascending_;
     };
 
     class FavoriteComparator {
@@ -216,6 +247,7 @@ class PresetList : public SynthSection, public TextEditor::Listener, ScrollBar::
     };
 
     PresetList();
+    ~PresetList();
 
     void paintBackground(Graphics& g) override;
     void paintBackgroundShadow(Graphics& g) override { paintTabShadow(g); }
@@ -242,6 +274,7 @@ class PresetList : public SynthSection, public TextEditor::Listener, ScrollBar::
 
     void finishRename();
     void reloadPresets();
+    void presetIndexChanged() override;
     void shiftSelectedPreset(int indices);
 
     void redoCache();
@@ -268,10 +301,12 @@ class PresetList : public SynthSection, public TextEditor::Listener, ScrollBar::
     }
     void loadBrowserCache(int start_index, int end_index);
     void moveQuadToRow(OpenGlQuad& quad, int row, float y_offset);
+    void loadIndexedPresets();
     void sort();
 
     std::vector<Listener*> listeners_;
     Array<File> presets_;
+    std::vector<int> preset_ids_;
     int num_view_presets_;
     std::vector<File> filtered_presets_;
     std::set<std::string> favorites_;
@@ -379,7 +414,8 @@ class PresetBrowser : public SynthSection,
     void doubleClickedSelected(File selection) override { }
 
   private:
-    bool loadFromFile(File& preset);
+    void loadFromFile(File& preset);
+    void presetLoaded(File preset);
     void loadPresetInfo();
     void setCommentsBounds();
     void setPresetInfo(File& preset);
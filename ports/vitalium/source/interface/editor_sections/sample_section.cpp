@@ -257,14 +257,17 @@ void SampleSection::reset() {
 }
 
 void SampleSection::loadFile(const File& file) {
-  static constexpr int kMaxFileSamples = 17640000;
   preset_selector_->setText(file.getFileNameWithoutExtension());
   sample_->setLastBrowsedFile(file.getFullPathName().toStdString());
 
   std::unique_ptr<AudioFormatReader> format_reader(sample_viewer_->formatManager().createReaderFor(file));
 
-  if (format_reader) {
-    int num_samples = (int)std::min<long long>(format_reader->lengthInSamples, kMaxFileSamples);
+  if (format_reader && format_reader->lengthInSamples > vital::Sample::kMaxMemoryLength) {
+    if (sample_->loadStreamedSample(file))
+      sample_->setName(file.getFileNameWithoutExtension().toStdString());
+  }
+  else if (format_reader) {
+    int num_samples = (int)format_reader->lengthInSamples;
     sample_buffer_.setSize(format_reader->numChannels, num_samples);
     format_reader->read(&sample_buffer_, 0, num_samples, 0, true, true);
     if (sample_buffer_.getNumChannels() > 1) {
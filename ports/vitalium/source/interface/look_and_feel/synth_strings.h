@@ -17,6 +17,7 @@
 #pragma once
 
 #include <string>
+#include "operators.h"
 #include "synth_constants.h"
 
 namespace strings {
@@ -18,6 +18,7 @@
 #include "synth_editor.h"
 #include "sound_engine.h"
 #include "load_save.h"
+#include "binary_state.h"
 
 SynthPlugin::SynthPlugin() {
   last_seconds_time_ = 0.0;
@@ -187,9 +188,19 @@ void SynthPlugin::parameterChanged(std::string name, vital::mono_float value) {
 }
 
 void SynthPlugin::getStateInformation(MemoryBlock& dest_data) {
-  json data = LoadSave::stateToJson(this, getCallbackLock());
+  bool binary = LoadSave::shouldSaveBinaryState();
+  json data;
+  {
+    BinaryState::RawBlobs raw_blobs(binary);
+    data = LoadSave::stateToJson(this, getCallbackLock());
+  }
   data["tuning"] = getTuning()->stateToJson();
 
+  if (binary) {
+    BinaryState::jsonToBinary(std::move(data), dest_data, true);
+    return;
+  }
+
   String data_string = data.dump();
   MemoryOutputStream stream;
   stream.writeString(data_string);
@@ -197,22 +208,26 @@ void SynthPlugin::getStateInformation(MemoryBlock& dest_data) {
 }
 
 void SynthPlugin::setStateInformation(const void* data, int size_in_bytes) {
-  MemoryInputStream stream(data, size_in_bytes, false);
-  String data_string = stream.readEntireStreamAsString();
-
-  pauseProcessing(true);
   try {
-    json json_data = json::parse(data_string.toStdString());
-    LoadSave::jsonToState(this, save_info_, json_data);
+    json json_data;
+    if (BinaryState::isBinaryState(data, size_in_bytes))
+      json_data = BinaryState::binaryToJson(data, size_in_bytes);
+    else {
+      MemoryInputStream stream(data, size_in_bytes, false);
+      json_data = json::parse(stream.readEntireStreamAsString().toStdString());
+    }
 
-    if (json_data.count("tuning"))
+    loadFromJson(json_data);
+
+    if (json_data.count("tuning")) {
+      ScopedLock lock(getCallbackLock());
       getTuning()->jsonToState(json_data["tuning"]);
+    }
   }
   catch (const json::exception& e) {
     std::string error = "There was an error open the preset. Preset file is corrupted.";
     AlertWindow::showNativeDialogBox("Error opening preset", error, false);
   }
-  pauseProcessing(false);
 
   SynthGuiInterface* editor = getGuiInterface();
   if (editor)
@@ -95,6 +95,19 @@ namespace vital {
     output(kCutoffOutput)->buffer[0] = cutoff_.buffer[num_samples - 1];
   }
 
+  void Phaser::skipSamples(int num_samples) {
+    poly_float rate = input(kRate)->at(0);
+    double sample_time = 1.0 / getSampleRate();
+
+    // Per voice in double so long skips stay exact. Whole cycles don't move the phase and the
+    // fraction that's left always fits the unsigned phase.
+    for (int i = 0; i < poly_float::kSize; ++i) {
+      double cycles = rate[i] * sample_time * num_samples;
+      cycles -= std::floor(cycles);
+      phase_.set(i, phase_[i] + (uint32_t)(cycles * UINT_MAX));
+    }
+  }
+
   void Phaser::correctToTime(double seconds) {
     poly_float rate = input(kRate)->at(0);
     poly_float offset = utils::getCycleOffsetFromSeconds(seconds, rate);
@@ -53,6 +53,7 @@ namespace vital {
       void init() override;
       void hardReset() override;
       void correctToTime(double seconds);
+      void skipSamples(int num_samples);
       void setOversampleAmount(int oversample) override {
         ProcessorRouter::setOversampleAmount(oversample);
         cutoff_.ensureBufferSize(oversample * kMaxBufferSize);
@@ -17,7 +17,9 @@
 #include "upsampler.h"
 
 namespace vital {
-  Upsampler::Upsampler() : ProcessorRouter(kNumInputs, 1) { }
+  Upsampler::Upsampler() : ProcessorRouter(kNumInputs, 1) {
+    reset(constants::kFullMask);
+  }
 
   Upsampler::~Upsampler() { }
 
@@ -28,13 +30,63 @@ namespace vital {
 
   void Upsampler::processWithInput(const poly_float* audio_in, int num_samples) {
     poly_float* destination = output()->buffer;
-
     int oversample_amount = getOversampleAmount();
 
+    if (oversample_amount <= 1) {
+      utils::copyBuffer(destination, audio_in, num_samples);
+      return;
+    }
+
+    // Every stage writes to the end of the output buffer so the next stage can read ahead of what it writes.
+    int total_samples = num_samples * oversample_amount;
+    int stage_samples = num_samples;
+    const poly_float* stage_in = audio_in;
+    for (int stage = 0; stage < kMaxStages && stage_samples < total_samples; ++stage) {
+      poly_float* stage_out = destination + total_samples - 2 * stage_samples;
+      upsampleStage(stage_out, stage_in, stage_samples, stage);
+      stage_in = stage_out;
+      stage_samples *= 2;
+    }
+
+    VITAL_ASSERT(stage_samples == total_samples);
+  }
+
+  void Upsampler::upsampleStage(poly_float* audio_out, const poly_float* audio_in, int num_samples, int stage) {
+    // The lowest rate stage needs the sharp cutoff, like the last stage of the Decimator.
+    int num_taps = IirHalfbandDecimator::kNumTaps9;
+    const poly_float* taps = IirHalfbandDecimator::kTaps9;
+    if (stage == 0) {
+      num_taps = IirHalfbandDecimator::kNumTaps25;
+      taps = IirHalfbandDecimator::kTaps25;
+    }
+
+    poly_float* in_memory = in_memory_[stage];
+    poly_float* out_memory = out_memory_[stage];
+
     for (int i = 0; i < num_samples; ++i) {
-      int offset = i * oversample_amount;
-      for (int s = 0; s < oversample_amount; ++s)
-        destination[offset + s] = audio_in[i];
+      // Both allpass branches run on the same input, one per lane pair, and take turns producing output.
+      poly_float result = utils::consolidateAudio(audio_in[i], audio_in[i]);
+      for (int tap_index = 0; tap_index < num_taps; ++tap_index) {
+        poly_float delta = result - out_memory[tap_index];
+        poly_float new_result = utils::mulAdd(in_memory[tap_index], taps[tap_index], delta);
+        in_memory[tap_index] = result;
+        out_memory[tap_index] = new_result;
+        result = new_result;
+      }
+
+      poly_float branches = utils::swapInner(result);
+      poly_float delayed_branch = utils::swapVoices(branches);
+      audio_out[2 * i] = utils::compactFirstVoices(delayed_branch, delayed_branch);
+      audio_out[2 * i + 1] = utils::compactFirstVoices(branches, branches);
+    }
+  }
+
+  void Upsampler::reset(poly_mask reset_mask) {
+    for (int stage = 0; stage < kMaxStages; ++stage) {
+      for (int i = 0; i < IirHalfbandDecimator::kNumTaps25; ++i) {
+        in_memory_[stage][i] = 0.0f;
+        out_memory_[stage][i] = 0.0f;
+      }
     }
   }
 } // namespace vital
@@ -17,12 +17,17 @@
 #pragma once
 
 #include "processor_router.h"
+#include "iir_halfband_decimator.h"
 #include "synth_constants.h"
 
 namespace vital {
 
+  // Upsamples by the oversample amount with a cascade of polyphase IIR halfband stages, the
+  // interpolating counterpart of the Decimator. num_samples counts input samples.
   class Upsampler : public ProcessorRouter {
     public:
+      static constexpr int kMaxStages = 3;
+
       enum {
         kAudio,
         kNumInputs
@@ -35,8 +40,14 @@ namespace vital {
 
       virtual void process(int num_samples) override;
       virtual void processWithInput(const poly_float* audio_in, int num_samples) override;
+      void reset(poly_mask reset_mask) override;
 
     private:
+      void upsampleStage(poly_float* audio_out, const poly_float* audio_in, int num_samples, int stage);
+
+      poly_float in_memory_[kMaxStages][IirHalfbandDecimator::kNumTaps25];
+      poly_float out_memory_[kMaxStages][IirHalfbandDecimator::kNumTaps25];
+
       JUCE_LEAK_DETECTOR(Upsampler)
   };
 } // namespace vital
@@ -26,6 +26,11 @@
 #define VITAL_ASSERT(x) ((void)0)
 #endif // DEBUG
 
+// Profiling. Builds with VITAL_PROFILE=1 can time every processor once profiling is switched on.
+#ifndef VITAL_PROFILE
+#define VITAL_PROFILE 0
+#endif
+
 #define UNUSED(x) ((void)x)
 
 #if !defined(force_inline)
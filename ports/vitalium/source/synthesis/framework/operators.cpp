@@ -19,6 +19,41 @@
 
 namespace vital {
 
+  namespace {
+    // Adds one or two linear modulation terms on top of a ramp or of what is already in dest.
+    template<int kNumTerms, bool kAccumulate>
+    force_inline void addModulationTerms(poly_float* dest, const ModulationTerm* const* terms,
+                                         poly_float value, poly_float delta_value, int num_samples) {
+      const poly_float* first_source = terms[0]->source;
+      poly_float first_offset = terms[0]->offset;
+      poly_float first_amount = terms[0]->amount;
+      poly_float first_delta = terms[0]->delta_amount;
+
+      const poly_float* second_source = terms[kNumTerms - 1]->source;
+      poly_float second_offset = terms[kNumTerms - 1]->offset;
+      poly_float second_amount = terms[kNumTerms - 1]->amount;
+      poly_float second_delta = terms[kNumTerms - 1]->delta_amount;
+
+      for (int s = 0; s < num_samples; ++s) {
+        poly_float total;
+        if (kAccumulate)
+          total = dest[s];
+        else {
+          value += delta_value;
+          total = value;
+        }
+
+        first_amount += first_delta;
+        total += (first_source[s] + first_offset) * first_amount;
+        if (kNumTerms > 1) {
+          second_amount += second_delta;
+          total += (second_source[s] + second_offset) * second_amount;
+        }
+        dest[s] = total;
+      }
+    }
+  } // namespace
+
   void Clamp::process(int num_samples) {
     VITAL_ASSERT(inputMatchesBufferSize());
 
@@ -229,21 +264,60 @@ namespace vital {
 
     current_control_value = utils::maskLoad(current_control_value, control_value_, getResetMask(kReset));
     poly_float delta_control_value = (control_value_ - current_control_value) * (1.0f / num_samples);
-    for (int s = 0; s < num_samples; ++s) {
-      current_control_value += delta_control_value;
-      dest[s] = current_control_value;
+
+    // Linear modulation terms are computed in place, two per pass, the first pass also writing the control value ramp.
+    // They are added before the rendered ones rather than in input order, so the sum matches rendering every
+    // connection to its own buffer within float rounding, not bit for bit.
+    const ModulationTerm* terms[kMaxFusedTerms];
+    int num_terms = 0;
+    bool written = false;
+    for (int i = kNumStaticInputs; i < num_inputs; ++i) {
+      const Output* source = input(i)->source;
+      if (source == &Processor::null_source_ || source->owner->isControlRate())
+        continue;
+
+      const ModulationTerm* term = source->owner->getModulationTerm();
+      if (term == nullptr || term->mode != ModulationTerm::kLinear)
+        continue;
+
+      terms[num_terms++] = term;
+      if (num_terms == kMaxFusedTerms) {
+        if (written)
+          addModulationTerms<kMaxFusedTerms, true>(dest, terms, 0.0f, 0.0f, num_samples);
+        else
+          addModulationTerms<kMaxFusedTerms, false>(dest, terms, current_control_value, delta_control_value, num_samples);
+        written = true;
+        num_terms = 0;
+      }
+    }
+
+    if (num_terms) {
+      if (written)
+        addModulationTerms<1, true>(dest, terms, 0.0f, 0.0f, num_samples);
+      else
+        addModulationTerms<1, false>(dest, terms, current_control_value, delta_control_value, num_samples);
+    }
+    else if (!written) {
+      for (int s = 0; s < num_samples; ++s) {
+        current_control_value += delta_control_value;
+        dest[s] = current_control_value;
+      }
     }
 
     for (int i = kNumStaticInputs; i < num_inputs; ++i) {
-      if (input(i)->source != &Processor::null_source_ && !input(i)->source->owner->isControlRate()) {
-        VITAL_ASSERT(inputMatchesBufferSize(i));
+      const Output* source = input(i)->source;
+      if (source == &Processor::null_source_ || source->owner->isControlRate())
+        continue;
 
-        const poly_float* source = input(i)->source->buffer;
+      const ModulationTerm* term = source->owner->getModulationTerm();
+      if (term && term->mode != ModulationTerm::kRendered)
+        continue;
 
-        for (int s = 0; s < num_samples; ++s) {
-          poly_float value = source[s];
-          dest[s] += value;
-        }
+      VITAL_ASSERT(inputMatchesBufferSize(i));
+      const poly_float* buffer = source->buffer;
+      for (int s = 0; s < num_samples; ++s) {
+        poly_float value = buffer[s];
+        dest[s] += value;
       }
     }
 
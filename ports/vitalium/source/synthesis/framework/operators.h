@@ -174,6 +174,8 @@ namespace vital {
       virtual bool hasState() const override { return true; }
 
     private:
+      static constexpr int kMaxFusedTerms = 2;
+
       poly_float control_value_;
 
       JUCE_LEAK_DETECTOR(ModulationSum)
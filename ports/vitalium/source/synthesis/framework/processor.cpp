@@ -199,6 +199,24 @@ namespace vital {
     return top_level;
   }
 
+  ProfileEntry Processor::getProfile() const {
+    ProfileEntry entry;
+    entry.name = state_->profile_name;
+    entry.polyphonic = isPolyphonic();
+#if VITAL_PROFILE
+    entry.cycles = state_->profile_cycles.load(std::memory_order_relaxed);
+    entry.calls = state_->profile_calls.load(std::memory_order_relaxed);
+#endif
+    return entry;
+  }
+
+  void Processor::resetProfile() {
+#if VITAL_PROFILE
+    state_->profile_cycles.store(0, std::memory_order_relaxed);
+    state_->profile_calls.store(0, std::memory_order_relaxed);
+#endif
+  }
+
   void Processor::registerInput(Input* input) {
     inputs_->push_back(input);
 
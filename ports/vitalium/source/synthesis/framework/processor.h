@@ -18,6 +18,7 @@
 
 #include "common.h"
 #include "poly_utils.h"
+#include "profiler.h"
 
 #include <cstring>
 #include <vector>
@@ -83,6 +84,25 @@ namespace vital {
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Output)
   };
 
+  // Audio rate modulation that a ModulationSum evaluates in place instead of reading a rendered buffer.
+  // Linear terms add (source + offset) * amount, with amount ramping by delta_amount every sample. Only poly
+  // destinations get them, mono ones need the rendered buffer that holds the last active voice.
+  struct ModulationTerm {
+    enum Mode {
+      kRendered,
+      kLinear,
+      kInactive
+    };
+
+    ModulationTerm() : mode(kRendered), source(nullptr), offset(0.0f), amount(0.0f), delta_amount(0.0f) { }
+
+    Mode mode;
+    const poly_float* source;
+    poly_float offset;
+    poly_float amount;
+    poly_float delta_amount;
+  };
+
   struct Input {
     Input() : source(nullptr) { }
 
@@ -110,6 +130,11 @@ namespace vital {
     bool control_rate;
     bool enabled;
     bool initialized;
+    std::string profile_name;
+#if VITAL_PROFILE
+    std::atomic<uint64_t> profile_cycles { 0 };
+    std::atomic<uint64_t> profile_calls { 0 };
+#endif
   };
 
   namespace cr {
@@ -137,6 +162,9 @@ namespace vital {
       // Does the processor require any data per voice.
       virtual bool hasState() const { return true; }
 
+      // Modulation connections describe their audio rate output so the destination can compute it in place.
+      virtual const ModulationTerm* getModulationTerm() const { return nullptr; }
+
       // Override this for main processing code.
       virtual void process(int num_samples) = 0;
       virtual void processWithInput(const poly_float* audio_in, int num_samples) { VITAL_ASSERT(false); }
@@ -299,6 +327,19 @@ namespace vital {
 
       void setPluggingStart(int start) { plugging_start_ = start; }
 
+      // Named processors show up in profiling reports. Voice copies share the name and counters.
+      void setProfileName(const std::string& name) { state_->profile_name = name; }
+      const std::string& getProfileName() const { return state_->profile_name; }
+      ProfileEntry getProfile() const;
+      void resetProfile();
+
+#if VITAL_PROFILE
+      force_inline void addProfileCycles(uint64_t cycles) {
+        state_->profile_cycles.fetch_add(cycles, std::memory_order_relaxed);
+        state_->profile_calls.fetch_add(1, std::memory_order_relaxed);
+      }
+#endif
+
     protected:
       Output* addOutput(int oversample = 1);
       Input* addInput();
@@ -318,5 +359,27 @@ namespace vital {
 
       JUCE_LEAK_DETECTOR(Processor)
   };
+
+#if VITAL_PROFILE
+  // Adds the cycles until the end of the scope to _processor_ while profiling is on.
+  class ProfileScope {
+    public:
+      force_inline ProfileScope(Processor* processor) :
+          processor_(profiler::enabled() ? processor : nullptr), start_(processor_ ? profiler::cycles() : 0) { }
+
+      force_inline ~ProfileScope() {
+        if (processor_)
+          processor_->addProfileCycles(profiler::cycles() - start_);
+      }
+
+    private:
+      Processor* processor_;
+      uint64_t start_;
+  };
+
+  #define VITAL_PROFILE_SCOPE(processor) ::vital::ProfileScope profile_scope(processor)
+#else
+  #define VITAL_PROFILE_SCOPE(processor) ((void)0)
+#endif
 } // namespace vital
 
@@ -79,7 +79,10 @@ namespace vital {
         int processor_samples = normal_samples * processor->getOversampleAmount();
 
         VITAL_ASSERT(processor->checkInputAndOutputSize(processor_samples));
-        processor->process(processor_samples);
+        {
+          VITAL_PROFILE_SCOPE(processor);
+          processor->process(processor_samples);
+        }
         VITAL_ASSERT(utils::isFinite(processor->output()->buffer, processor->isControlRate() ? 0 : processor_samples));
       }
     }
@@ -273,6 +276,24 @@ namespace vital {
     return false;
   }
 
+  void ProcessorRouter::getProfiledProcessors(std::vector<Processor*>& processors) {
+    if (!getProfileName().empty())
+      processors.push_back(this);
+
+    auto addProcessor = [&processors](Processor* processor) {
+      ProcessorRouter* router = dynamic_cast<ProcessorRouter*>(processor);
+      if (router)
+        router->getProfiledProcessors(processors);
+      else if (!processor->getProfileName().empty())
+        processors.push_back(processor);
+    };
+
+    for (auto& processor : processors_)
+      addProcessor(processor.second.second.get());
+    for (auto& idle_processor : idle_processors_)
+      addProcessor(idle_processor.second.get());
+  }
+
   ProcessorRouter* ProcessorRouter::getMonoRouter() {
     if (isPolyphonic(this))
       return router_->getMonoRouter();
@@ -61,6 +61,9 @@ namespace vital {
       virtual ProcessorRouter* getPolyRouter();
       virtual void resetFeedbacks(poly_mask reset_mask);
 
+      // Collects this router and every processor below it that has a profile name.
+      virtual void getProfiledProcessors(std::vector<Processor*>& processors);
+
     protected:
       // When we create a cycle into the ProcessorRouter graph, we must insert
       // a Feedback node and add it here.
@@ -90,6 +93,12 @@ namespace vital {
       // Returns the processor for this voice from the globally created one.
       Processor* getLocalProcessor(const Processor* global_processor);
 
+      // Runs a child outside of the processing order, timed like the ones inside it.
+      force_inline void processLocal(Processor* processor, int num_samples) {
+        VITAL_PROFILE_SCOPE(processor);
+        processor->process(num_samples);
+      }
+
       std::shared_ptr<CircularQueue<Processor*>> global_order_;
       std::shared_ptr<CircularQueue<Processor*>> global_reorder_;
       CircularQueue<Processor*> local_order_;
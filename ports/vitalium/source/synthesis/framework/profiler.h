@@ -0,0 +1,82 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#if VITAL_PROFILE
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+  #define VITAL_PROFILE_TSC 1
+  #if defined(_MSC_VER)
+    #include <intrin.h>
+  #else
+    #include <x86intrin.h>
+  #endif
+#else
+  #define VITAL_PROFILE_TSC 0
+  #include <chrono>
+#endif
+#endif
+
+namespace vital {
+
+  // Time spent in one named processor, summed over every voice that runs a copy of it.
+  struct ProfileEntry {
+    std::string name;
+    uint64_t cycles = 0;
+    uint64_t calls = 0;
+    bool polyphonic = false;
+  };
+
+  namespace profiler {
+    constexpr bool kAvailable = VITAL_PROFILE != 0;
+#if VITAL_PROFILE_TSC
+    constexpr char kUnit[] = "cycles";
+#else
+    constexpr char kUnit[] = "ns";
+#endif
+
+    force_inline std::atomic<bool>& enabledFlag() {
+      static std::atomic<bool> enabled(false);
+      return enabled;
+    }
+
+    force_inline bool enabled() {
+      return kAvailable && enabledFlag().load(std::memory_order_relaxed);
+    }
+
+    force_inline void setEnabled(bool enabled) {
+      enabledFlag().store(kAvailable && enabled, std::memory_order_relaxed);
+    }
+
+#if VITAL_PROFILE
+    // Time stamp counter where there is one, the steady clock in nanoseconds everywhere else.
+    force_inline uint64_t cycles() {
+#if VITAL_PROFILE_TSC
+      return __rdtsc();
+#else
+      auto now = std::chrono::steady_clock::now().time_since_epoch();
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+#endif
+    }
+#endif
+  } // namespace profiler
+} // namespace vital
@@ -99,6 +99,15 @@ namespace vital {
       virtual output_map& getMonoModulations();
       virtual output_map& getPolyModulations();
       virtual void correctToTime(double seconds) { }
+
+      // Effects with nonlinear stages ask to run at the oversampled rate, the rest run at the base rate.
+      virtual bool needsOversampling() { return false; }
+
+      // How long an effect needs silent input and output before its state has settled and it can be skipped.
+      virtual mono_float getTailTime() { return 0.0f; }
+
+      // Called in place of processing for skipped blocks so free running modulation keeps its place.
+      virtual void skipSamples(int num_samples) { }
       void enableOwnedProcessors(bool enable);
       virtual void enable(bool enable) override;
       void addMonoProcessor(Processor* processor, bool own = true);
@@ -811,6 +811,12 @@ namespace vital {
     voice_router_.resetFeedbacks(reset_mask);
   }
 
+  void VoiceHandler::getProfiledProcessors(std::vector<Processor*>& processors) {
+    ProcessorRouter::getProfiledProcessors(processors);
+    global_router_.getProfiledProcessors(processors);
+    voice_router_.getProfiledProcessors(processors);
+  }
+
   Output* VoiceHandler::registerOutput(Output* output) {
     VITAL_ASSERT(accumulated_outputs_.count(output) == 0);
     VITAL_ASSERT(last_voice_outputs_.count(output) == 0);
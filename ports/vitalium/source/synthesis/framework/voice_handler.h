@@ -374,6 +374,7 @@ namespace vital {
       void addGlobalProcessor(Processor* processor);
       void removeGlobalProcessor(Processor* processor);
       void resetFeedbacks(poly_mask reset_mask) override;
+      void getProfiledProcessors(std::vector<Processor*>& processors) override;
       Output* registerOutput(Output* output) override;
       Output* registerControlRateOutput(Output* output, bool active);
       Output* registerOutput(Output* output, int index) override;
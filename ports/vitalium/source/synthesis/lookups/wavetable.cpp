@@ -87,6 +87,23 @@ namespace vital {
       std::this_thread::yield(); // Wait for audio thread to finish using old_data.
   }
 
+  void Wavetable::swapState(Wavetable* other) {
+    VITAL_ASSERT(other->active_audio_data_.load() == nullptr);
+    std::swap(name_, other->name_);
+    std::swap(author_, other->author_);
+    std::swap(shepard_table_, other->shepard_table_);
+
+    // The new data gets a version the oscillators have not seen so they reset their buffers.
+    int version = std::max(data_->version, other->data_->version) + 1;
+    data_.swap(other->data_);
+    data_->version = version;
+    other->current_data_ = other->data_.get();
+
+    current_data_ = data_.get();
+    while (active_audio_data_.load())
+      std::this_thread::yield(); // Wait for audio thread to finish using old data.
+  }
+
   void Wavetable::setFrequencyRatio(float frequency_ratio) {
     current_data_->frequency_ratio = frequency_ratio;
   }
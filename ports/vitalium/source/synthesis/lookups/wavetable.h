@@ -53,6 +53,7 @@ namespace vital {
 
       void loadDefaultWavetable();
       void setNumFrames(int num_frames);
+      void swapState(Wavetable* other);
       void setFrequencyRatio(float frequency_ratio);
       void setSampleRate(float rate);
       std::string getName() { return name_; }
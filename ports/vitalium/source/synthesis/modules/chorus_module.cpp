@@ -155,6 +155,11 @@ namespace vital {
     }
   }
 
+  void ChorusModule::skipSamples(int num_samples) {
+    poly_float delta_phase = (frequency_->buffer[0] * num_samples) * (1.0f / getSampleRate());
+    phase_ = utils::mod(phase_ + delta_phase);
+  }
+
   void ChorusModule::correctToTime(double seconds) {
     phase_ = utils::getCycleOffsetFromSeconds(seconds, frequency_->buffer[0]);
   }
@@ -34,6 +34,8 @@ namespace vital {
 
       void processWithInput(const poly_float* audio_in, int num_samples) override;
       void correctToTime(double seconds) override;
+      mono_float getTailTime() override { return kMaxChorusDelay + kMaxChorusModulation; }
+      void skipSamples(int num_samples) override;
       Processor* clone() const override { VITAL_ASSERT(false); return nullptr; }
 
       int getNextNumVoicePairs();
@@ -25,6 +25,9 @@ namespace vital {
 
   class CompressorModule : public SynthModule {
     public:
+      // A few time constants of the slowest release, so the envelopes and meters settle before skipping.
+      static constexpr mono_float kTailTime = 11.0f;
+
       enum {
         kAudio,
         kLowInputMeanSquared,
@@ -44,6 +47,8 @@ namespace vital {
       virtual void processWithInput(const poly_float* audio_in, int num_samples) override;
       virtual void enable(bool enable) override;
       virtual void hardReset() override;
+      virtual bool needsOversampling() override { return true; }
+      virtual mono_float getTailTime() override { return kTailTime; }
       virtual Processor* clone() const override { return new CompressorModule(*this); }
 
     protected:
@@ -32,6 +32,7 @@ namespace vital {
       virtual void init() override;
       virtual void setSampleRate(int sample_rate) override;
       virtual void processWithInput(const poly_float* audio_in, int num_samples) override;
+      virtual bool needsOversampling() override { return true; }
       virtual Processor* clone() const override { return new DistortionModule(*this); }
 
     protected:
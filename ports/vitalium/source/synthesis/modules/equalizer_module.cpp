@@ -141,6 +141,20 @@ namespace vital {
     high_shelf_->setSampleRate(sample_rate);
   }
 
+  bool EqualizerModule::needsOversampling() {
+    // Audio rate modulation of the cutoffs arrives at the oversampled rate.
+    for (auto& destination : data_->mono_mod_destinations) {
+      Processor* total = destination.second;
+      const Processor* base_value = data_->controls[destination.first];
+      for (int i = 0; i < total->numInputs(); ++i) {
+        const Processor* source = total->input(i)->source->owner;
+        if (source && source != base_value && !source->isControlRate())
+          return true;
+      }
+    }
+    return false;
+  }
+
   void EqualizerModule::processWithInput(const poly_float* audio_in, int num_samples) {
     SynthModule::process(num_samples);
 
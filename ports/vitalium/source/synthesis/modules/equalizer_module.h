@@ -32,6 +32,7 @@ namespace vital {
 
       void setSampleRate(int sample_rate) override;
       void processWithInput(const poly_float* audio_in, int num_samples) override;
+      bool needsOversampling() override;
       Processor* clone() const override { return new EqualizerModule(*this); }
 
       const StereoMemory* getAudioMemory() { return audio_memory_.get(); }
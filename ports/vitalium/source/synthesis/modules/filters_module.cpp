@@ -28,6 +28,7 @@ namespace vital {
   void FiltersModule::init() {
     filter_1_filter_input_ = createBaseControl("filter_1_filter_input");
     filter_1_ = new FilterModule("filter_1");
+    filter_1_->setProfileName("filter_1");
     addSubmodule(filter_1_);
     addProcessor(filter_1_);
 
@@ -38,6 +39,7 @@ namespace vital {
 
     filter_2_filter_input_ = createBaseControl("filter_2_filter_input");
     filter_2_ = new FilterModule("filter_2");
+    filter_2_->setProfileName("filter_2");
     addSubmodule(filter_2_);
     addProcessor(filter_2_);
 
@@ -53,8 +55,8 @@ namespace vital {
     filter_1_input_->buffer = input(kFilter1Input)->source->buffer;
     filter_2_input_->buffer = input(kFilter2Input)->source->buffer;
 
-    getLocalProcessor(filter_1_)->process(num_samples);
-    getLocalProcessor(filter_2_)->process(num_samples);
+    processLocal(getLocalProcessor(filter_1_), num_samples);
+    processLocal(getLocalProcessor(filter_2_), num_samples);
 
     poly_float* output_buffer = output()->buffer;
     const poly_float* filter_1_buffer = filter_1_->output()->buffer;
@@ -68,7 +70,7 @@ namespace vital {
     filter_1_input_->buffer = input(kFilter1Input)->source->buffer;
     filter_2_input_->buffer = filter_2_input_->owned_buffer.get();
 
-    getLocalProcessor(filter_1_)->process(num_samples);
+    processLocal(getLocalProcessor(filter_1_), num_samples);
 
     poly_float* filter_2_input_buffer = filter_2_input_->buffer;
     const poly_float* filter_1_output_buffer = filter_1_->output()->buffer;
@@ -77,7 +79,7 @@ namespace vital {
     for (int i = 0; i < num_samples; ++i)
       filter_2_input_buffer[i] = filter_1_output_buffer[i] + filter_2_straight_input[i];
 
-    getLocalProcessor(filter_2_)->process(num_samples);
+    processLocal(getLocalProcessor(filter_2_), num_samples);
     utils::copyBuffer(output()->buffer, filter_2_->output()->buffer, num_samples);
   }
 
@@ -85,7 +87,7 @@ namespace vital {
     filter_1_input_->buffer = filter_1_input_->owned_buffer.get();
     filter_2_input_->buffer = input(kFilter2Input)->source->buffer;
 
-    getLocalProcessor(filter_2_)->process(num_samples);
+    processLocal(getLocalProcessor(filter_2_), num_samples);
 
     poly_float* filter_1_input_buffer = filter_1_input_->buffer;
     const poly_float* filter_2_output_buffer = filter_2_->output()->buffer;
@@ -94,7 +96,7 @@ namespace vital {
     for (int i = 0; i < num_samples; ++i)
       filter_1_input_buffer[i] = filter_2_output_buffer[i] + filter_1_straight_input[i];
 
-    getLocalProcessor(filter_1_)->process(num_samples);
+    processLocal(getLocalProcessor(filter_1_), num_samples);
     utils::copyBuffer(output()->buffer, filter_1_->output()->buffer, num_samples);
   }
 
@@ -77,6 +77,11 @@ namespace vital {
     delay_->processWithInput(audio_in, num_samples);
   }
 
+  void FlangerModule::skipSamples(int num_samples) {
+    poly_float delta_phase = (frequency_->buffer[0] * num_samples) / getSampleRate();
+    phase_ = utils::mod(phase_ + delta_phase);
+  }
+
   void FlangerModule::correctToTime(double seconds) {
     phase_ = utils::getCycleOffsetFromSeconds(seconds, frequency_->buffer[0]);
   }
@@ -20,12 +20,14 @@
 namespace vital {
 
   ModulationConnectionProcessor::ModulationConnectionProcessor(int index) :
-      SynthModule(kNumInputs, kNumOutputs), index_(index), polyphonic_(true), current_value_(nullptr),
+      SynthModule(kNumInputs, kNumOutputs), index_(index), current_value_(nullptr),
       bipolar_(nullptr), stereo_(nullptr) {
     setControlRate(true);
 
     modulation_amount_ = 0.0f;
 
+    polyphonic_ = std::make_shared<bool>(true);
+    modulation_term_ = std::make_shared<ModulationTerm>();
     destination_scale_ = std::make_shared<mono_float>();
     *destination_scale_ = 0.0f;
     last_destination_scale_ = 0.0f;
@@ -66,7 +68,7 @@ namespace vital {
 
   void ModulationConnectionProcessor::processAudioRate(int num_samples, const Output* source) {
     if (bypass_->value()) {
-      output(kModulationOutput)->clearBuffer();
+      modulation_term_->mode = ModulationTerm::kInactive;
       output(kModulationOutput)->trigger_value = 0.0f;
       return;
     }
@@ -75,18 +77,45 @@ namespace vital {
     bool using_power = (poly_float::notEqual(0.0f, power) | poly_float::notEqual(0.0f, power_)).anyMask();
     bool using_map = !map_generator_->linear();
 
+    // Poly destinations compute linear modulation themselves, the rest is rendered here. Mono destinations
+    // read the rendered buffer after the voice handler keeps the last active voice in it.
+    modulation_term_->mode = ModulationTerm::kRendered;
     if (using_power && using_map)
       processAudioRateRemappedAndMorphed(num_samples, source, power);
     else if (using_power)
       processAudioRateMorphed(num_samples, source, power);
     else if (using_map)
       processAudioRateRemapped(num_samples, source);
+    else if (*polyphonic_)
+      prepareAudioRateLinear(num_samples, source);
     else
       processAudioRateLinear(num_samples, source);
 
     power_ = power;
   }
 
+  void ModulationConnectionProcessor::prepareAudioRateLinear(int num_samples, const Output* source) {
+    const poly_float* modulation_source = source->buffer;
+
+    poly_float bipolar_offset = -bipolar_->value() * 0.5f;
+    poly_float current_amount = modulation_amount_;
+    poly_float stereo_scale = poly_float(1.0f) - (constants::kRightOne * 2.0f * stereo_->value());
+    poly_float modulation_amount = utils::clamp(input(kModulationAmount)->at(0), -1.0f, 1.0f) * stereo_scale;
+    modulation_amount_ = modulation_amount * (*destination_scale_);
+    current_amount = utils::maskLoad(current_amount, modulation_amount_, getResetMask(kReset));
+    poly_float delta_amount = (modulation_amount_ - current_amount) * (1.0f / num_samples);
+
+    bool silent = !(poly_float::notEqual(0.0f, current_amount) | poly_float::notEqual(0.0f, modulation_amount_)).anyMask();
+    modulation_term_->mode = silent ? ModulationTerm::kInactive : ModulationTerm::kLinear;
+    modulation_term_->source = modulation_source;
+    modulation_term_->offset = bipolar_offset;
+    modulation_term_->amount = current_amount;
+    modulation_term_->delta_amount = delta_amount;
+
+    output(kModulationPreScale)->buffer[0] = (modulation_source[0] + bipolar_offset) * modulation_amount;
+    output(kModulationOutput)->trigger_value = (modulation_source[0] + bipolar_offset) * (current_amount + delta_amount);
+  }
+
   void ModulationConnectionProcessor::processAudioRateLinear(int num_samples, const Output* source) {
     poly_float* dest = output(kModulationOutput)->buffer;
     const poly_float* modulation_source = source->buffer;
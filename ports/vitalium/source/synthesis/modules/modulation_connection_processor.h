@@ -44,6 +44,7 @@ namespace vital {
       void init() override;
       void process(int num_samples) override;
       void processAudioRate(int num_samples, const Output* source);
+      void prepareAudioRateLinear(int num_samples, const Output* source);
       void processAudioRateLinear(int num_samples, const Output* source);
       void processAudioRateRemapped(int num_samples, const Output* source);
       void processAudioRateMorphed(int num_samples, const Output* source, poly_float power);
@@ -51,6 +52,7 @@ namespace vital {
       void processControlRate(const Output* source);
 
       virtual Processor* clone() const override { return new ModulationConnectionProcessor(*this); }
+      virtual const ModulationTerm* getModulationTerm() const override { return modulation_term_.get(); }
 
       void initializeBaseValue(Value* base_value) { current_value_ = base_value; }
       void initializeMapping() { map_generator_->initLinear(); }
@@ -58,8 +60,8 @@ namespace vital {
       mono_float currentBaseValue() const { return current_value_->value(); }
       void setBaseValue(mono_float value) { current_value_->set(value); }
 
-      bool isPolyphonicModulation() const { return polyphonic_; }
-      void setPolyphonicModulation(bool polyphonic) { polyphonic_ = polyphonic; }
+      bool isPolyphonicModulation() const { return *polyphonic_; }
+      void setPolyphonicModulation(bool polyphonic) { *polyphonic_ = polyphonic; }
       bool isBipolar() const { return bipolar_->value() != 0.0f; }
       void setBipolar(bool bipolar) { bipolar_->set(bipolar ? 1.0f : 0.0f); }
       bool isStereo() const { return stereo_->value() != 0.0f; }
@@ -72,7 +74,7 @@ namespace vital {
 
     protected:
       int index_;
-      bool polyphonic_;
+      std::shared_ptr<bool> polyphonic_;
       Value* current_value_;
       Value* bipolar_;
       Value* stereo_;
@@ -82,6 +84,7 @@ namespace vital {
       poly_float modulation_amount_;
 
       std::shared_ptr<mono_float> destination_scale_;
+      std::shared_ptr<ModulationTerm> modulation_term_;
       mono_float last_destination_scale_;
       std::shared_ptr<LineGenerator> map_generator_;
 
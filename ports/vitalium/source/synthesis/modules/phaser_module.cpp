@@ -70,6 +70,10 @@ namespace vital {
     phaser_->correctToTime(seconds);
   }
 
+  void PhaserModule::skipSamples(int num_samples) {
+    phaser_->skipSamples(num_samples);
+  }
+
   void PhaserModule::setSampleRate(int sample_rate) {
     SynthModule::setSampleRate(sample_rate);
     phaser_->setSampleRate(sample_rate);
@@ -41,6 +41,8 @@ namespace vital {
       void correctToTime(double seconds) override;
       void setSampleRate(int sample_rate) override;
       void processWithInput(const poly_float* audio_in, int num_samples) override;
+      bool needsOversampling() override { return true; }
+      void skipSamples(int num_samples) override;
       Processor* clone() const override { return new PhaserModule(*this); }
 
     protected:
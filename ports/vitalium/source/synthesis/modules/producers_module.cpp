@@ -23,6 +23,7 @@ namespace vital {
     for (int i = 0; i < kNumOscillators; ++i) {
       std::string number = std::to_string(i + 1);
       oscillators_[i] = new OscillatorModule("osc_" + number);
+      oscillators_[i]->setProfileName("osc_" + number);
       addSubmodule(oscillators_[i]);
       addProcessor(oscillators_[i]);
       oscillators_[i]->enable(false);
@@ -30,6 +31,7 @@ namespace vital {
     }
 
     sampler_ = new SampleModule();
+    sampler_->setProfileName("sample");
     addSubmodule(sampler_);
     addProcessor(sampler_);
     sampler_->enable(false);
@@ -64,7 +66,7 @@ namespace vital {
   void ProducersModule::process(int num_samples) {
     SynthModule::process(num_samples);
 
-    getLocalProcessor(sampler_)->process(num_samples);
+    processLocal(getLocalProcessor(sampler_), num_samples);
 
     SynthOscillator::DistortionType distortion_types[kNumOscillators];
     bool processed[kNumOscillators];
@@ -84,7 +86,7 @@ namespace vital {
           !processed[index]) {
         num_processed++;
         processed[index] = true;
-        getLocalProcessor(module)->process(num_samples);
+        processLocal(getLocalProcessor(module), num_samples);
       }
       index = (index + 1) % kNumOscillators;
     }
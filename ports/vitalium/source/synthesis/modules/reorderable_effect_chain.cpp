@@ -18,6 +18,7 @@
 
 #include "chorus_module.h"
 #include "compressor_module.h"
+#include "decimator.h"
 #include "delay_module.h"
 #include "distortion_module.h"
 #include "equalizer_module.h"
@@ -26,6 +27,7 @@
 #include "phaser_module.h"
 #include "reverb_module.h"
 #include "synth_strings.h"
+#include "upsampler.h"
 
 namespace vital {
 
@@ -58,6 +60,8 @@ namespace vital {
         SynthModule::setOversampleAmount(oversampling);
       }
 
+      bool needsOversampling() override { return true; }
+
     private:
       FilterModule* filter_;
       Output input_;
@@ -65,16 +69,36 @@ namespace vital {
 
   ReorderableEffectChain::ReorderableEffectChain(const Output* beats_per_second, const Output* keytrack) :
       vital::SynthModule(kNumInputs, 1), equalizer_memory_(nullptr),
-      beats_per_second_(beats_per_second), keytrack_(keytrack), last_order_(0.0f) {
+      beats_per_second_(beats_per_second), keytrack_(keytrack), last_order_(0.0f), idle_(false) {
+    // Every effect has its own resamplers in front of it so their state follows one signal,
+    // and the last upsampler brings the output back to the oversampled rate.
+    // The decimators take their number of stages from the rate of the chain.
+    oversampled_audio_ = std::make_shared<Output>();
+    oversampled_audio_->owner = this;
+    for (int i = 0; i <= constants::kNumEffects; ++i) {
+      upsamplers_[i] = new Upsampler();
+      upsamplers_[i]->setProfileName("upsampler");
+      addIdleProcessor(upsamplers_[i]);
+    }
+
+    for (int i = 0; i < constants::kNumEffects; ++i) {
+      decimators_[i] = new Decimator(3);
+      decimators_[i]->setProfileName("decimator");
+      decimators_[i]->plug(oversampled_audio_.get());
+      addIdleProcessor(decimators_[i]);
+    }
+
     for (int i = 0; i < constants::kNumEffects; ++i) {
       SynthModule* effect_module = createEffectModule(i);
       VITAL_ASSERT(effect_module);
 
       addSubmodule(effect_module);
       addProcessor(effect_module);
+      effect_module->setProfileName(strings::kEffectOrder[i]);
       effects_on_[i] = createBaseControl(strings::kEffectOrder[i] + "_on");
       effects_[i] = effect_module;
       effect_order_[i] = i;
+      silent_samples_[i] = 0;
     }
 
     last_order_ = utils::encodeOrderToFloat(effect_order_, constants::kNumEffects);
@@ -108,6 +132,13 @@ namespace vital {
     }
   }
 
+  void ReorderableEffectChain::init() {
+    for (int i = 0; i < constants::kNumEffects; ++i)
+      decimators_[i]->init();
+
+    SynthModule::init();
+  }
+
   void ReorderableEffectChain::process(int num_samples) {
     const poly_float* audio_in = input(kAudio)->source->buffer;
     processWithInput(audio_in, num_samples);
@@ -119,28 +150,110 @@ namespace vital {
       utils::decodeFloatToOrder(effect_order_, float_order, constants::kNumEffects);
     last_order_ = float_order;
 
+    // Effects run at the rate they ask for, resampling only where neighbouring effects disagree.
+    int oversample = getOversampleAmount();
+    int base_samples = num_samples / oversample;
+    bool oversampled = true;
+    bool idle = utils::isSilent(audio_in, num_samples);
+
     for (int i = 0; i < constants::kNumEffects; ++i) {
-      VITAL_ASSERT(utils::isFinite(audio_in, num_samples));
+      VITAL_ASSERT(utils::isFinite(audio_in, oversampled ? num_samples : base_samples));
 
       int index = effect_order_[i];
       bool on = effects_on_[index]->value();
       bool enabled = effects_[index]->enabled();
-      if (on != enabled)
+      if (on != enabled) {
         effects_[index]->enable(on);
+        silent_samples_[index] = 0;
+      }
 
       if (on) {
-        effects_[index]->processWithInput(audio_in, num_samples);
+        // Once an effect has had silent input and output for longer than its tail it has nothing left
+        // to play, so the silence passes straight through until new audio arrives.
+        bool input_silent = utils::isSilent(audio_in, oversampled ? num_samples : base_samples);
+        int tail_samples = effects_[index]->getTailTime() * getSampleRate() / oversample;
+        if (input_silent && silent_samples_[index] > tail_samples) {
+          effects_[index]->skipSamples(base_samples * effects_[index]->getOversampleAmount());
+          continue;
+        }
+
+        idle = false;
+        updateEffectOversampling(index);
+        bool effect_oversampled = effects_[index]->getOversampleAmount() == oversample;
+
+        if (effect_oversampled && !oversampled) {
+          VITAL_PROFILE_SCOPE(upsamplers_[index]);
+          upsamplers_[index]->processWithInput(audio_in, base_samples);
+          audio_in = upsamplers_[index]->output()->buffer;
+        }
+        else if (!effect_oversampled && oversampled) {
+          utils::copyBuffer(oversampled_audio_->buffer, audio_in, num_samples);
+          VITAL_PROFILE_SCOPE(decimators_[index]);
+          decimators_[index]->process(base_samples);
+          audio_in = decimators_[index]->output()->buffer;
+        }
+        oversampled = effect_oversampled;
+
+        int effect_samples = oversampled ? num_samples : base_samples;
+        {
+          VITAL_PROFILE_SCOPE(effects_[index]);
+          effects_[index]->processWithInput(audio_in, effect_samples);
+        }
         audio_in = effects_[index]->output(0)->buffer;
+
+        if (input_silent && utils::isSilent(audio_in, effect_samples))
+          silent_samples_[index] += base_samples;
+        else
+          silent_samples_[index] = 0;
       }
     }
 
-    VITAL_ASSERT(utils::isFinite(audio_in, num_samples));
-    utils::copyBuffer(output()->buffer, audio_in, num_samples);
+    idle_ = idle;
+
+    if (oversampled) {
+      VITAL_ASSERT(utils::isFinite(audio_in, num_samples));
+      utils::copyBuffer(output()->buffer, audio_in, num_samples);
+    }
+    else {
+      VITAL_ASSERT(utils::isFinite(audio_in, base_samples));
+      Upsampler* upsampler = upsamplers_[constants::kNumEffects];
+      VITAL_PROFILE_SCOPE(upsampler);
+      upsampler->processWithInput(audio_in, base_samples);
+      utils::copyBuffer(output()->buffer, upsampler->output()->buffer, num_samples);
+    }
   }
 
-  void ReorderableEffectChain::hardReset() {
+  void ReorderableEffectChain::setSampleRate(int sample_rate) {
+    SynthModule::setSampleRate(sample_rate);
     for (int i = 0; i < constants::kNumEffects; ++i)
+      decimators_[i]->setSampleRate(sample_rate);
+  }
+
+  void ReorderableEffectChain::setOversampleAmount(int oversample) {
+    SynthModule::setOversampleAmount(oversample);
+    oversampled_audio_->ensureBufferSize(kMaxBufferSize * oversample);
+
+    // Buffers are now sized for the oversampled rate, so effects can move between rates without allocating.
+    for (int i = 0; i < constants::kNumEffects; ++i)
+      updateEffectOversampling(i);
+  }
+
+  void ReorderableEffectChain::updateEffectOversampling(int index) {
+    int oversample = effects_[index]->needsOversampling() ? getOversampleAmount() : 1;
+    if (effects_[index]->getOversampleAmount() != oversample)
+      effects_[index]->setOversampleAmount(oversample);
+  }
+
+  void ReorderableEffectChain::hardReset() {
+    for (int i = 0; i < constants::kNumEffects; ++i) {
       effects_[i]->hardReset();
+      silent_samples_[i] = 0;
+    }
+
+    for (int i = 0; i <= constants::kNumEffects; ++i)
+      upsamplers_[i]->reset(constants::kFullMask);
+    for (int i = 0; i < constants::kNumEffects; ++i)
+      decimators_[i]->reset(constants::kFullMask);
   }
 
   void ReorderableEffectChain::correctToTime(double seconds) {
@@ -22,7 +22,9 @@
 
 namespace vital {
 
+  class Decimator;
   class StereoMemory;
+  class Upsampler;
 
   class ReorderableEffectChain : public SynthModule {
     public:
@@ -34,26 +36,37 @@ namespace vital {
 
       ReorderableEffectChain(const Output* beats_per_second, const Output* keytrack);
 
+      virtual void init() override;
       virtual void process(int num_samples) override;
       virtual void hardReset() override;
       virtual void processWithInput(const poly_float* audio_in, int num_samples) override;
       virtual Processor* clone() const override { return new ReorderableEffectChain(*this); }
 
+      virtual void setSampleRate(int sample_rate) override;
+      virtual void setOversampleAmount(int oversample) override;
+
       virtual void correctToTime(double seconds) override;
 
       SynthModule* getEffect(constants::Effect effect) { return effects_[effect]; }
       const StereoMemory* getEqualizerMemory() { return equalizer_memory_; }
+      bool isIdle() const { return idle_; }
 
     protected:
       SynthModule* createEffectModule(int index);
+      void updateEffectOversampling(int index);
 
       const StereoMemory* equalizer_memory_;
+      Upsampler* upsamplers_[constants::kNumEffects + 1];
+      Decimator* decimators_[constants::kNumEffects];
+      std::shared_ptr<Output> oversampled_audio_;
       const Output* beats_per_second_;
       const Output* keytrack_;
       SynthModule* effects_[constants::kNumEffects];
       Value* effects_on_[constants::kNumEffects];
       int effect_order_[constants::kNumEffects];
+      int silent_samples_[constants::kNumEffects];
       float last_order_;
+      bool idle_;
 
       JUCE_LEAK_DETECTOR(ReorderableEffectChain)
   };
@@ -25,6 +25,9 @@ namespace vital {
 
   class ReverbModule : public SynthModule {
     public:
+      // Longest path through the pre-delay, the feedback network at its largest size and the allpasses.
+      static constexpr mono_float kTailTime = 1.5f;
+
       ReverbModule();
       virtual ~ReverbModule();
 
@@ -34,6 +37,7 @@ namespace vital {
 
       void setSampleRate(int sample_rate) override;
       void processWithInput(const poly_float* audio_in, int num_samples) override;
+      mono_float getTailTime() override { return kTailTime; }
       Processor* clone() const override { return new ReverbModule(*this); }
 
     protected:
@@ -80,6 +80,7 @@ namespace vital {
       ModulationConnectionProcessor* processor = modulation_bank_.atIndex(i)->modulation_processor.get();
 
       processor->plug(reset(), ModulationConnectionProcessor::kReset);
+      processor->setProfileName("modulations");
 
       std::string number = std::to_string(i + 1);
       std::string amount_name = "modulation_" + number + "_amount";
@@ -156,6 +157,7 @@ namespace vital {
       lfo_sources_[i].initTriangle();
       std::string prefix = std::string("lfo_") + std::to_string(i + 1);
       LfoModule* lfo = new LfoModule(prefix, &lfo_sources_[i], beats_per_second_);
+      lfo->setProfileName(prefix);
       addSubmodule(lfo);
       addProcessor(lfo);
       lfos_[i] = lfo;
@@ -173,6 +175,7 @@ namespace vital {
       std::string prefix = std::string("env_") + std::to_string(i + 1);
       EnvelopeModule* envelope = new EnvelopeModule(prefix, i == 0);
       envelope->plug(retrigger(), EnvelopeModule::kTrigger);
+      envelope->setProfileName(prefix);
       addSubmodule(envelope);
       addProcessor(envelope);
       envelopes_[i] = envelope;
@@ -190,6 +193,7 @@ namespace vital {
       std::string name = "random_" + std::to_string(i + 1);
       random_lfos_[i] = new RandomLfoModule(name, beats_per_second_);
       random_lfos_[i]->plug(retrigger(), RandomLfoModule::kNoteTrigger);
+      random_lfos_[i]->setProfileName(name);
       random_lfos_[i]->plug(bent_midi_, RandomLfoModule::kMidi);
       addSubmodule(random_lfos_[i]);
       addProcessor(random_lfos_[i]);
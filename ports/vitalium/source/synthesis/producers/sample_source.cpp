@@ -15,11 +15,28 @@
  */
 
 #include "sample_source.h"
+#include "binary_state.h"
 #include "futils.h"
 #include "synth_constants.h"
 
 #include <thread>
 
+namespace {
+  json encodePcm(const vital::mono_float* buffer, int length) {
+    std::unique_ptr<int16_t[]> pcm_data = std::make_unique<int16_t[]>(length);
+    vital::utils::floatToPcmData(pcm_data.get(), buffer, length);
+    return BinaryState::encodeBlob(pcm_data.get(), sizeof(int16_t) * length);
+  }
+
+  std::unique_ptr<vital::mono_float[]> decodePcm(const json& encoded, int length) {
+    MemoryBlock decoded = BinaryState::decodeBlob(encoded);
+    decoded.ensureSize(length * sizeof(int16_t), true);
+    std::unique_ptr<vital::mono_float[]> buffer = std::make_unique<vital::mono_float[]>(length);
+    vital::utils::pcmToFloatData(buffer.get(), static_cast<const int16_t*>(decoded.getData()), length);
+    return buffer;
+  }
+} // namespace
+
 namespace vital {
 
   namespace {
@@ -196,6 +213,102 @@ namespace vital {
         dest[i] = getFilteredLoopSample(original, 2 * i, original_size);
     }
 
+    force_inline int floorHalf(int value) {
+      return value >= 0 ? value / 2 : -((1 - value) / 2);
+    }
+
+    // Playback indices go past where floats count whole samples, so they're kept as ints and split
+    // here. The high part is a multiple of every octave's step, so both halves scale exactly.
+    constexpr int kIndexSplitBits = 24;
+    constexpr uint32_t kIndexLowMask = (1 << kIndexSplitBits) - 1;
+
+    force_inline poly_mask isNegative(poly_int value) {
+      return poly_int::greaterThan(value, poly_int::kNotSignMask);
+    }
+
+    force_inline poly_mask greaterThanOrEqual(poly_int one, poly_int two) {
+      poly_int sign = poly_int::kSignMask;
+      return ~poly_int::greaterThan(two ^ sign, one ^ sign);
+    }
+
+    // Streams one octave into the next one down with the same filter as downsample(), keeping the
+    // start of it and passing the rest on. Chained per octave so a single read builds all of them.
+    class OctaveDecimator {
+      public:
+        OctaveDecimator() : destination_(nullptr), num_kept_(0), num_outputs_(0), next_(nullptr),
+                            input_start_(0), output_index_(0) { }
+
+        void init(mono_float* destination, int num_kept, int num_outputs, OctaveDecimator* next) {
+          destination_ = destination;
+          num_kept_ = num_kept;
+          num_outputs_ = num_outputs;
+          next_ = next;
+          input_start_ = -kRadius;
+          input_.assign(kRadius, 0.0f);
+        }
+
+        bool done() const { return output_index_ >= num_outputs_; }
+
+        void push(const mono_float* samples, int num_samples) {
+          if (done())
+            return;
+
+          input_.insert(input_.end(), samples, samples + num_samples);
+          render();
+        }
+
+        void finish() {
+          if (!done()) {
+            input_.insert(input_.end(), kRadius, 0.0f);
+            render();
+          }
+          if (next_)
+            next_->finish();
+        }
+
+      private:
+        static constexpr int kRadius = SampleSource::kNumDownsampleTaps / 2;
+
+        void render() {
+          int input_end = input_start_ + static_cast<int>(input_.size());
+          output_.clear();
+          for (; output_index_ < num_outputs_ && 2 * output_index_ + kRadius < input_end; ++output_index_) {
+            const mono_float* taps = input_.data() + 2 * output_index_ - kRadius - input_start_;
+            mono_float total = 0.0f;
+            for (int t = 0; t < SampleSource::kNumDownsampleTaps; ++t)
+              total += kDownsampleCoefficients[t] * taps[t];
+
+            if (output_index_ < num_kept_)
+              destination_[output_index_] = total;
+            output_.push_back(total);
+          }
+
+          int consumed = 2 * output_index_ - kRadius - input_start_;
+          input_.erase(input_.begin(), input_.begin() + consumed);
+          input_start_ += consumed;
+
+          if (next_ && !output_.empty())
+            next_->push(output_.data(), static_cast<int>(output_.size()));
+        }
+
+        mono_float* destination_;
+        int num_kept_;
+        int num_outputs_;
+        OctaveDecimator* next_;
+        std::vector<mono_float> input_;
+        std::vector<mono_float> output_;
+        int input_start_;
+        int output_index_;
+    };
+
+    struct BufferSet {
+      force_inline matrix getValueMatrix(poly_int indices) {
+        return utils::getValueMatrix(buffers, indices);
+      }
+
+      const mono_float* buffers[poly_float::kSize];
+    };
+
     void createBandLimitedBuffers(std::vector<std::unique_ptr<mono_float[]>>& destination,
                                   std::vector<std::unique_ptr<mono_float[]>>& loop_destination,
                                   const mono_float* buffer, int size) {
@@ -263,34 +376,74 @@ namespace vital {
     }
   }
 
+  Sample::SampleData::~SampleData() { }
+
   Sample::Sample() : name_(kDefaultName), current_data_(nullptr), active_audio_data_(nullptr) {
     init();
   }
 
   void Sample::loadSample(const mono_float* buffer, int size, int sample_rate) {
-    static constexpr int kMaxSize = 1764000;
-
     VITAL_ASSERT(active_audio_data_.is_lock_free());
 
-    size = std::min(size, kMaxSize);
+    size = std::min(size, kMaxMemoryLength);
+    std::unique_ptr<SampleData> data = std::make_unique<SampleData>(size, sample_rate, false);
+    createBandLimitedBuffers(data->left_buffers, data->left_loop_buffers, buffer, size);
+    data->num_octaves = static_cast<int>(data->left_buffers.size());
+    setData(std::move(data));
+  }
+
+  void Sample::loadSample(const mono_float* left_buffer, const mono_float* right_buffer, int size, int sample_rate) {
+    std::unique_ptr<SampleData> data = std::make_unique<SampleData>(size, sample_rate, true);
+    createBandLimitedBuffers(data->left_buffers, data->left_loop_buffers, left_buffer, size);
+    createBandLimitedBuffers(data->right_buffers, data->right_loop_buffers, right_buffer, size);
+    data->num_octaves = static_cast<int>(data->left_buffers.size());
+    setData(std::move(data));
+  }
+
+  bool Sample::loadStreamedSample(const File& file) {
+    std::unique_ptr<SampleStream> stream = SampleStream::open(file);
+    if (stream == nullptr)
+      return false;
+
+    std::unique_ptr<SampleData> data = std::make_unique<SampleData>(stream->length(), stream->sampleRate(),
+                                                                    stream->stereo());
+    data->num_octaves = stream->numOctaves();
+    data->stream = std::move(stream);
+    data->stream->startThread();
+    setData(std::move(data));
+    return true;
+  }
+
+  void Sample::setData(std::unique_ptr<SampleData> data) {
     std::unique_ptr<SampleData> old_data = std::move(data_);
-    data_ = std::make_unique<SampleData>(size, sample_rate, false);
-    createBandLimitedBuffers(data_->left_buffers, data_->left_loop_buffers, buffer, size);
+    data_ = std::move(data);
 
     current_data_ = data_.get();
     while (active_audio_data_.load())
       std::this_thread::yield(); // Wait for audio thread to finish using old_data.
   }
 
-  void Sample::loadSample(const mono_float* left_buffer, const mono_float* right_buffer, int size, int sample_rate) {
-    std::unique_ptr<SampleData> old_data = std::move(data_);
-    data_ = std::make_unique<SampleData>(size, sample_rate, true);
-    createBandLimitedBuffers(data_->left_buffers, data_->left_loop_buffers, left_buffer, size);
-    createBandLimitedBuffers(data_->right_buffers, data_->right_loop_buffers, right_buffer, size);
+  void Sample::swapState(Sample* other) {
+    VITAL_ASSERT(other->active_audio_data_.load() == nullptr);
+    std::swap(name_, other->name_);
+    data_.swap(other->data_);
+    other->current_data_ = other->data_.get();
 
     current_data_ = data_.get();
     while (active_audio_data_.load())
-      std::this_thread::yield(); // Wait for audio thread to finish using old_data.
+      std::this_thread::yield(); // Wait for audio thread to finish using old data.
+  }
+
+  const mono_float* Sample::overview() const {
+    if (current_data_->stream)
+      return current_data_->stream->overview();
+    return buffer();
+  }
+
+  int Sample::overviewLength() const {
+    if (current_data_->stream)
+      return current_data_->stream->overviewLength();
+    return originalLength();
   }
 
   void Sample::init() {
@@ -309,49 +462,490 @@ namespace vital {
     data["name"] = name_;
     data["length"] = data_->length;
     data["sample_rate"] = data_->sample_rate;
-    std::unique_ptr<int16_t[]> pcm_data = std::make_unique<int16_t[]>(data_->length);
-    utils::floatToPcmData(pcm_data.get(), data_->left_buffers[kUpsampleTimes].get(), data_->length);
-    String encoded = Base64::toBase64(pcm_data.get(), sizeof(int16_t) * data_->length);
-    data["samples"] = encoded.toStdString();
-    if (data_->stereo) {
-      utils::floatToPcmData(pcm_data.get(), data_->right_buffers[kUpsampleTimes].get(), data_->length);
-      String encoded_stereo = Base64::toBase64(pcm_data.get(), sizeof(int16_t) * data_->length);
-      data["samples_stereo"] = encoded_stereo.toStdString();
+    if (data_->stream) {
+      File file = data_->stream->getFile();
+      data["file"] = file.getFullPathName().toStdString();
+      embedFileStart(data, file);
+      return data;
     }
+
+    data["samples"] = encodePcm(data_->left_buffers[kUpsampleTimes].get(), data_->length);
+    if (data_->stereo)
+      data["samples_stereo"] = encodePcm(data_->right_buffers[kUpsampleTimes].get(), data_->length);
     return data;
   }
 
-  void Sample::jsonToState(json data) {
-    name_ = "";
-    if (data.count("name"))
-      name_ = data["name"].get<std::string>();
+  // Saves the first kMaxMemoryLength samples of a streamed file, where long samples used to be cut
+  // off, so the state still plays something close on a machine without the file. "length" is the
+  // embedded length, which is what older versions expect next to "samples".
+  void Sample::embedFileStart(json& data, const File& file) {
+    AudioFormatManager format_manager;
+    format_manager.registerBasicFormats();
+    std::unique_ptr<AudioFormatReader> reader(format_manager.createReaderFor(file));
+    if (reader == nullptr)
+      return;
+
+    int length = static_cast<int>(std::min<int64>(reader->lengthInSamples, kMaxMemoryLength));
+    if (length <= 0)
+      return;
+
+    bool stereo = reader->numChannels > 1;
+    AudioSampleBuffer buffer(stereo ? 2 : 1, length);
+    reader->read(&buffer, 0, length, 0, true, true);
+
+    data["length"] = length;
+    data["samples"] = encodePcm(buffer.getReadPointer(0), length);
+    if (stereo)
+      data["samples_stereo"] = encodePcm(buffer.getReadPointer(1), length);
+  }
 
+  void Sample::loadEmbedded(const json& data) {
     int length = data["length"];
     int sample_rate = data["sample_rate"];
 
-    MemoryOutputStream decoded(length * sizeof(int16_t));
-    std::string wave_data = data["samples"];
-    Base64::convertFromBase64(decoded, wave_data);
-    std::unique_ptr<int16_t[]> pcm_data = std::make_unique<int16_t[]>(length);
-    memcpy(pcm_data.get(), decoded.getData(), length * sizeof(int16_t));
-    std::unique_ptr<mono_float[]> buffer = std::make_unique<mono_float[]>(length);
-    utils::pcmToFloatData(buffer.get(), pcm_data.get(), length);
-
+    std::unique_ptr<mono_float[]> buffer = decodePcm(data["samples"], length);
     if (data.count("samples_stereo")) {
-      MemoryOutputStream decoded_stereo(length * sizeof(int16_t));
-      std::string wave_data_stereo = data["samples_stereo"];
-      Base64::convertFromBase64(decoded_stereo, wave_data_stereo);
-      std::unique_ptr<int16_t[]> pcm_data_stereo = std::make_unique<int16_t[]>(length);
-      memcpy(pcm_data_stereo.get(), decoded_stereo.getData(), length * sizeof(int16_t));
-
-      std::unique_ptr<mono_float[]> buffer_stereo = std::make_unique<mono_float[]>(length);
-      utils::pcmToFloatData(buffer_stereo.get(), pcm_data_stereo.get(), length);
+      std::unique_ptr<mono_float[]> buffer_stereo = decodePcm(data["samples_stereo"], length);
       loadSample(buffer.get(), buffer_stereo.get(), length, sample_rate);
     }
     else
       loadSample(buffer.get(), length, sample_rate);
   }
 
+  bool Sample::jsonToState(json data) {
+    name_ = "";
+    if (data.count("name"))
+      name_ = data["name"].get<std::string>();
+
+    if (data.count("file")) {
+      std::string path = data["file"];
+      if (File::isAbsolutePath(path) && loadStreamedSample(File(path)))
+        return true;
+
+      if (data.count("samples"))
+        loadEmbedded(data);
+      else
+        init();
+      return false;
+    }
+
+    loadEmbedded(data);
+    return true;
+  }
+
+  SampleStream::Cursor::Cursor(SampleStream* stream, const int* octaves, bool loop, bool bounce) :
+      stream_(stream), loop_(loop && !bounce), bounce_(bounce), region_starts_(poly_int::kFullMask) {
+    stream_->block_count_++;
+    for (int i = 0; i < poly_float::kSize; ++i) {
+      octaves_[i] = octaves[i];
+      buffers_[i] = stream_->silence_.get();
+    }
+  }
+
+  void SampleStream::Cursor::seek(poly_int starts) {
+    for (int i = 0; i < poly_float::kSize; ++i) {
+      if (starts[i] == region_starts_[i])
+        continue;
+
+      int octave = octaves_[i];
+      int region = starts[i] >> kRegionBits;
+      buffers_[i] = stream_->getRegion(stream_->getKey(octave, region, loop_), i % 2);
+
+      if (i % 2 == 0) {
+        int num_regions = stream_->octave_regions_[octave];
+        int next = region + 1;
+        if (loop_ && next >= num_regions)
+          next = 0;
+        stream_->request(stream_->getKey(octave, next, loop_));
+        if (bounce_)
+          stream_->request(stream_->getKey(octave, region - 1, loop_));
+      }
+    }
+
+    region_starts_ = starts;
+  }
+
+  std::unique_ptr<SampleStream> SampleStream::open(const File& file) {
+    AudioFormatManager format_manager;
+    format_manager.registerBasicFormats();
+
+    std::unique_ptr<AudioFormatReader> reader;
+    AudioFormat* format = format_manager.findFormatForFileExtension(file.getFileExtension());
+    if (format) {
+      std::unique_ptr<MemoryMappedAudioFormatReader> mapped_reader(format->createMemoryMappedReader(file));
+      if (mapped_reader && mapped_reader->mapEntireFile())
+        reader = std::move(mapped_reader);
+    }
+
+    if (reader == nullptr)
+      reader.reset(format_manager.createReaderFor(file));
+
+    if (reader == nullptr || reader->lengthInSamples <= 0 || reader->numChannels == 0 || reader->sampleRate <= 0.0)
+      return nullptr;
+
+    return std::unique_ptr<SampleStream>(new SampleStream(file, std::move(reader)));
+  }
+
+  SampleStream::SampleStream(const File& file, std::unique_ptr<AudioFormatReader> reader) :
+      Thread("Sample Stream"), file_(file), reader_(std::move(reader)), block_count_(0),
+      request_fifo_(kMaxRequests), overview_length_(0) {
+    length_ = static_cast<int>(std::min<int64>(reader_->lengthInSamples, kMaxLength));
+    sample_rate_ = static_cast<int>(reader_->sampleRate);
+    num_channels_ = std::min<int>(reader_->numChannels, 2);
+
+    octave_sizes_[0] = length_ * (1 << Sample::kUpsampleTimes);
+    octave_sizes_[1] = length_;
+    num_octaves_ = 2;
+    int current_size = length_;
+    while (current_size >= Sample::kMinSize && num_octaves_ < kMaxOctaves) {
+      current_size = (current_size + 1) / 2;
+      octave_sizes_[num_octaves_++] = current_size;
+    }
+
+    int num_keys = 0;
+    for (int i = 0; i < num_octaves_; ++i) {
+      octave_regions_[i] = ((octave_sizes_[i] + Sample::kBufferSamples) >> kRegionBits) + 1;
+      octave_keys_[i] = num_keys;
+      num_keys += octave_regions_[i] + 2;
+    }
+    octave_keys_[num_octaves_] = num_keys;
+
+    region_slots_ = std::make_unique<std::atomic<int>[]>(num_keys);
+    for (int i = 0; i < num_keys; ++i)
+      region_slots_[i] = kMissing;
+
+    // The first region of every octave is kept, so notes start without waiting for the disk.
+    for (int i = 0; i < num_octaves_; ++i) {
+      region_slots_[getKey(i, 0, false)] = kRequested;
+      region_slots_[getKey(i, 0, true)] = kRequested;
+    }
+
+    for (Slot& slot : slots_) {
+      slot.key = kMissing;
+      slot.last_used = 0;
+      slot.pinned = false;
+      for (int i = 0; i < num_channels_; ++i)
+        slot.buffers[i] = std::make_unique<mono_float[]>(kSlotSize);
+    }
+    silence_ = std::make_unique<mono_float[]>(kSlotSize);
+
+    scanFile();
+  }
+
+  SampleStream::~SampleStream() {
+    stopThread(kStopTimeout);
+  }
+
+  void SampleStream::run() {
+    for (int i = 0; i < num_octaves_; ++i) {
+      loadRegion(getKey(i, 0, false), true);
+      loadRegion(getKey(i, 0, true), true);
+    }
+
+    while (!threadShouldExit()) {
+      int start1, size1, start2, size2;
+      request_fifo_.prepareToRead(1, start1, size1, start2, size2);
+      if (size1 == 0) {
+        wait(kPollMilliseconds);
+        continue;
+      }
+
+      int key = requests_[start1];
+      request_fifo_.finishedRead(1);
+      loadRegion(key, false);
+    }
+  }
+
+  int SampleStream::getKey(int octave, int region, bool loop) const {
+    int num_regions = octave_regions_[octave];
+    if (region < 0 || region >= num_regions)
+      return kMissing;
+
+    if (loop && region == 0)
+      return octave_keys_[octave] + num_regions;
+    if (loop && region == num_regions - 1)
+      return octave_keys_[octave] + num_regions + 1;
+    return octave_keys_[octave] + region;
+  }
+
+  const mono_float* SampleStream::getRegion(int key, int channel) {
+    if (key < 0)
+      return silence_.get();
+
+    int slot = region_slots_[key].load();
+    if (slot < 0) {
+      request(key);
+      return silence_.get();
+    }
+
+    // The loader checks last_used after unmapping a slot, so one of us always sees the other.
+    slots_[slot].last_used = block_count_.load();
+    if (region_slots_[key].load() != slot)
+      return silence_.get();
+
+    return slots_[slot].buffers[std::min(channel, num_channels_ - 1)].get();
+  }
+
+  void SampleStream::request(int key) {
+    int expected = kMissing;
+    if (key < 0 || !region_slots_[key].compare_exchange_strong(expected, kRequested))
+      return;
+
+    int start1, size1, start2, size2;
+    request_fifo_.prepareToWrite(1, start1, size1, start2, size2);
+    if (size1 == 0) {
+      region_slots_[key] = kMissing;
+      return;
+    }
+
+    requests_[start1] = key;
+    request_fifo_.finishedWrite(1);
+  }
+
+  void SampleStream::scanFile() {
+    overview_length_ = std::min(kOverviewLength, length_);
+    overview_ = std::make_unique<mono_float[]>(overview_length_);
+    for (int i = 0; i < overview_length_; ++i)
+      overview_[i] = -1.0f;
+
+    // The pinned first regions at and below the file's rate are built from this same read. Each
+    // octave renders as much as the one below it needs, which for the last one is most of the file.
+    int num_kept = std::min(length_, kRegionSize);
+    int num_needed[kMaxOctaves];
+    num_needed[num_octaves_ - 1] = std::min(octaveSize(num_octaves_ - 1), kRegionSize);
+    for (int i = num_octaves_ - 2; i > Sample::kUpsampleTimes; --i) {
+      int needed = 2 * num_needed[i + 1] + SampleSource::kNumDownsampleTaps / 2 - 1;
+      num_needed[i] = std::min(octaveSize(i), std::max(needed, kRegionSize));
+    }
+
+    OctaveDecimator decimators[2][kMaxOctaves];
+    mono_float* base_regions[2] = { nullptr, nullptr };
+    for (int i = Sample::kUpsampleTimes; i < num_octaves_; ++i) {
+      int slot_index = i - Sample::kUpsampleTimes;
+      Slot& slot = slots_[slot_index];
+      slot.key = getKey(i, 0, false);
+      slot.pinned = true;
+      region_slots_[slot.key] = slot_index;
+
+      for (int c = 0; c < num_channels_; ++c) {
+        mono_float* region = slot.buffers[c].get() + Sample::kBufferSamples;
+        if (i == Sample::kUpsampleTimes)
+          base_regions[c] = region;
+        else {
+          OctaveDecimator* next = i + 1 < num_octaves_ ? &decimators[c][i + 1] : nullptr;
+          decimators[c][i].init(region, std::min(num_needed[i], kRegionSize), num_needed[i], next);
+        }
+      }
+    }
+
+    std::unique_ptr<mono_float[]> buffers[2];
+    mono_float* channels[2] = { nullptr, nullptr };
+    for (int c = 0; c < num_channels_; ++c) {
+      buffers[c] = std::make_unique<mono_float[]>(kReadChunk);
+      channels[c] = buffers[c].get();
+    }
+
+    bool decimating = Sample::kUpsampleTimes + 1 < num_octaves_;
+    for (int start = 0; start < length_; start += kReadChunk) {
+      int num_samples = std::min(kReadChunk, length_ - start);
+      reader_->read(channels, num_channels_, start, num_samples);
+
+      for (int i = 0; i < num_samples; ++i) {
+        int index = static_cast<int>((static_cast<int64>(start + i) * overview_length_) / length_);
+        overview_[index] = std::max(overview_[index], channels[0][i]);
+      }
+
+      for (int c = 0; c < num_channels_; ++c) {
+        if (start < num_kept)
+          memcpy(base_regions[c] + start, channels[c], std::min(num_samples, num_kept - start) * sizeof(mono_float));
+        if (decimating)
+          decimators[c][Sample::kUpsampleTimes + 1].push(channels[c], num_samples);
+      }
+    }
+
+    if (decimating) {
+      for (int c = 0; c < num_channels_; ++c)
+        decimators[c][Sample::kUpsampleTimes + 1].finish();
+    }
+  }
+
+  void SampleStream::loadRegion(int key, bool pinned) {
+    if (region_slots_[key].load() >= 0)
+      return;
+
+    int slot_index = findFreeSlot();
+    if (slot_index < 0) {
+      region_slots_[key] = kMissing;
+      return;
+    }
+
+    Slot& slot = slots_[slot_index];
+    mono_float* destination[2] = { slot.buffers[0].get(), slot.buffers[1].get() };
+    if (!renderRegion(key, destination)) {
+      region_slots_[key] = kMissing;
+      return;
+    }
+
+    slot.key = key;
+    slot.pinned = pinned;
+    slot.last_used = block_count_.load();
+    region_slots_[key] = slot_index;
+  }
+
+  int SampleStream::findFreeSlot() {
+    unsigned int block_count = block_count_.load();
+    int oldest = -1;
+    unsigned int oldest_age = 0;
+    for (int i = 0; i < kNumSlots; ++i) {
+      if (slots_[i].pinned)
+        continue;
+      if (slots_[i].key == kMissing)
+        return i;
+
+      unsigned int age = block_count - slots_[i].last_used.load();
+      if (age >= kEvictionGrace && age >= oldest_age) {
+        oldest = i;
+        oldest_age = age;
+      }
+    }
+
+    if (oldest < 0)
+      return -1;
+
+    Slot& slot = slots_[oldest];
+    region_slots_[slot.key] = kMissing;
+    if (block_count_.load() - slot.last_used.load() < kEvictionGrace) {
+      region_slots_[slot.key] = oldest;
+      return -1;
+    }
+
+    slot.key = kMissing;
+    return oldest;
+  }
+
+  bool SampleStream::renderRegion(int key, mono_float* const* destination) {
+    int octave = 0;
+    while (key >= octave_keys_[octave + 1])
+      octave++;
+
+    int num_regions = octave_regions_[octave];
+    int region = key - octave_keys_[octave];
+    bool loop = region >= num_regions;
+    if (loop)
+      region = region == num_regions ? 0 : num_regions - 1;
+
+    // Slot index 0 is padded index region * kRegionSize, Sample::kBufferSamples before the octave's sample.
+    // Loop regions only differ from the plain one in their padding, so that's copied when it's loaded.
+    int start = region * kRegionSize - Sample::kBufferSamples;
+    int plain_slot = loop ? region_slots_[getKey(octave, region, false)].load() : kMissing;
+    if (plain_slot >= 0) {
+      for (int c = 0; c < num_channels_; ++c)
+        memcpy(destination[c], slots_[plain_slot].buffers[c].get(), kSlotSize * sizeof(mono_float));
+    }
+    else if (!renderOctave(octave, start, kSlotSize, destination))
+      return false;
+
+    if (!loop)
+      return true;
+
+    // Loop regions wrap their padding around the ends of the sample instead of padding with silence.
+    int size = octaveSize(octave);
+    mono_float wrap_start[2][Sample::kBufferSamples];
+    mono_float wrap_end[2][Sample::kBufferSamples];
+    mono_float* wrap_start_channels[2] = { wrap_start[0], wrap_start[1] };
+    mono_float* wrap_end_channels[2] = { wrap_end[0], wrap_end[1] };
+    if (!renderOctave(octave, 0, Sample::kBufferSamples, wrap_start_channels) ||
+        !renderOctave(octave, size - Sample::kBufferSamples, Sample::kBufferSamples, wrap_end_channels)) {
+      return false;
+    }
+
+    for (int c = 0; c < num_channels_; ++c) {
+      for (int i = 0; i < Sample::kBufferSamples; ++i) {
+        int before = -Sample::kBufferSamples + i - start;
+        if (before >= 0 && before < kSlotSize)
+          destination[c][before] = wrap_end[c][i];
+        int after = size + i - start;
+        if (after >= 0 && after < kSlotSize)
+          destination[c][after] = wrap_start[c][i];
+      }
+    }
+    return true;
+  }
+
+  bool SampleStream::renderOctave(int octave, int start, int num_samples, mono_float* const* destination) {
+    if (octave == Sample::kUpsampleTimes) {
+      reader_->read(destination, num_channels_, start, num_samples);
+      return true;
+    }
+
+    int size = octaveSize(octave);
+    std::vector<mono_float> window[2];
+    for (int chunk = 0; chunk < num_samples; chunk += kRenderChunk) {
+      if (threadShouldExit())
+        return false;
+
+      int chunk_start = start + chunk;
+      int chunk_samples = std::min(kRenderChunk, num_samples - chunk);
+
+      // Same filters as createBandLimitedBuffers, with the previous octave rendered around this chunk.
+      int window_start = 0;
+      int window_end = 0;
+      int previous_octave = 0;
+      if (octave < Sample::kUpsampleTimes) {
+        int radius = SampleSource::kNumUpsampleTaps / 2;
+        window_start = floorHalf(chunk_start) - radius + 1;
+        window_end = floorHalf(chunk_start + chunk_samples - 1) + radius + 1;
+        previous_octave = octave + 1;
+      }
+      else {
+        int radius = SampleSource::kNumDownsampleTaps / 2;
+        window_start = 2 * chunk_start - radius;
+        window_end = 2 * (chunk_start + chunk_samples - 1) + radius + 1;
+        previous_octave = octave - 1;
+      }
+
+      mono_float* window_channels[2] = { nullptr, nullptr };
+      for (int c = 0; c < num_channels_; ++c) {
+        window[c].resize(window_end - window_start);
+        window_channels[c] = window[c].data();
+      }
+      if (!renderOctave(previous_octave, window_start, window_end - window_start, window_channels))
+        return false;
+
+      for (int c = 0; c < num_channels_; ++c) {
+        const mono_float* source = window[c].data();
+        mono_float* dest = destination[c] + chunk;
+
+        for (int i = 0; i < chunk_samples; ++i) {
+          int index = chunk_start + i;
+          if (index < 0 || index >= size)
+            dest[i] = 0.0f;
+          else if (octave < Sample::kUpsampleTimes) {
+            int original_index = index / 2 - window_start;
+            if (index % 2 == 0)
+              dest[i] = source[original_index];
+            else {
+              const mono_float* taps = source + original_index - SampleSource::kNumUpsampleTaps / 2 + 1;
+              mono_float total = 0.0f;
+              for (int t = 0; t < SampleSource::kNumUpsampleTaps; ++t)
+                total += kUpsampleCoefficients[t] * taps[t];
+              dest[i] = total;
+            }
+          }
+          else {
+            const mono_float* taps = source + 2 * index - SampleSource::kNumDownsampleTaps / 2 - window_start;
+            mono_float total = 0.0f;
+            for (int t = 0; t < SampleSource::kNumDownsampleTaps; ++t)
+              total += kDownsampleCoefficients[t] * taps[t];
+            dest[i] = total;
+          }
+        }
+      }
+    }
+
+    return true;
+  }
+
   SampleSource::SampleSource() : Processor(kNumInputs, kNumOutputs), pan_amplitude_(0.0f), phase_inc_(0.0f),
                                  random_generator_(0.0f, 1.0f) {
     transpose_quantize_ = 0;
@@ -363,6 +957,59 @@ namespace vital {
     phase_output_ = std::make_shared<cr::Output>();
   }
 
+  template<class Buffers>
+  void SampleSource::renderRaw(Buffers& buffers, int num_samples, poly_float current_phase_inc,
+                               poly_float delta_phase_inc, poly_float phase_mult, int audio_length,
+                               poly_mask loop_enabled_mask, poly_mask bounce_enabled_mask) {
+    poly_float* raw_output = output(kRaw)->buffer;
+    poly_float current_fraction = sample_fraction_;
+    poly_int length = audio_length;
+    poly_int current_index = utils::maskLoad(sample_index_, length, greaterThanOrEqual(sample_index_, length));
+
+    poly_mask current_bounce = bounce_mask_;
+    for (int i = 0; i < num_samples; ++i) {
+      current_phase_inc += delta_phase_inc;
+
+      poly_int adjusted = utils::maskLoad(current_index, length - current_index, current_bounce);
+      adjusted = adjusted & ~isNegative(adjusted);
+      poly_float high_phase = utils::toFloat(adjusted & poly_int(~kIndexLowMask)) * phase_mult;
+      poly_float low_phase = utils::toFloat(adjusted & poly_int(kIndexLowMask)) * phase_mult;
+      poly_float fraction_phase = current_fraction * phase_mult;
+
+      poly_float rounded_down_phase = utils::floor(low_phase);
+      poly_int start_indices = utils::toInt(high_phase) + utils::toInt(rounded_down_phase);
+      poly_float t = low_phase - rounded_down_phase + fraction_phase;
+
+      t = utils::maskLoad(t, poly_float(1.0f) - t, current_bounce);
+
+      VITAL_ASSERT(poly_int::greaterThan(start_indices, length).anyMask() == 0);
+
+      matrix interpolation_matrix = utils::getCatmullInterpolationMatrix(t);
+      matrix value_matrix = buffers.getValueMatrix(start_indices);
+      value_matrix.transpose();
+      raw_output[i] = interpolation_matrix.multiplyAndSumRows(value_matrix);
+      VITAL_ASSERT(utils::isContained(raw_output[i]));
+
+      current_fraction += current_phase_inc;
+      poly_float increment = utils::floor(current_fraction);
+      current_fraction -= increment;
+
+      current_index += utils::toInt(increment);
+      poly_mask done_mask = greaterThanOrEqual(current_index, length);
+      poly_mask bounced_mask = done_mask & ~current_bounce & bounce_enabled_mask;
+      poly_mask loop_over_mask = done_mask & (current_bounce | ~bounce_enabled_mask) & loop_enabled_mask;
+      current_bounce = (bounced_mask | current_bounce) & ~loop_over_mask;
+
+      current_index = utils::maskLoad(current_index, current_index - length, bounced_mask | loop_over_mask);
+      current_index = utils::maskLoad(current_index, length, greaterThanOrEqual(current_index, length));
+      current_fraction = current_fraction & ~done_mask;
+    }
+
+    bounce_mask_ = current_bounce;
+    sample_index_ = current_index;
+    sample_fraction_ = current_fraction;
+  }
+
   void SampleSource::process(int num_samples) {
     sample_->markUsed();
 
@@ -397,8 +1044,9 @@ namespace vital {
       reset_value -= reset_offset;
     }
     
-    sample_index_ = utils::maskLoad(sample_index_, utils::floor(reset_value), reset_mask);
-    sample_fraction_ = utils::maskLoad(sample_fraction_, reset_value - sample_index_, reset_mask);
+    poly_float reset_index = utils::floor(reset_value);
+    sample_index_ = utils::maskLoad(sample_index_, utils::toInt(reset_index), reset_mask);
+    sample_fraction_ = utils::maskLoad(sample_fraction_, reset_value - reset_index, reset_mask);
 
     bool loop = input(kLoop)->at(0)[0] != 0.0f;
     poly_mask loop_enabled_mask = 0;
@@ -412,77 +1060,48 @@ namespace vital {
     else
       bounce_mask_ = 0;
 
-    const mono_float* audio_buffers[poly_float::kSize];
-    poly_float phase_mult = 1.0f;
-    for (int i = 0; i < poly_float::kSize; ++i) {
-      int index = sample_->getActiveIndex(phase_inc_[i]);
-      if (loop && !bounce) {
-        if (i % 2)
-          audio_buffers[i] = sample_->getActiveRightLoopBuffer(index);
-        else
-          audio_buffers[i] = sample_->getActiveLeftLoopBuffer(index);
-      }
-      else {
-        if (i % 2)
-          audio_buffers[i] = sample_->getActiveRightBuffer(index);
-        else
-          audio_buffers[i] = sample_->getActiveLeftBuffer(index);
-      }
-
-      phase_mult.set(i, 1.0f / (1 << index));
-    }
-
     mono_float sample_inc = 1.0f / num_samples;
     poly_float delta_pan_amplitude = (pan_amplitude_ - current_pan_amplitude) * sample_inc;
     poly_float delta_phase_inc = (phase_inc_ - current_phase_inc) * sample_inc;
 
-    poly_float* raw_output = output(kRaw)->buffer;
-    poly_float current_fraction = sample_fraction_;
-    poly_float current_index = utils::min(sample_index_, audio_length);
-
-    poly_mask current_bounce = bounce_mask_;
-    poly_int length = audio_length;
-    for (int i = 0; i < num_samples; ++i) {
-      current_phase_inc += delta_phase_inc;
-
-      poly_float adjusted = utils::maskLoad(current_index, poly_float(audio_length) - current_index, current_bounce);
-      poly_float index_phase = utils::max(adjusted, 0.0f) * phase_mult;
-      poly_float fraction_phase = current_fraction * phase_mult;
-      
-      poly_int start_indices = utils::floorToInt(index_phase);
-      poly_float rounded_down_phase = utils::toFloat(start_indices);
-      poly_float t = index_phase - rounded_down_phase + fraction_phase;
-
-      t = utils::maskLoad(t, poly_float(1.0f) - t, current_bounce);
-
-      VITAL_ASSERT(poly_float::lessThan(utils::toFloat(start_indices), 0.0f).anyMask() == 0);
-      VITAL_ASSERT(poly_float::greaterThan(utils::toFloat(start_indices), audio_length).anyMask() == 0);
-
-      matrix interpolation_matrix = utils::getCatmullInterpolationMatrix(t);
-      matrix value_matrix = utils::getValueMatrix(audio_buffers, start_indices);
-      value_matrix.transpose();
-      raw_output[i] = interpolation_matrix.multiplyAndSumRows(value_matrix);
-      VITAL_ASSERT(utils::isContained(raw_output[i]));
-
-      current_fraction += current_phase_inc;
-      poly_float increment = utils::floor(current_fraction);
-      current_fraction -= increment;
-
-      current_index += increment;
-      poly_mask done_mask = poly_float::greaterThanOrEqual(current_index, audio_length);
-      poly_mask bounced_mask = done_mask & ~current_bounce & bounce_enabled_mask;
-      poly_mask loop_over_mask = done_mask & (current_bounce | ~bounce_enabled_mask) & loop_enabled_mask;
-      current_bounce = (bounced_mask | current_bounce) & ~loop_over_mask;
+    poly_float phase_mult = 1.0f;
+    int octaves[poly_float::kSize];
+    for (int i = 0; i < poly_float::kSize; ++i) {
+      octaves[i] = sample_->getActiveIndex(phase_inc_[i]);
+      phase_mult.set(i, 1.0f / (1 << octaves[i]));
+    }
 
-      current_index = utils::maskLoad(current_index, current_index - audio_length, bounced_mask | loop_over_mask);
-      current_index = utils::min(audio_length, current_index);
-      current_fraction = current_fraction & ~done_mask;
+    SampleStream* stream = sample_->getActiveStream();
+    if (stream) {
+      SampleStream::Cursor cursor(stream, octaves, loop, bounce);
+      renderRaw(cursor, num_samples, current_phase_inc, delta_phase_inc, phase_mult,
+                audio_length, loop_enabled_mask, bounce_enabled_mask);
+    }
+    else {
+      BufferSet buffers;
+      for (int i = 0; i < poly_float::kSize; ++i) {
+        int index = octaves[i];
+        if (loop && !bounce) {
+          if (i % 2)
+            buffers.buffers[i] = sample_->getActiveRightLoopBuffer(index);
+          else
+            buffers.buffers[i] = sample_->getActiveLeftLoopBuffer(index);
+        }
+        else {
+          if (i % 2)
+            buffers.buffers[i] = sample_->getActiveRightBuffer(index);
+          else
+            buffers.buffers[i] = sample_->getActiveLeftBuffer(index);
+        }
+      }
+      renderRaw(buffers, num_samples, current_phase_inc, delta_phase_inc, phase_mult,
+                audio_length, loop_enabled_mask, bounce_enabled_mask);
     }
 
-    bounce_mask_ = current_bounce;
     if (reset_mask.anyMask())
       clearOutputBufferForReset(reset_mask, kReset, kRaw);
 
+    const poly_float* raw_output = output(kRaw)->buffer;
     const poly_float* level_input = input(kLevel)->source->buffer;
     poly_float* levelled_output = output(kLevelled)->buffer;
     poly_float zero = 0.0f;
@@ -493,10 +1112,8 @@ namespace vital {
       levelled_output[i] = current_pan_amplitude * level * level * raw_output[i];
     }
 
-    sample_index_ = current_index;
-    sample_fraction_ = current_fraction;
-    poly_float phase = utils::maskLoad(sample_index_, poly_float(audio_length) - sample_index_, bounce_mask_);
-    phase = phase * (1.0f / audio_length);
+    poly_int index = utils::maskLoad(sample_index_, poly_int(audio_length) - sample_index_, bounce_mask_);
+    poly_float phase = utils::toFloat(index) * (1.0f / audio_length);
     phase_output_->buffer[0] = utils::encodePhaseAndVoice(phase, input(kNoteCount)->at(0));
 
     sample_->markUnused();
@@ -24,24 +24,32 @@ using json = nlohmann::json;
 
 namespace vital {
 
+  class SampleStream;
+
   class Sample {
     public:
       static constexpr int kDefaultSampleLength = 44100;
+      static constexpr int kMaxMemoryLength = 1764000;
       static constexpr int kUpsampleTimes = 1;
       static constexpr int kBufferSamples = 4;
       static constexpr int kMinSize = 4;
 
       struct SampleData {
-        SampleData(int l, int sr, bool s) : length(l), sample_rate(sr), stereo(s) { }
+        SampleData(int l, int sr, bool s) : length(l), sample_rate(sr), stereo(s), num_octaves(0) { }
+        ~SampleData();
         
         int length;
         int sample_rate;
         bool stereo;
+        int num_octaves;
         std::vector<std::unique_ptr<mono_float[]>> left_buffers;
         std::vector<std::unique_ptr<mono_float[]>> left_loop_buffers;
         std::vector<std::unique_ptr<mono_float[]>> right_buffers;
         std::vector<std::unique_ptr<mono_float[]>> right_loop_buffers;
 
+        // Set instead of the buffers above for samples played from disk.
+        std::unique_ptr<SampleStream> stream;
+
         JUCE_LEAK_DETECTOR(SampleData)
       };
     
@@ -49,6 +57,8 @@ namespace vital {
 
       void loadSample(const mono_float* buffer, int size, int sample_rate);
       void loadSample(const mono_float* left_buffer, const mono_float* right_buffer, int size, int sample_rate);
+      bool loadStreamedSample(const File& file);
+      void swapState(Sample* other);
       void setName(const std::string& name) { name_ = name; }
       std::string getName() const { return name_; }
       void setLastBrowsedFile(const std::string& path) { last_browsed_file_ = path; }
@@ -62,13 +72,17 @@ namespace vital {
       force_inline int activeSampleRate() const { return active_audio_data_.load()->sample_rate; }
 
       force_inline const mono_float* buffer() const { return current_data_->left_buffers[kUpsampleTimes].get() + 1; }
+      const mono_float* overview() const;
+      int overviewLength() const;
       void init();
 
       int getActiveIndex(mono_float delta) {
         int octaves = utils::ilog2(std::max<int>(delta, 1));
-        return std::min(octaves, (int)active_audio_data_.load()->left_buffers.size() - 1);
+        return std::min(octaves, active_audio_data_.load()->num_octaves - 1);
       }
 
+      force_inline SampleStream* getActiveStream() { return active_audio_data_.load()->stream.get(); }
+
       force_inline const mono_float* getActiveLeftBuffer(int index) {
         VITAL_ASSERT(index >= 0 && index < active_audio_data_.load()->left_buffers.size());
 
@@ -101,9 +115,15 @@ namespace vital {
       force_inline void markUnused() { active_audio_data_ = nullptr; }
 
       json stateToJson();
-      void jsonToState(json data);
+      // Returns false when the sample's file couldn't be opened. The copy of its start saved along
+      // with the path is loaded instead, or the default sample if there is none.
+      bool jsonToState(json data);
 
     protected:
+      void setData(std::unique_ptr<SampleData> data);
+      void embedFileStart(json& data, const File& file);
+      void loadEmbedded(const json& data);
+
       std::string name_;
       std::string last_browsed_file_;
       SampleData* current_data_;
@@ -113,6 +133,115 @@ namespace vital {
       JUCE_LEAK_DETECTOR(Sample)
   };
 
+  // Plays a sample file from disk through a fixed pool of regions. Each region holds kRegionSize
+  // padded samples of one octave buffer, laid out like Sample's in memory buffers, and is rendered
+  // by a loader thread from the file the first time it is asked for. The audio thread only looks
+  // regions up and queues requests, reading silence until a region arrives. The first region of
+  // each octave is pinned and built while the file is scanned for its overview.
+  class SampleStream : public Thread {
+    public:
+      static constexpr int kRegionBits = 14;
+      static constexpr int kRegionSize = 1 << kRegionBits;
+      static constexpr int kRegionMask = kRegionSize - 1;
+      static constexpr int kSlotSize = kRegionSize + Sample::kBufferSamples;
+      static constexpr int kMaxOctaves = 12;
+      static constexpr int kMaxLength = 1 << 29;
+      static constexpr int kNumSlots = 96;
+      static constexpr int kMaxRequests = 256;
+      static constexpr int kEvictionGrace = 256;
+      static constexpr int kRenderChunk = 4096;
+      static constexpr int kReadChunk = 65536;
+      static constexpr int kOverviewLength = 32768;
+      static constexpr int kPollMilliseconds = 2;
+      static constexpr int kStopTimeout = 2000;
+
+      // Resolves one block of playback indices to regions, one lane per octave buffer.
+      class Cursor {
+        public:
+          Cursor(SampleStream* stream, const int* octaves, bool loop, bool bounce);
+
+          force_inline matrix getValueMatrix(poly_int indices) {
+            poly_int starts = indices & poly_int(~static_cast<uint32_t>(kRegionMask));
+            if ((~poly_int::equal(starts, region_starts_)).anyMask())
+              seek(starts);
+            return utils::getValueMatrix(buffers_, indices - region_starts_);
+          }
+
+        private:
+          void seek(poly_int starts);
+
+          SampleStream* stream_;
+          int octaves_[poly_float::kSize];
+          bool loop_;
+          bool bounce_;
+          poly_int region_starts_;
+          const mono_float* buffers_[poly_float::kSize];
+      };
+
+      static std::unique_ptr<SampleStream> open(const File& file);
+
+      virtual ~SampleStream();
+
+      void run() override;
+
+      int length() const { return length_; }
+      int sampleRate() const { return sample_rate_; }
+      bool stereo() const { return num_channels_ > 1; }
+      int numOctaves() const { return num_octaves_; }
+      const File& getFile() const { return file_; }
+      const mono_float* overview() const { return overview_.get(); }
+      int overviewLength() const { return overview_length_; }
+
+    private:
+      enum {
+        kRequested = -2,
+        kMissing = -1
+      };
+
+      struct Slot {
+        int key;
+        std::atomic<unsigned int> last_used;
+        bool pinned;
+        std::unique_ptr<mono_float[]> buffers[2];
+      };
+
+      SampleStream(const File& file, std::unique_ptr<AudioFormatReader> reader);
+
+      int octaveSize(int octave) const { return octave_sizes_[octave]; }
+      int getKey(int octave, int region, bool loop) const;
+      const mono_float* getRegion(int key, int channel);
+      void request(int key);
+
+      void scanFile();
+      void loadRegion(int key, bool pinned);
+      int findFreeSlot();
+      bool renderRegion(int key, mono_float* const* destination);
+      bool renderOctave(int octave, int start, int num_samples, mono_float* const* destination);
+
+      File file_;
+      std::unique_ptr<AudioFormatReader> reader_;
+      int length_;
+      int sample_rate_;
+      int num_channels_;
+      int num_octaves_;
+      int octave_sizes_[kMaxOctaves];
+      int octave_regions_[kMaxOctaves];
+      int octave_keys_[kMaxOctaves + 1];
+
+      std::unique_ptr<std::atomic<int>[]> region_slots_;
+      Slot slots_[kNumSlots];
+      std::unique_ptr<mono_float[]> silence_;
+      std::atomic<unsigned int> block_count_;
+
+      AbstractFifo request_fifo_;
+      int requests_[kMaxRequests];
+
+      std::unique_ptr<mono_float[]> overview_;
+      int overview_length_;
+
+      JUCE_LEAK_DETECTOR(SampleStream)
+  };
+
   class SampleSource : public Processor {
     public:
       static constexpr mono_float kMaxTranspose = 96.0f;
@@ -154,10 +283,15 @@ namespace vital {
     private:
       poly_float snapTranspose(poly_float input_midi, poly_float transpose, int quantize);
 
+      template<class Buffers>
+      void renderRaw(Buffers& buffers, int num_samples, poly_float current_phase_inc, poly_float delta_phase_inc,
+                     poly_float phase_mult, int audio_length, poly_mask loop_enabled_mask,
+                     poly_mask bounce_enabled_mask);
+
       poly_float pan_amplitude_;
       int transpose_quantize_;
       poly_float last_quantized_transpose_;
-      poly_float sample_index_;
+      poly_int sample_index_;
       poly_float sample_fraction_;
       poly_float phase_inc_;
       poly_mask bounce_mask_;
@@ -32,8 +32,10 @@ namespace vital {
 
   SoundEngine::SoundEngine() : SynthModule(0, 1), voice_handler_(nullptr), effect_chain_(nullptr),
                                output_total_(nullptr), last_oversampling_amount_(-1), last_sample_rate_(-1),
-                               oversampling_(nullptr), legato_(nullptr), decimator_(nullptr), peak_meter_(nullptr) {
+                               oversampling_(nullptr), legato_(nullptr), decimator_(nullptr), peak_meter_(nullptr),
+                               idle_(false) {
     SoundEngine::init();
+    setProfileName("engine");
     bps_ = data_->controls["beats_per_minute"];
     modulation_processors_.reserve(kMaxModulationConnections);
   }
@@ -103,6 +105,7 @@ namespace vital {
     addProcessor(output_total_);
 
     decimator_ = new Decimator(3);
+    decimator_->setProfileName("decimator");
     decimator_->plug(output_total_);
     addProcessor(decimator_);
 
@@ -131,6 +134,8 @@ namespace vital {
     addProcessor(clamp);
     clamp->useOutput(output());
 
+    output_processors_ = { output_total_, decimator_, decoder, scaled_audio, clamp };
+
     SynthModule::init();
     disableUnnecessaryModSources();
     setOversamplingAmount(kDefaultOversamplingAmount, kDefaultSampleRate);
@@ -239,18 +244,48 @@ namespace vital {
     last_sample_rate_ = sample_rate;
   }
 
+  void SoundEngine::setIdle(bool idle) {
+    if (idle_ == idle)
+      return;
+
+    // With no voices and nothing left ringing in the effects the output stage only has silence to work on,
+    // so it stops until a note comes in. Modulators and meters keep running for the interface.
+    idle_ = idle;
+    for (Processor* processor : output_processors_) {
+      processor->enable(!idle);
+      if (idle)
+        utils::zeroBuffer(processor->output()->buffer, processor->output()->buffer_size);
+    }
+  }
+
+  int SoundEngine::getEqualizerOversamplingAmount() {
+    // The equalizer runs below the oversampled rate unless its cutoffs have audio rate modulation.
+    SynthModule* equalizer = effect_chain_->getEffect(constants::kEq);
+    int decimation = effect_chain_->getOversampleAmount() / equalizer->getOversampleAmount();
+    return std::max(1, last_oversampling_amount_ / decimation);
+  }
+
   void SoundEngine::process(int num_samples) {
     VITAL_ASSERT(num_samples <= output()->buffer_size);
+    VITAL_PROFILE_SCOPE(this);
 
     FloatVectorOperations::disableDenormalisedNumberSupport();
     voice_handler_->setLegato(legato_->value());
+    if (getNumActiveVoices())
+      setIdle(false);
+
     ProcessorRouter::process(num_samples);
 
+    if (!idle_ && getNumActiveVoices() == 0 && effect_chain_->isIdle())
+      setIdle(utils::isSilent(output()->buffer, num_samples));
+
     if (getNumActiveVoices() == 0) {
       CircularQueue<ModulationConnectionProcessor*>& connections = voice_handler_->enabledModulationConnection();
       for (ModulationConnectionProcessor* modulation : connections) {
-        if (!modulation->isInputSourcePolyphonic())
+        if (!modulation->isInputSourcePolyphonic()) {
+          VITAL_PROFILE_SCOPE(modulation);
           modulation->process(num_samples);
+        }
       }
     }
 
@@ -94,11 +94,13 @@ namespace vital {
       void sostenutoOnRange(int from_channel, int to_channel);
       void sostenutoOffRange(int sample, int from_channel, int to_channel);
       force_inline int getOversamplingAmount() const { return last_oversampling_amount_; }
+      int getEqualizerOversamplingAmount();
 
       void checkOversampling();
 
     private:
       void setOversamplingAmount(int oversampling_amount, int sample_rate);
+      void setIdle(bool idle);
     
       SynthVoiceHandler* voice_handler_;
       ReorderableEffectChain* effect_chain_;
@@ -111,6 +113,8 @@ namespace vital {
       Value* legato_;
       Decimator* decimator_;
       PeakMeter* peak_meter_;
+      std::vector<Processor*> output_processors_;
+      bool idle_;
 
       CircularQueue<Processor*> modulation_processors_;
 
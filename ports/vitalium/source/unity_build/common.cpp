@@ -24,9 +24,12 @@
 #include "startup.cpp"
 #include "synth_gui_interface.cpp"
 #include "synth_parameters.cpp"
+#include "binary_state.cpp"
 #include "load_save.cpp"
 #include "synth_types.cpp"
 #include "synth_base.cpp"
+#include "preset_loader.cpp"
+#include "preset_index.cpp"
 #include "wavetable_component_factory.cpp"
 #include "wavetable_keyframe.cpp"
 #include "file_source.cpp"
@@ -0,0 +1,152 @@
+/* Copyright 2013-2019 Matt Tytel
+ *
+ * vital is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * vital is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with vital.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Checks modulation routing through the whole engine without the interface.
+//
+// Usage: vitalium-tests
+
+#include "JuceHeader.h"
+#include "modulation_connection_processor.h"
+#include "sound_engine.h"
+#include "synth_constants.h"
+#include "synth_parameters.h"
+#include "synth_types.h"
+#include "wave_frame.h"
+#include "wavetable.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <string>
+
+namespace {
+  constexpr int kSampleRate = 44100;
+  constexpr int kBlockSize = 64;
+  constexpr int kFirstNote = 60;
+  constexpr int kSecondNote = 67;
+  constexpr float kVelocity = 0.8f;
+  constexpr float kTolerance = 1e-4f;
+
+  int num_failures = 0;
+
+  void check(bool condition, const std::string& message) {
+    if (condition)
+      return;
+
+    fprintf(stderr, "FAILED: %s\n", message.c_str());
+    num_failures++;
+  }
+
+  bool near(vital::poly_float a, vital::poly_float b, float scale) {
+    for (int i = 0; i < vital::poly_float::kSize; ++i) {
+      if (std::abs(a[i] - b[i]) > kTolerance * std::max(1.0f, scale))
+        return false;
+    }
+    return true;
+  }
+
+  void loadSawWavetables(vital::SoundEngine* engine) {
+    float saw[vital::WaveFrame::kWaveformSize];
+    for (int i = 0; i < vital::WaveFrame::kWaveformSize; ++i)
+      saw[i] = 1.0f - 2.0f * i / vital::WaveFrame::kWaveformSize;
+
+    vital::WaveFrame frame;
+    frame.loadTimeDomain(saw);
+    for (int i = 0; i < vital::kNumOscillators; ++i) {
+      engine->getWavetable(i)->setNumFrames(1);
+      engine->getWavetable(i)->loadWaveFrame(&frame);
+    }
+  }
+
+  void processSeconds(vital::SoundEngine* engine, double seconds) {
+    int blocks = seconds * kSampleRate / kBlockSize;
+    for (int i = 0; i < blocks; ++i)
+      engine->process(kBlockSize);
+  }
+
+  vital::modulation_change connect(vital::SoundEngine* engine, const std::string& source,
+                                   const std::string& destination) {
+    vital::ModulationConnection* connection = engine->getModulationBank().createConnection(source, destination);
+
+    vital::modulation_change change;
+    change.source = engine->getModulationSource(source);
+    change.mono_destination = engine->getMonoModulationDestination(destination);
+    change.mono_modulation_switch = engine->getMonoModulationSwitch(destination);
+    change.poly_destination = engine->getPolyModulationDestination(destination);
+    change.poly_modulation_switch = engine->getPolyModulationSwitch(destination);
+    change.destination_scale = vital::Parameters::getParameterRange(destination);
+    change.modulation_processor = connection->modulation_processor.get();
+    change.disconnecting = false;
+    change.num_audio_rate = 0;
+    change.modulation_processor->setBipolar(false);
+    engine->connectModulation(change);
+
+    std::string amount_name = "modulation_" + std::to_string(change.modulation_processor->index() + 1) + "_amount";
+    engine->getControls()[amount_name]->set(1.0f);
+    return change;
+  }
+
+  // A poly LFO drives a mono effect parameter. The destination exists once, after the voices, and has
+  // to follow the voice that was played last in every lane, like the LFO readout does.
+  void testPolySourceToMonoDestination() {
+    vital::SoundEngine engine;
+    loadSawWavetables(&engine);
+
+    vital::control_map controls = engine.getControls();
+    for (auto& control : controls)
+      control.second->set(vital::Parameters::getDetails(control.first).default_value);
+    controls["distortion_on"]->set(1.0f);
+
+    engine.setSampleRate(kSampleRate);
+    engine.updateAllModulationSwitches();
+
+    vital::modulation_change change = connect(&engine, "lfo_1", "distortion_drive");
+    check(change.source->owner->isPolyphonic(), "lfo_1 is a poly source");
+    check(change.poly_destination == nullptr, "distortion_drive is a mono destination");
+    check(!change.modulation_processor->isPolyphonicModulation(), "the connection is mono");
+
+    engine.noteOn(kFirstNote, kVelocity, 0, 0);
+    processSeconds(&engine, 0.3);
+    engine.noteOn(kSecondNote, kVelocity, 0, 0);
+    processSeconds(&engine, 0.05);
+
+    vital::poly_float lfo_voices = change.source->buffer[0];
+    check(!near(lfo_voices, vital::utils::swapVoices(lfo_voices), 1.0f), "the voices' LFOs are apart");
+
+    float scale = change.destination_scale;
+    float base = controls["distortion_drive"]->value();
+    vital::poly_float expected = engine.getStatusOutput("lfo_1")->value() * scale + base;
+    const vital::poly_float* buffer = change.mono_destination->output()->buffer;
+    check(near(buffer[0], expected, scale), "the destination follows the last played voice");
+
+    bool voices_match = true;
+    for (int i = 0; i < kBlockSize; ++i)
+      voices_match = voices_match && near(buffer[i], vital::utils::swapVoices(buffer[i]), scale);
+    check(voices_match, "both voice lanes of the destination hold the same value");
+  }
+} // namespace
+
+int main(int argc, char** argv) {
+  testPolySourceToMonoDestination();
+
+  if (num_failures) {
+    fprintf(stderr, "%d checks failed\n", num_failures);
+    return 1;
+  }
+
+  printf("All checks passed\n");
+  return 0;
+}